@@ -105,8 +105,15 @@
  * - LV_OS_WINDOWS
  * - LV_OS_MQX
  * - LV_OS_SDL2
- * - LV_OS_CUSTOM */
-#define LV_USE_OS   LV_OS_NONE
+ * - LV_OS_CUSTOM
+ *
+ * Simulator: CMake passes SIM_DRAW_UNIT_CNT (the host's core count) when the
+ * SIM_DRAW_THREADS option is ON, see CMakeLists.txt. */
+#if defined(SIM_DRAW_UNIT_CNT) && SIM_DRAW_UNIT_CNT > 1
+    #define LV_USE_OS   LV_OS_PTHREAD
+#else
+    #define LV_USE_OS   LV_OS_NONE
+#endif
 
 #if LV_USE_OS == LV_OS_CUSTOM
     #define LV_OS_CUSTOM_INCLUDE <stdint.h>
@@ -191,7 +198,11 @@
     /** Set number of draw units.
      *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
      *  - > 1 means multiple threads will render the screen in parallel. */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #if defined(SIM_DRAW_UNIT_CNT) && SIM_DRAW_UNIT_CNT > 1
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    SIM_DRAW_UNIT_CNT
+    #else
+        #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #endif
 
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
@@ -217,7 +228,12 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
-    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    /** x86 hosts: SSE2 blend kernels, AVX2 ones are picked at run time if the CPU has it */
+    #if defined(__SSE2__) || defined(_M_X64)
+        #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_X86_SIMD
+    #else
+        #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    #endif
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
         #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
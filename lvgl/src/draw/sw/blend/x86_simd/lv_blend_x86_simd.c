@@ -0,0 +1,137 @@
+/**
+ * @file lv_blend_x86_simd.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_blend_x86_simd.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#include "lv_blend_x86_simd_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+#if LV_BLEND_X86_SIMD_AVX2
+    static void LV_BLEND_X86_SIMD_AVX2_ATTR fill_row_avx2(uint32_t * dest, uint32_t color, int32_t w);
+#endif
+static void fill_row_sse2(uint32_t * dest, uint32_t color, int32_t w);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/*-1: not checked yet. Several draw units may race on the first check but they all
+ *store the same value.*/
+static volatile int8_t avx2_state = -1;
+static bool force_sse2;
+static bool disabled;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool lv_draw_sw_blend_x86_simd_has_avx2(void)
+{
+    if(avx2_state < 0) {
+#if LV_BLEND_X86_SIMD_AVX2 && (defined(__GNUC__) || defined(__clang__))
+        __builtin_cpu_init();
+        avx2_state = __builtin_cpu_supports("avx2") ? 1 : 0;
+#else
+        avx2_state = LV_BLEND_X86_SIMD_AVX2;
+#endif
+    }
+
+    return avx2_state == 1 && !force_sse2;
+}
+
+void lv_draw_sw_blend_x86_simd_force_sse2(bool en)
+{
+    force_sse2 = en;
+    avx2_state = -1;
+}
+
+void lv_draw_sw_blend_x86_simd_set_enabled(bool en)
+{
+    disabled = !en;
+}
+
+bool lv_draw_sw_blend_x86_simd_is_enabled(void)
+{
+    return !disabled;
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_x86_simd_fill_u32(uint32_t * dest, int32_t dest_stride, uint32_t color,
+                                                              int32_t w, int32_t h)
+{
+#if LV_BLEND_X86_SIMD_AVX2
+    bool avx2 = lv_draw_sw_blend_x86_simd_has_avx2();
+#endif
+    int32_t y;
+    for(y = 0; y < h; y++) {
+#if LV_BLEND_X86_SIMD_AVX2
+        if(avx2) fill_row_avx2(dest, color, w);
+        else fill_row_sse2(dest, color, w);
+#else
+        fill_row_sse2(dest, color, w);
+#endif
+        dest = lv_blend_x86_next_row(dest, dest_stride);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_BLEND_X86_SIMD_AVX2
+static void LV_ATTRIBUTE_FAST_MEM LV_BLEND_X86_SIMD_AVX2_ATTR fill_row_avx2(uint32_t * dest, uint32_t color, int32_t w)
+{
+    __m256i c = _mm256_set1_epi32((int32_t)color);
+    int32_t x;
+    for(x = 0; x < w - 15; x += 16) {
+        _mm256_storeu_si256((__m256i *)&dest[x], c);
+        _mm256_storeu_si256((__m256i *)&dest[x + 8], c);
+    }
+    for(; x < w - 7; x += 8) {
+        _mm256_storeu_si256((__m256i *)&dest[x], c);
+    }
+    for(; x < w; x++) {
+        dest[x] = color;
+    }
+}
+#endif
+
+static void LV_ATTRIBUTE_FAST_MEM fill_row_sse2(uint32_t * dest, uint32_t color, int32_t w)
+{
+    __m128i c = _mm_set1_epi32((int32_t)color);
+    int32_t x;
+    for(x = 0; x < w - 15; x += 16) {
+        _mm_storeu_si128((__m128i *)&dest[x], c);
+        _mm_storeu_si128((__m128i *)&dest[x + 4], c);
+        _mm_storeu_si128((__m128i *)&dest[x + 8], c);
+        _mm_storeu_si128((__m128i *)&dest[x + 12], c);
+    }
+    for(; x < w - 3; x += 4) {
+        _mm_storeu_si128((__m128i *)&dest[x], c);
+    }
+    for(; x < w; x++) {
+        dest[x] = color;
+    }
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
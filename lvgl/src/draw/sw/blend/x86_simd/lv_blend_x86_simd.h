@@ -0,0 +1,76 @@
+/**
+ * @file lv_blend_x86_simd.h
+ *
+ */
+
+#ifndef LV_BLEND_X86_SIMD_H
+#define LV_BLEND_X86_SIMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#ifdef LV_DRAW_SW_X86_SIMD_CUSTOM_INCLUDE
+#include LV_DRAW_SW_X86_SIMD_CUSTOM_INCLUDE
+#endif
+
+#include "lv_draw_sw_blend_x86_simd_to_argb8888.h"
+#include "lv_draw_sw_blend_x86_simd_to_rgb888.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Tell whether the AVX2 kernels are used. The CPU is queried on the first call,
+ * SSE2 kernels are used if AVX2 is not available.
+ * @return  true: AVX2 is supported by both the compiler and the CPU
+ */
+bool lv_draw_sw_blend_x86_simd_has_avx2(void);
+
+/**
+ * Force the SSE2 kernels even if AVX2 is available (e.g. to compare the two paths).
+ * @param en    true: use only SSE2; false: detect AVX2 again
+ */
+void lv_draw_sw_blend_x86_simd_force_sse2(bool en);
+
+/**
+ * Enable or disable the x86 kernels. While disabled every hook returns `LV_RESULT_INVALID`,
+ * so the portable C routines of the software renderer run instead (e.g. to compare the two).
+ * @param en    true: use the x86 kernels (default); false: use the C routines
+ */
+void lv_draw_sw_blend_x86_simd_set_enabled(bool en);
+
+/**
+ * Tell whether the x86 kernels are enabled.
+ * @return  true: the hooks use the x86 kernels; false: the C routines are used
+ */
+bool lv_draw_sw_blend_x86_simd_is_enabled(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /* LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD */
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_SIMD_H*/
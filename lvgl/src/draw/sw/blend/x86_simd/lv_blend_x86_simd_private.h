@@ -0,0 +1,255 @@
+/**
+ * @file lv_blend_x86_simd_private.h
+ *
+ */
+
+#ifndef LV_BLEND_X86_SIMD_PRIVATE_H
+#define LV_BLEND_X86_SIMD_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#if !defined(__SSE2__) && !defined(_M_X64) && !(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#error "LV_DRAW_SW_ASM_X86_SIMD requires an x86 target with SSE2"
+#endif
+
+#include "../../../../misc/lv_types.h"
+#include "../../../../misc/lv_color.h"
+#include <string.h>
+#include <emmintrin.h>
+#include <immintrin.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*AVX2 kernels are compiled with a per-function target attribute so the rest of
+ *the library keeps the baseline ISA. Which kernel runs is decided at run time.*/
+#if defined(__AVX2__)
+#define LV_BLEND_X86_SIMD_AVX2          1
+#define LV_BLEND_X86_SIMD_AVX2_ATTR
+#elif defined(__GNUC__) || defined(__clang__)
+#define LV_BLEND_X86_SIMD_AVX2          1
+#define LV_BLEND_X86_SIMD_AVX2_ATTR     __attribute__((target("avx2")))
+#else
+#define LV_BLEND_X86_SIMD_AVX2          0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * How the per pixel alpha of the foreground is calculated.
+ * The `SRC` modes blend an ARGB8888 image, the others a single color.
+ */
+typedef enum {
+    LV_BLEND_X86_ALPHA_OPA,             /**< opa*/
+    LV_BLEND_X86_ALPHA_MASK,            /**< mask[x]*/
+    LV_BLEND_X86_ALPHA_MASK_OPA,        /**< LV_OPA_MIX2(mask[x], opa)*/
+    LV_BLEND_X86_ALPHA_SRC,             /**< src[x].alpha*/
+    LV_BLEND_X86_ALPHA_SRC_OPA,         /**< LV_OPA_MIX2(src[x].alpha, opa)*/
+    LV_BLEND_X86_ALPHA_SRC_MASK,        /**< LV_OPA_MIX2(src[x].alpha, mask[x])*/
+    LV_BLEND_X86_ALPHA_SRC_MASK_OPA,    /**< LV_OPA_MIX3(src[x].alpha, mask[x], opa)*/
+} lv_blend_x86_alpha_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Fill an area of a 32 bit buffer with a color.
+ * @param dest          pointer to the first pixel
+ * @param dest_stride   stride of `dest` in bytes
+ * @param color         the color to write as it is
+ * @param w             width of the area in pixels
+ * @param h             height of the area in pixels
+ */
+void lv_draw_sw_blend_x86_simd_fill_u32(uint32_t * dest, int32_t dest_stride, uint32_t color, int32_t w, int32_t h);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define LV_BLEND_X86_ALPHA_HAS_SRC(mode) ((mode) >= LV_BLEND_X86_ALPHA_SRC)
+
+/**********************
+ *   INLINE FUNCTIONS
+ **********************/
+
+static inline void * lv_blend_x86_next_row(const void * buf, int32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+/**
+ * Alpha of a single foreground pixel. Matches the scalar blend routines bit by bit.
+ */
+static inline uint32_t lv_blend_x86_alpha_1(lv_blend_x86_alpha_t mode, uint32_t src, const lv_opa_t * mask,
+                                            lv_opa_t opa)
+{
+    uint32_t src_a = src >> 24;
+    switch(mode) {
+        case LV_BLEND_X86_ALPHA_OPA:
+            return opa;
+        case LV_BLEND_X86_ALPHA_MASK:
+            return mask[0];
+        case LV_BLEND_X86_ALPHA_MASK_OPA:
+            return LV_OPA_MIX2(mask[0], opa);
+        case LV_BLEND_X86_ALPHA_SRC:
+            return src_a;
+        case LV_BLEND_X86_ALPHA_SRC_OPA:
+            return LV_OPA_MIX2(src_a, opa);
+        case LV_BLEND_X86_ALPHA_SRC_MASK:
+            return LV_OPA_MIX2(src_a, mask[0]);
+        case LV_BLEND_X86_ALPHA_SRC_MASK_OPA:
+        default:
+            return LV_OPA_MIX3(src_a, mask[0], opa);
+    }
+}
+
+/**
+ * Load 4 mask values into the low byte of 4 32 bit lanes
+ */
+static inline __m128i lv_blend_x86_load_mask_4(const lv_opa_t * mask)
+{
+    int32_t m;
+    memcpy(&m, mask, sizeof(m));
+    __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(m), zero), zero);
+}
+
+/**
+ * Alpha of 4 foreground pixels in 32 bit lanes.
+ * `opa_v` has `opa` in every lane.
+ */
+static inline __m128i lv_blend_x86_alpha_4(lv_blend_x86_alpha_t mode, __m128i src, const lv_opa_t * mask,
+                                           __m128i opa_v)
+{
+    /*Both factors are < 256 so the 16 bit product fits in the low half of the 32 bit lane*/
+    __m128i src_a = _mm_srli_epi32(src, 24);
+    switch(mode) {
+        case LV_BLEND_X86_ALPHA_OPA:
+            return opa_v;
+        case LV_BLEND_X86_ALPHA_MASK:
+            return lv_blend_x86_load_mask_4(mask);
+        case LV_BLEND_X86_ALPHA_MASK_OPA:
+            return _mm_srli_epi32(_mm_mullo_epi16(lv_blend_x86_load_mask_4(mask), opa_v), 8);
+        case LV_BLEND_X86_ALPHA_SRC:
+            return src_a;
+        case LV_BLEND_X86_ALPHA_SRC_OPA:
+            return _mm_srli_epi32(_mm_mullo_epi16(src_a, opa_v), 8);
+        case LV_BLEND_X86_ALPHA_SRC_MASK:
+            return _mm_srli_epi32(_mm_mullo_epi16(src_a, lv_blend_x86_load_mask_4(mask)), 8);
+        case LV_BLEND_X86_ALPHA_SRC_MASK_OPA:
+        default:
+            /*(a * m * o) >> 16: the high half of the 16 bit product (a * o) * m*/
+            return _mm_mulhi_epu16(_mm_mullo_epi16(src_a, opa_v), lv_blend_x86_load_mask_4(mask));
+    }
+}
+
+/**
+ * Spread the alpha of 2 pixels (32 bit lanes 0-1 or 2-3) to the 4 16 bit channels of each pixel.
+ */
+static inline __m128i lv_blend_x86_alpha_to_ch_lo(__m128i a)
+{
+    __m128i a16 = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+    return _mm_unpacklo_epi32(a16, a16);
+}
+
+static inline __m128i lv_blend_x86_alpha_to_ch_hi(__m128i a)
+{
+    __m128i a16 = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+    return _mm_unpackhi_epi32(a16, a16);
+}
+
+/**
+ * fg * a + bg * (255 - a) on 16 bit channels. The result is <= 255 * 255 so it fits.
+ */
+static inline __m128i lv_blend_x86_mix_ch(__m128i fg, __m128i bg, __m128i a)
+{
+    __m128i a_inv = _mm_sub_epi16(_mm_set1_epi16(255), a);
+    return _mm_add_epi16(_mm_mullo_epi16(fg, a), _mm_mullo_epi16(bg, a_inv));
+}
+
+/**
+ * Per lane `mask ? a : b`
+ */
+static inline __m128i lv_blend_x86_select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+#if LV_BLEND_X86_SIMD_AVX2
+
+static inline LV_BLEND_X86_SIMD_AVX2_ATTR __m256i lv_blend_x86_load_mask_8(const lv_opa_t * mask)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)mask));
+}
+
+static inline LV_BLEND_X86_SIMD_AVX2_ATTR __m256i lv_blend_x86_alpha_8(lv_blend_x86_alpha_t mode, __m256i src,
+                                                                       const lv_opa_t * mask, __m256i opa_v)
+{
+    __m256i src_a = _mm256_srli_epi32(src, 24);
+    switch(mode) {
+        case LV_BLEND_X86_ALPHA_OPA:
+            return opa_v;
+        case LV_BLEND_X86_ALPHA_MASK:
+            return lv_blend_x86_load_mask_8(mask);
+        case LV_BLEND_X86_ALPHA_MASK_OPA:
+            return _mm256_srli_epi32(_mm256_mullo_epi16(lv_blend_x86_load_mask_8(mask), opa_v), 8);
+        case LV_BLEND_X86_ALPHA_SRC:
+            return src_a;
+        case LV_BLEND_X86_ALPHA_SRC_OPA:
+            return _mm256_srli_epi32(_mm256_mullo_epi16(src_a, opa_v), 8);
+        case LV_BLEND_X86_ALPHA_SRC_MASK:
+            return _mm256_srli_epi32(_mm256_mullo_epi16(src_a, lv_blend_x86_load_mask_8(mask)), 8);
+        case LV_BLEND_X86_ALPHA_SRC_MASK_OPA:
+        default:
+            return _mm256_mulhi_epu16(_mm256_mullo_epi16(src_a, opa_v), lv_blend_x86_load_mask_8(mask));
+    }
+}
+
+/*The unpack instructions work inside the 128 bit halves, which keeps the pixel order
+ *consistent with the unpacked color channels*/
+static inline LV_BLEND_X86_SIMD_AVX2_ATTR __m256i lv_blend_x86_alpha_to_ch_lo_8(__m256i a)
+{
+    __m256i a16 = _mm256_or_si256(a, _mm256_slli_epi32(a, 16));
+    return _mm256_unpacklo_epi32(a16, a16);
+}
+
+static inline LV_BLEND_X86_SIMD_AVX2_ATTR __m256i lv_blend_x86_alpha_to_ch_hi_8(__m256i a)
+{
+    __m256i a16 = _mm256_or_si256(a, _mm256_slli_epi32(a, 16));
+    return _mm256_unpackhi_epi32(a16, a16);
+}
+
+static inline LV_BLEND_X86_SIMD_AVX2_ATTR __m256i lv_blend_x86_mix_ch_8(__m256i fg, __m256i bg, __m256i a)
+{
+    __m256i a_inv = _mm256_sub_epi16(_mm256_set1_epi16(255), a);
+    return _mm256_add_epi16(_mm256_mullo_epi16(fg, a), _mm256_mullo_epi16(bg, a_inv));
+}
+
+static inline LV_BLEND_X86_SIMD_AVX2_ATTR __m256i lv_blend_x86_select_8(__m256i mask, __m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(b, a, mask);
+}
+
+#endif /*LV_BLEND_X86_SIMD_AVX2*/
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_SIMD_PRIVATE_H*/
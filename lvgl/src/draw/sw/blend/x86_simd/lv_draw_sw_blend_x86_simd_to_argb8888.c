@@ -0,0 +1,327 @@
+/**
+ * @file lv_draw_sw_blend_x86_simd_to_argb8888.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_simd_to_argb8888.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#include "lv_blend_x86_simd.h"
+#include "lv_blend_x86_simd_private.h"
+#include "../../../../misc/lv_color_op.h"
+#include "../lv_draw_sw_blend_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_result_t blend(void * dest_buf, int32_t dest_stride, const void * src_buf, int32_t src_stride,
+                         uint32_t color, const lv_opa_t * mask, int32_t mask_stride, lv_opa_t opa,
+                         int32_t w, int32_t h, lv_blend_x86_alpha_t mode);
+
+static void blend_row_sse2(uint32_t * dest, const uint32_t * src, uint32_t color, const lv_opa_t * mask,
+                           lv_opa_t opa, int32_t w, lv_blend_x86_alpha_t mode);
+
+#if LV_BLEND_X86_SIMD_AVX2
+    static void LV_BLEND_X86_SIMD_AVX2_ATTR blend_row_avx2(uint32_t * dest, const uint32_t * src, uint32_t color,
+                                                           const lv_opa_t * mask, lv_opa_t opa, int32_t w,
+                                                           lv_blend_x86_alpha_t mode);
+#endif
+
+static inline uint32_t argb_mix_1(uint32_t fg, uint32_t fg_a, uint32_t bg);
+
+static inline uint32_t color32_to_u32(lv_color32_t c);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_argb8888(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    if(!lv_draw_sw_blend_x86_simd_is_enabled()) return LV_RESULT_INVALID;
+
+    lv_draw_sw_blend_x86_simd_fill_u32(dsc->dest_buf, dsc->dest_stride, lv_color_to_u32(dsc->color),
+                                       dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_argb8888_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    return blend(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u32(dsc->color), NULL, 0, dsc->opa,
+                 dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_argb8888_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    return blend(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u32(dsc->color), dsc->mask_buf,
+                 dsc->mask_stride, LV_OPA_COVER, dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_MASK);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_argb8888_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    return blend(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u32(dsc->color), dsc->mask_buf,
+                 dsc->mask_stride, dsc->opa, dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_MASK_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_argb8888(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    return blend(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, NULL, 0, LV_OPA_COVER,
+                 dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_SRC);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_argb8888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    return blend(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, NULL, 0, dsc->opa,
+                 dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_SRC_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_argb8888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    return blend(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, dsc->mask_buf,
+                 dsc->mask_stride, LV_OPA_COVER, dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_SRC_MASK);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_argb8888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    return blend(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, dsc->mask_buf,
+                 dsc->mask_stride, dsc->opa, dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_SRC_MASK_OPA);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t LV_ATTRIBUTE_FAST_MEM blend(void * dest_buf, int32_t dest_stride, const void * src_buf,
+                                               int32_t src_stride, uint32_t color, const lv_opa_t * mask,
+                                               int32_t mask_stride, lv_opa_t opa, int32_t w, int32_t h,
+                                               lv_blend_x86_alpha_t mode)
+{
+    if(!lv_draw_sw_blend_x86_simd_is_enabled()) return LV_RESULT_INVALID;
+
+#if LV_BLEND_X86_SIMD_AVX2
+    bool avx2 = lv_draw_sw_blend_x86_simd_has_avx2();
+#endif
+    uint32_t * dest = dest_buf;
+    const uint32_t * src = src_buf;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+#if LV_BLEND_X86_SIMD_AVX2
+        if(avx2) blend_row_avx2(dest, src, color, mask, opa, w, mode);
+        else blend_row_sse2(dest, src, color, mask, opa, w, mode);
+#else
+        blend_row_sse2(dest, src, color, mask, opa, w, mode);
+#endif
+        dest = lv_blend_x86_next_row(dest, dest_stride);
+        if(src) src = lv_blend_x86_next_row(src, src_stride);
+        if(mask) mask += mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * The same as `lv_color_32_32_mix()` in the scalar renderer, with the foreground alpha passed separately.
+ * The vector kernels handle every case except "both colors are semi-transparent" in place
+ * and use this function only for those pixels.
+ */
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM argb_mix_1(uint32_t fg, uint32_t fg_a, uint32_t bg)
+{
+    uint32_t bg_a = bg >> 24;
+
+    if(fg_a >= LV_OPA_MAX || bg_a <= LV_OPA_MIN) {
+        return (fg & 0x00ffffff) | (fg_a << 24);
+    }
+    else if(fg_a <= LV_OPA_MIN) {
+        return bg;
+    }
+
+    lv_color32_t fg_c = {
+        .blue = (uint8_t)fg,
+        .green = (uint8_t)(fg >> 8),
+        .red = (uint8_t)(fg >> 16),
+    };
+    lv_color32_t bg_c = {
+        .blue = (uint8_t)bg,
+        .green = (uint8_t)(bg >> 8),
+        .red = (uint8_t)(bg >> 16),
+        .alpha = (uint8_t)bg_a,
+    };
+
+    if(bg_a == 255) {
+        fg_c.alpha = (uint8_t)fg_a;
+        return color32_to_u32(lv_color_mix32(fg_c, bg_c));
+    }
+
+    uint32_t res_a = 255 - LV_OPA_MIX2(255 - fg_a, 255 - bg_a);
+    fg_c.alpha = (lv_opa_t)((fg_a * 255) / res_a);
+    lv_color32_t res = lv_color_mix32(fg_c, bg_c);
+    res.alpha = (uint8_t)res_a;
+    return color32_to_u32(res);
+}
+
+static inline uint32_t color32_to_u32(lv_color32_t c)
+{
+    return ((uint32_t)c.alpha << 24) | ((uint32_t)c.red << 16) | ((uint32_t)c.green << 8) | c.blue;
+}
+
+static void LV_ATTRIBUTE_FAST_MEM blend_row_sse2(uint32_t * dest, const uint32_t * src, uint32_t color,
+                                                 const lv_opa_t * mask, lv_opa_t opa, int32_t w,
+                                                 lv_blend_x86_alpha_t mode)
+{
+    const bool has_src = LV_BLEND_X86_ALPHA_HAS_SRC(mode);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb_mask = _mm_set1_epi32(0x00ffffff);
+    const __m128i alpha_ff = _mm_set1_epi32((int32_t)0xff000000);
+    const __m128i div255 = _mm_set1_epi16((int16_t)0x8081);
+    const __m128i opa_v = _mm_set1_epi32(opa);
+    const __m128i color_v = _mm_set1_epi32((int32_t)color);
+    const __m128i opa_max = _mm_set1_epi32(LV_OPA_MAX - 1);
+    const __m128i opa_min = _mm_set1_epi32(LV_OPA_MIN + 1);
+    const __m128i opa_cover = _mm_set1_epi32(LV_OPA_COVER);
+
+    int32_t x;
+    for(x = 0; x < w - 3; x += 4) {
+        __m128i fg = has_src ? _mm_loadu_si128((const __m128i *)&src[x]) : color_v;
+        __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x]);
+        __m128i fg_a = lv_blend_x86_alpha_4(mode, fg, mask ? &mask[x] : NULL, opa_v);
+        __m128i bg_a = _mm_srli_epi32(bg, 24);
+
+        /*Opaque background: mix the channels and keep the background's alpha (255)*/
+        __m128i fg_lo = _mm_unpacklo_epi8(fg, zero);
+        __m128i fg_hi = _mm_unpackhi_epi8(fg, zero);
+        __m128i bg_lo = _mm_unpacklo_epi8(bg, zero);
+        __m128i bg_hi = _mm_unpackhi_epi8(bg, zero);
+        __m128i mix_lo = lv_blend_x86_mix_ch(fg_lo, bg_lo, lv_blend_x86_alpha_to_ch_lo(fg_a));
+        __m128i mix_hi = lv_blend_x86_mix_ch(fg_hi, bg_hi, lv_blend_x86_alpha_to_ch_hi(fg_a));
+        /*LV_UDIV255(x) == (x * 0x8081) >> 23*/
+        mix_lo = _mm_srli_epi16(_mm_mulhi_epu16(mix_lo, div255), 7);
+        mix_hi = _mm_srli_epi16(_mm_mulhi_epu16(mix_hi, div255), 7);
+        __m128i res = _mm_or_si128(_mm_and_si128(_mm_packus_epi16(mix_lo, mix_hi), rgb_mask), alpha_ff);
+
+        /*Transparent foreground: keep the background*/
+        __m128i sel_bg = _mm_cmplt_epi32(fg_a, opa_min);
+        /*Opaque foreground or transparent background: take the foreground with its new alpha*/
+        __m128i sel_fg = _mm_or_si128(_mm_cmpgt_epi32(fg_a, opa_max), _mm_cmplt_epi32(bg_a, opa_min));
+        __m128i sel_mix = _mm_cmpeq_epi32(bg_a, opa_cover);
+
+        res = lv_blend_x86_select(sel_bg, bg, res);
+        res = lv_blend_x86_select(sel_fg, _mm_or_si128(_mm_and_si128(fg, rgb_mask), _mm_slli_epi32(fg_a, 24)), res);
+
+        /*Both semi-transparent: the division doesn't vectorize, do these pixels one by one*/
+        int slow = _mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(_mm_or_si128(sel_bg, sel_fg), sel_mix))) ^ 0xf;
+        if(slow) {
+            uint32_t slow_px[4];
+            int32_t i;
+            for(i = 0; i < 4; i++) {
+                if(slow & (1 << i)) {
+                    uint32_t fg_1 = has_src ? src[x + i] : color;
+                    uint32_t a_1 = lv_blend_x86_alpha_1(mode, fg_1, mask ? &mask[x + i] : NULL, opa);
+                    slow_px[i] = argb_mix_1(fg_1, a_1, dest[x + i]);
+                }
+            }
+            _mm_storeu_si128((__m128i *)&dest[x], res);
+            for(i = 0; i < 4; i++) {
+                if(slow & (1 << i)) dest[x + i] = slow_px[i];
+            }
+        }
+        else {
+            _mm_storeu_si128((__m128i *)&dest[x], res);
+        }
+    }
+
+    for(; x < w; x++) {
+        uint32_t fg_1 = has_src ? src[x] : color;
+        uint32_t a_1 = lv_blend_x86_alpha_1(mode, fg_1, mask ? &mask[x] : NULL, opa);
+        dest[x] = argb_mix_1(fg_1, a_1, dest[x]);
+    }
+}
+
+#if LV_BLEND_X86_SIMD_AVX2
+static void LV_ATTRIBUTE_FAST_MEM LV_BLEND_X86_SIMD_AVX2_ATTR blend_row_avx2(uint32_t * dest, const uint32_t * src,
+                                                                             uint32_t color, const lv_opa_t * mask,
+                                                                             lv_opa_t opa, int32_t w,
+                                                                             lv_blend_x86_alpha_t mode)
+{
+    const bool has_src = LV_BLEND_X86_ALPHA_HAS_SRC(mode);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i rgb_mask = _mm256_set1_epi32(0x00ffffff);
+    const __m256i alpha_ff = _mm256_set1_epi32((int32_t)0xff000000);
+    const __m256i div255 = _mm256_set1_epi16((int16_t)0x8081);
+    const __m256i opa_v = _mm256_set1_epi32(opa);
+    const __m256i color_v = _mm256_set1_epi32((int32_t)color);
+    const __m256i opa_max = _mm256_set1_epi32(LV_OPA_MAX - 1);
+    const __m256i opa_min = _mm256_set1_epi32(LV_OPA_MIN + 1);
+    const __m256i opa_cover = _mm256_set1_epi32(LV_OPA_COVER);
+
+    int32_t x;
+    for(x = 0; x < w - 7; x += 8) {
+        __m256i fg = has_src ? _mm256_loadu_si256((const __m256i *)&src[x]) : color_v;
+        __m256i bg = _mm256_loadu_si256((const __m256i *)&dest[x]);
+        __m256i fg_a = lv_blend_x86_alpha_8(mode, fg, mask ? &mask[x] : NULL, opa_v);
+        __m256i bg_a = _mm256_srli_epi32(bg, 24);
+
+        __m256i mix_lo = lv_blend_x86_mix_ch_8(_mm256_unpacklo_epi8(fg, zero), _mm256_unpacklo_epi8(bg, zero),
+                                               lv_blend_x86_alpha_to_ch_lo_8(fg_a));
+        __m256i mix_hi = lv_blend_x86_mix_ch_8(_mm256_unpackhi_epi8(fg, zero), _mm256_unpackhi_epi8(bg, zero),
+                                               lv_blend_x86_alpha_to_ch_hi_8(fg_a));
+        mix_lo = _mm256_srli_epi16(_mm256_mulhi_epu16(mix_lo, div255), 7);
+        mix_hi = _mm256_srli_epi16(_mm256_mulhi_epu16(mix_hi, div255), 7);
+        __m256i res = _mm256_or_si256(_mm256_and_si256(_mm256_packus_epi16(mix_lo, mix_hi), rgb_mask), alpha_ff);
+
+        __m256i sel_bg = _mm256_cmpgt_epi32(opa_min, fg_a);
+        __m256i sel_fg = _mm256_or_si256(_mm256_cmpgt_epi32(fg_a, opa_max), _mm256_cmpgt_epi32(opa_min, bg_a));
+        __m256i sel_mix = _mm256_cmpeq_epi32(bg_a, opa_cover);
+
+        res = lv_blend_x86_select_8(sel_bg, bg, res);
+        res = lv_blend_x86_select_8(sel_fg, _mm256_or_si256(_mm256_and_si256(fg, rgb_mask),
+                                                            _mm256_slli_epi32(fg_a, 24)), res);
+
+        int slow = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_or_si256(sel_bg, sel_fg),
+                                                                          sel_mix))) ^ 0xff;
+        if(slow) {
+            uint32_t slow_px[8];
+            int32_t i;
+            for(i = 0; i < 8; i++) {
+                if(slow & (1 << i)) {
+                    uint32_t fg_1 = has_src ? src[x + i] : color;
+                    uint32_t a_1 = lv_blend_x86_alpha_1(mode, fg_1, mask ? &mask[x + i] : NULL, opa);
+                    slow_px[i] = argb_mix_1(fg_1, a_1, dest[x + i]);
+                }
+            }
+            _mm256_storeu_si256((__m256i *)&dest[x], res);
+            for(i = 0; i < 8; i++) {
+                if(slow & (1 << i)) dest[x + i] = slow_px[i];
+            }
+        }
+        else {
+            _mm256_storeu_si256((__m256i *)&dest[x], res);
+        }
+    }
+
+    if(x < w) {
+        blend_row_sse2(&dest[x], has_src ? &src[x] : NULL, color, mask ? &mask[x] : NULL, opa, w - x, mode);
+    }
+}
+#endif /*LV_BLEND_X86_SIMD_AVX2*/
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
@@ -0,0 +1,250 @@
+/**
+ * @file lv_draw_sw_blend_x86_simd_to_rgb888.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_x86_simd_to_rgb888.h"
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#include "lv_blend_x86_simd.h"
+#include "lv_blend_x86_simd_private.h"
+#include "../lv_draw_sw_blend_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_result_t blend(void * dest_buf, int32_t dest_stride, const void * src_buf, int32_t src_stride,
+                         uint32_t color, const lv_opa_t * mask, int32_t mask_stride, lv_opa_t opa,
+                         int32_t w, int32_t h, lv_blend_x86_alpha_t mode);
+
+static void blend_row_sse2(uint32_t * dest, const uint32_t * src, uint32_t color, const lv_opa_t * mask,
+                           lv_opa_t opa, int32_t w, lv_blend_x86_alpha_t mode);
+
+#if LV_BLEND_X86_SIMD_AVX2
+    static void LV_BLEND_X86_SIMD_AVX2_ATTR blend_row_avx2(uint32_t * dest, const uint32_t * src, uint32_t color,
+                                                           const lv_opa_t * mask, lv_opa_t opa, int32_t w,
+                                                           lv_blend_x86_alpha_t mode);
+#endif
+
+static inline uint32_t xrgb_mix_1(uint32_t fg, uint32_t mix, uint32_t bg);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb888(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size)
+{
+    if(dest_px_size != 4 || !lv_draw_sw_blend_x86_simd_is_enabled()) return LV_RESULT_INVALID;
+
+    lv_draw_sw_blend_x86_simd_fill_u32(dsc->dest_buf, dsc->dest_stride, lv_color_to_u32(dsc->color),
+                                       dsc->dest_w, dsc->dest_h);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb888_with_opa(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                               uint32_t dest_px_size)
+{
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    return blend(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u32(dsc->color), NULL, 0, dsc->opa,
+                 dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb888_with_mask(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                                uint32_t dest_px_size)
+{
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    return blend(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u32(dsc->color), dsc->mask_buf,
+                 dsc->mask_stride, LV_OPA_COVER, dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_MASK);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_color_to_rgb888_with_opa_mask(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                                    uint32_t dest_px_size)
+{
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    return blend(dsc->dest_buf, dsc->dest_stride, NULL, 0, lv_color_to_u32(dsc->color), dsc->mask_buf,
+                 dsc->mask_stride, dsc->opa, dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_MASK_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb888(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size)
+{
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    return blend(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, NULL, 0, LV_OPA_COVER,
+                 dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_SRC);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb888_with_opa(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                  uint32_t dest_px_size)
+{
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    return blend(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, NULL, 0, dsc->opa,
+                 dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_SRC_OPA);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb888_with_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                   uint32_t dest_px_size)
+{
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    return blend(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, dsc->mask_buf,
+                 dsc->mask_stride, LV_OPA_COVER, dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_SRC_MASK);
+}
+
+lv_result_t lv_draw_sw_blend_x86_simd_argb8888_to_rgb888_with_opa_mask(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                       uint32_t dest_px_size)
+{
+    if(dest_px_size != 4) return LV_RESULT_INVALID;
+
+    return blend(dsc->dest_buf, dsc->dest_stride, dsc->src_buf, dsc->src_stride, 0, dsc->mask_buf,
+                 dsc->mask_stride, dsc->opa, dsc->dest_w, dsc->dest_h, LV_BLEND_X86_ALPHA_SRC_MASK_OPA);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t LV_ATTRIBUTE_FAST_MEM blend(void * dest_buf, int32_t dest_stride, const void * src_buf,
+                                               int32_t src_stride, uint32_t color, const lv_opa_t * mask,
+                                               int32_t mask_stride, lv_opa_t opa, int32_t w, int32_t h,
+                                               lv_blend_x86_alpha_t mode)
+{
+    if(!lv_draw_sw_blend_x86_simd_is_enabled()) return LV_RESULT_INVALID;
+
+#if LV_BLEND_X86_SIMD_AVX2
+    bool avx2 = lv_draw_sw_blend_x86_simd_has_avx2();
+#endif
+    uint32_t * dest = dest_buf;
+    const uint32_t * src = src_buf;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+#if LV_BLEND_X86_SIMD_AVX2
+        if(avx2) blend_row_avx2(dest, src, color, mask, opa, w, mode);
+        else blend_row_sse2(dest, src, color, mask, opa, w, mode);
+#else
+        blend_row_sse2(dest, src, color, mask, opa, w, mode);
+#endif
+        dest = lv_blend_x86_next_row(dest, dest_stride);
+        if(src) src = lv_blend_x86_next_row(src, src_stride);
+        if(mask) mask += mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * The same as `lv_color_24_24_mix()` in the scalar renderer on a 32 bit pixel.
+ * The X byte of the destination is kept.
+ */
+static inline uint32_t LV_ATTRIBUTE_FAST_MEM xrgb_mix_1(uint32_t fg, uint32_t mix, uint32_t bg)
+{
+    if(mix == 0) return bg;
+    if(mix >= LV_OPA_MAX) return (bg & 0xff000000) | (fg & 0x00ffffff);
+
+    uint32_t mix_inv = 255 - mix;
+    uint32_t b = (((fg & 0xff) * mix + (bg & 0xff) * mix_inv) >> 8);
+    uint32_t g = ((((fg >> 8) & 0xff) * mix + ((bg >> 8) & 0xff) * mix_inv) >> 8);
+    uint32_t r = ((((fg >> 16) & 0xff) * mix + ((bg >> 16) & 0xff) * mix_inv) >> 8);
+    return (bg & 0xff000000) | (r << 16) | (g << 8) | b;
+}
+
+static void LV_ATTRIBUTE_FAST_MEM blend_row_sse2(uint32_t * dest, const uint32_t * src, uint32_t color,
+                                                 const lv_opa_t * mask, lv_opa_t opa, int32_t w,
+                                                 lv_blend_x86_alpha_t mode)
+{
+    const bool has_src = LV_BLEND_X86_ALPHA_HAS_SRC(mode);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb_mask = _mm_set1_epi32(0x00ffffff);
+    const __m128i opa_v = _mm_set1_epi32(opa);
+    const __m128i color_v = _mm_set1_epi32((int32_t)color);
+    const __m128i opa_max = _mm_set1_epi32(LV_OPA_MAX - 1);
+
+    int32_t x;
+    for(x = 0; x < w - 3; x += 4) {
+        __m128i fg = has_src ? _mm_loadu_si128((const __m128i *)&src[x]) : color_v;
+        __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x]);
+        __m128i mix = lv_blend_x86_alpha_4(mode, fg, mask ? &mask[x] : NULL, opa_v);
+
+        __m128i mix_lo = lv_blend_x86_mix_ch(_mm_unpacklo_epi8(fg, zero), _mm_unpacklo_epi8(bg, zero),
+                                             lv_blend_x86_alpha_to_ch_lo(mix));
+        __m128i mix_hi = lv_blend_x86_mix_ch(_mm_unpackhi_epi8(fg, zero), _mm_unpackhi_epi8(bg, zero),
+                                             lv_blend_x86_alpha_to_ch_hi(mix));
+        __m128i res = _mm_packus_epi16(_mm_srli_epi16(mix_lo, 8), _mm_srli_epi16(mix_hi, 8));
+
+        /*Nearly opaque: copy the color as it is*/
+        res = lv_blend_x86_select(_mm_cmpgt_epi32(mix, opa_max), fg, res);
+        /*Keep the X byte and leave the pixel untouched where nothing is mixed*/
+        res = lv_blend_x86_select(rgb_mask, res, bg);
+        res = lv_blend_x86_select(_mm_cmpeq_epi32(mix, zero), bg, res);
+        _mm_storeu_si128((__m128i *)&dest[x], res);
+    }
+
+    for(; x < w; x++) {
+        uint32_t fg_1 = has_src ? src[x] : color;
+        uint32_t mix_1 = lv_blend_x86_alpha_1(mode, fg_1, mask ? &mask[x] : NULL, opa);
+        dest[x] = xrgb_mix_1(fg_1, mix_1, dest[x]);
+    }
+}
+
+#if LV_BLEND_X86_SIMD_AVX2
+static void LV_ATTRIBUTE_FAST_MEM LV_BLEND_X86_SIMD_AVX2_ATTR blend_row_avx2(uint32_t * dest, const uint32_t * src,
+                                                                             uint32_t color, const lv_opa_t * mask,
+                                                                             lv_opa_t opa, int32_t w,
+                                                                             lv_blend_x86_alpha_t mode)
+{
+    const bool has_src = LV_BLEND_X86_ALPHA_HAS_SRC(mode);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i rgb_mask = _mm256_set1_epi32(0x00ffffff);
+    const __m256i opa_v = _mm256_set1_epi32(opa);
+    const __m256i color_v = _mm256_set1_epi32((int32_t)color);
+    const __m256i opa_max = _mm256_set1_epi32(LV_OPA_MAX - 1);
+
+    int32_t x;
+    for(x = 0; x < w - 7; x += 8) {
+        __m256i fg = has_src ? _mm256_loadu_si256((const __m256i *)&src[x]) : color_v;
+        __m256i bg = _mm256_loadu_si256((const __m256i *)&dest[x]);
+        __m256i mix = lv_blend_x86_alpha_8(mode, fg, mask ? &mask[x] : NULL, opa_v);
+
+        __m256i mix_lo = lv_blend_x86_mix_ch_8(_mm256_unpacklo_epi8(fg, zero), _mm256_unpacklo_epi8(bg, zero),
+                                               lv_blend_x86_alpha_to_ch_lo_8(mix));
+        __m256i mix_hi = lv_blend_x86_mix_ch_8(_mm256_unpackhi_epi8(fg, zero), _mm256_unpackhi_epi8(bg, zero),
+                                               lv_blend_x86_alpha_to_ch_hi_8(mix));
+        __m256i res = _mm256_packus_epi16(_mm256_srli_epi16(mix_lo, 8), _mm256_srli_epi16(mix_hi, 8));
+
+        res = lv_blend_x86_select_8(_mm256_cmpgt_epi32(mix, opa_max), fg, res);
+        res = lv_blend_x86_select_8(rgb_mask, res, bg);
+        res = lv_blend_x86_select_8(_mm256_cmpeq_epi32(mix, zero), bg, res);
+        _mm256_storeu_si256((__m256i *)&dest[x], res);
+    }
+
+    if(x < w) {
+        blend_row_sse2(&dest[x], has_src ? &src[x] : NULL, color, mask ? &mask[x] : NULL, opa, w - x, mode);
+    }
+}
+#endif /*LV_BLEND_X86_SIMD_AVX2*/
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
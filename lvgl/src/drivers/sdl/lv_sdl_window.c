@@ -17,6 +17,7 @@
 #include "../../stdlib/lv_string.h"
 #include "../../core/lv_global.h"
 #include "../../display/lv_display_private.h"
+#include "../../misc/lv_area_private.h"
 #include "../../lv_init.h"
 #include "../../draw/lv_draw_buf.h"
 
@@ -42,6 +43,10 @@
  *********************/
 #define lv_deinit_in_progress  LV_GLOBAL_DEFAULT()->deinit_in_progress
 
+/*Max. number of separate dirty rectangles uploaded to the texture per refresh.
+ *If more are flushed they are merged into their bounding box.*/
+#define DIRTY_AREA_MAX  16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -57,6 +62,9 @@ typedef struct {
     uint8_t * buf2;
     uint8_t * rotated_buf;
     size_t rotated_buf_size;
+    lv_area_t dirty_areas[DIRTY_AREA_MAX];  /*Areas flushed since the last texture upload*/
+    uint32_t dirty_cnt;
+    bool dirty_full;                        /*Upload the whole frame buffer on the next update*/
 #endif
     float zoom;
     uint8_t ignore_size_chg;
@@ -71,6 +79,8 @@ static void window_create(lv_display_t * disp);
 static void window_update(lv_display_t * disp);
 #if LV_USE_DRAW_SDL == 0
     static void texture_resize(lv_display_t * disp);
+    static void dirty_area_add(lv_sdl_window_t * dsc, const lv_area_t * area);
+    static void texture_upload(lv_display_t * disp);
     static void * sdl_draw_buf_realloc_aligned(void * ptr, size_t new_size);
     static void sdl_draw_buf_free(void * ptr);
 #endif
@@ -238,6 +248,21 @@ void lv_sdl_quit(void)
     }
 }
 
+void lv_sdl_set_event_polling(bool en)
+{
+    if(event_handler_timer == NULL) return;
+
+    if(en) lv_timer_resume(event_handler_timer);
+    else lv_timer_pause(event_handler_timer);
+}
+
+void lv_sdl_handle_events(void)
+{
+    if(!inited) return;
+
+    sdl_event_handler(NULL);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -283,6 +308,7 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_m
 
         lv_area_t rotated_area = *area;
         lv_display_rotate_area(disp, &rotated_area);
+        dirty_area_add(dsc, &rotated_area);
 
         int32_t px_map_w = lv_area_get_width(area);
         int32_t px_map_h = lv_area_get_height(area);
@@ -308,6 +334,11 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_m
             lv_draw_sw_rotate(px_map, fb_start, px_map_w, px_map_h, px_map_stride, fb_stride, rotation, cf);
         }
     }
+    else {
+        /*DIRECT/FULL: the areas are already in frame buffer coordinates*/
+        if(lv_display_get_rotation(disp) == LV_DISPLAY_ROTATION_0) dirty_area_add(dsc, area);
+        else dsc->dirty_full = true;
+    }
 
     if(lv_display_flush_is_last(disp)) {
         if(sdl_render_mode() != LV_DISPLAY_RENDER_MODE_PARTIAL) {
@@ -420,13 +451,7 @@ static void window_update(lv_display_t * disp)
 {
     lv_sdl_window_t * dsc = lv_display_get_driver_data(disp);
 #if LV_USE_DRAW_SDL == 0
-    int32_t hor_res = disp->hor_res;
-    lv_color_format_t cf = lv_display_get_color_format(disp);
-    if(cf == LV_COLOR_FORMAT_I1) {
-        cf = LV_COLOR_FORMAT_ARGB8888;
-    }
-    uint32_t stride = lv_draw_buf_width_to_stride(hor_res, cf);
-    SDL_UpdateTexture(dsc->texture, NULL, dsc->fb_act, stride);
+    texture_upload(disp);
 
     SDL_RenderClear(dsc->renderer);
 
@@ -479,6 +504,83 @@ static void texture_resize(lv_display_t * disp)
     dsc->texture = SDL_CreateTexture(dsc->renderer, px_format,
                                      SDL_TEXTUREACCESS_STATIC, disp->hor_res, disp->ver_res);
     SDL_SetTextureBlendMode(dsc->texture, SDL_BLENDMODE_BLEND);
+
+    /*The new texture is empty, so it needs the whole frame buffer once*/
+    dsc->dirty_cnt = 0;
+    dsc->dirty_full = true;
+}
+
+/**
+ * Remember a flushed area so that only the changed parts of the frame buffer
+ * are uploaded to the texture. Overlapping or adjacent areas are joined
+ * if the result is not larger than the two areas separately.
+ */
+static void dirty_area_add(lv_sdl_window_t * dsc, const lv_area_t * area)
+{
+    if(dsc->dirty_full) return;
+
+    uint32_t i;
+    for(i = 0; i < dsc->dirty_cnt; i++) {
+        lv_area_t joined;
+        lv_area_join(&joined, &dsc->dirty_areas[i], area);
+        if(lv_area_get_size(&joined) <= lv_area_get_size(&dsc->dirty_areas[i]) + lv_area_get_size(area)) {
+            dsc->dirty_areas[i] = joined;
+            return;
+        }
+    }
+
+    if(dsc->dirty_cnt < DIRTY_AREA_MAX) {
+        dsc->dirty_areas[dsc->dirty_cnt] = *area;
+        dsc->dirty_cnt++;
+        return;
+    }
+
+    /*Out of slots: fall back to the bounding box of everything*/
+    for(i = 1; i < dsc->dirty_cnt; i++) {
+        lv_area_join(&dsc->dirty_areas[0], &dsc->dirty_areas[0], &dsc->dirty_areas[i]);
+    }
+    lv_area_join(&dsc->dirty_areas[0], &dsc->dirty_areas[0], area);
+    dsc->dirty_cnt = 1;
+}
+
+/**
+ * Copy the dirty parts of the active frame buffer to the texture
+ */
+static void texture_upload(lv_display_t * disp)
+{
+    lv_sdl_window_t * dsc = lv_display_get_driver_data(disp);
+    if(dsc->fb_act == NULL) return;
+
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    if(cf == LV_COLOR_FORMAT_I1) {
+        cf = LV_COLOR_FORMAT_ARGB8888;
+    }
+    uint32_t stride = lv_draw_buf_width_to_stride(disp->hor_res, cf);
+    uint32_t px_size = lv_color_format_get_size(cf);
+
+    if(dsc->dirty_full) {
+        SDL_UpdateTexture(dsc->texture, NULL, dsc->fb_act, stride);
+    }
+    else {
+        lv_area_t scr_area;
+        lv_area_set(&scr_area, 0, 0, disp->hor_res - 1, disp->ver_res - 1);
+
+        uint32_t i;
+        for(i = 0; i < dsc->dirty_cnt; i++) {
+            lv_area_t a;
+            if(!lv_area_intersect(&a, &dsc->dirty_areas[i], &scr_area)) continue;
+
+            SDL_Rect rect;
+            rect.x = a.x1;
+            rect.y = a.y1;
+            rect.w = lv_area_get_width(&a);
+            rect.h = lv_area_get_height(&a);
+            SDL_UpdateTexture(dsc->texture, &rect, dsc->fb_act + a.y1 * stride + a.x1 * px_size, stride);
+        }
+    }
+
+    dsc->dirty_cnt = 0;
+    dsc->dirty_full = false;
 }
 
 static void * sdl_draw_buf_realloc_aligned(void * ptr, size_t new_size)
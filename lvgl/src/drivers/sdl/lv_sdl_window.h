@@ -59,6 +59,21 @@ void * lv_sdl_window_get_renderer(lv_display_t * disp);
 
 void lv_sdl_quit(void);
 
+/**
+ * Enable or disable the LVGL timer which polls the SDL event queue every 5 ms.
+ * Disable it if the application waits for SDL events itself (e.g. with `SDL_WaitEventTimeout()`)
+ * and calls `lv_sdl_handle_events()` when it wakes up. Otherwise `lv_timer_handler()`
+ * never returns a delay longer than 5 ms.
+ * @param en    true: poll the events from an LVGL timer (default); false: the application handles them
+ */
+void lv_sdl_set_event_polling(bool en);
+
+/**
+ * Process the pending SDL events (mouse, keyboard, mouse wheel and window events) right now.
+ * Has to be called from the thread which created the window, with `lv_lock()` held.
+ */
+void lv_sdl_handle_events(void);
+
 struct SDL_Window * lv_sdl_window_get_window(lv_display_t * disp);
 
 /**********************
@@ -47,6 +47,12 @@ static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a);
 static int32_t value_to_y(lv_obj_t * obj, lv_chart_series_t * ser, int32_t v, int32_t h);
+static void draw_series_envelope(lv_obj_t * obj, lv_chart_series_t * ser, lv_layer_t * layer,
+                                 lv_draw_line_dsc_t * line_dsc, int32_t x_ofs, int32_t y_ofs, int32_t w, int32_t h);
+static bool envelope_prepare(lv_obj_t * obj, lv_chart_series_t * ser, int32_t w);
+static void envelope_add(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, int32_t value);
+static void envelope_scan(const int32_t * points, uint32_t from, uint32_t to, int32_t * min, int32_t * max);
+static void envelope_free(lv_chart_series_t * ser);
 
 /**********************
  *  STATIC VARIABLES
@@ -156,6 +162,7 @@ void lv_chart_set_point_count(lv_obj_t * obj, uint32_t cnt)
         }
         if(!ser->y_ext_buf_assigned) new_points_alloc(obj, ser, cnt, &ser->y_points);
         ser->start_point = 0;
+        ser->env_w = 0;
     }
 
     chart->point_cnt = cnt;
@@ -451,6 +458,13 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The values might have been changed directly: rebuild the envelopes on the next draw*/
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_chart_series_t * ser;
+    LV_LL_READ(&chart->series_ll, ser) {
+        ser->env_w = 0;
+    }
+
     lv_obj_invalidate(obj);
 }
 
@@ -528,6 +542,7 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_free(series->y_points);
     if(!series->x_ext_buf_assigned && series->x_points) lv_free(series->x_points);
+    envelope_free(series);
 
     lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
@@ -562,6 +577,26 @@ lv_color_t lv_chart_get_series_color(lv_obj_t * chart, const lv_chart_series_t *
     return series->color;
 }
 
+void lv_chart_set_series_decimate(lv_obj_t * obj, lv_chart_series_t * ser, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(ser);
+
+    if(ser->decimate == en) return;
+    ser->decimate = en;
+    if(!en) envelope_free(ser);
+    lv_obj_invalidate(obj);
+}
+
+bool lv_chart_get_series_decimate(const lv_obj_t * obj, const lv_chart_series_t * ser)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(ser);
+    LV_UNUSED(obj);
+
+    return ser->decimate;
+}
+
 void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -570,6 +605,7 @@ void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(id >= chart->point_cnt) return;
     ser->start_point = id;
+    ser->env_w = 0;
 }
 
 lv_chart_series_t * lv_chart_get_series_next(const lv_obj_t * obj, const lv_chart_series_t * ser)
@@ -678,6 +714,7 @@ void lv_chart_set_all_values(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
         ser->y_points[i] = value;
     }
     ser->start_point = 0;
+    ser->env_w = 0;
     lv_chart_refresh(obj);
 }
 
@@ -691,6 +728,7 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
 
     ser->y_points[ser->start_point] = value;
     invalidate_point(obj, ser->start_point);
+    envelope_add(obj, ser, ser->start_point, value);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
 }
 
@@ -738,6 +776,7 @@ void lv_chart_set_series_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, ui
 
     if(id >= chart->point_cnt) return;
     ser->y_points[id] = value;
+    ser->env_w = 0;
     invalidate_point(obj, id);
 }
 
@@ -767,6 +806,7 @@ void lv_chart_set_series_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, in
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
+    ser->env_w = 0;
     lv_obj_invalidate(obj);
 }
 
@@ -867,6 +907,7 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         if(!ser->y_ext_buf_assigned) lv_free(ser->y_points);
         if(!ser->x_ext_buf_assigned) lv_free(ser->x_points);
+        envelope_free(ser);
 
         lv_ll_remove(&chart->series_ll, ser);
         lv_free(ser);
@@ -1066,6 +1107,15 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.id2 = 0;
         point_dsc_default.base.id2 = 0;
 
+        if(ser->decimate && crowded_mode && envelope_prepare(obj, ser, w)) {
+            draw_series_envelope(obj, ser, layer, &line_dsc, x_ofs, y_ofs, w, h);
+            if(line_dsc.base.id1 > 0) {
+                line_dsc.base.id1--;
+                point_dsc_default.base.id1--;
+            }
+            continue;
+        }
+
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
         line_dsc.p1.x = x_ofs;
@@ -1162,6 +1212,80 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     }
 }
 
+/**
+ * Draw a series as one vertical min/max line per block of points (about one block per pixel column).
+ * Each line is extended to the last value of the previous block so that the columns are connected.
+ * The block the next value will be written to holds new points below `start_point` and old points
+ * from `start_point`. Only the new ones are in its envelope, the old ones are scanned here.
+ */
+static void draw_series_envelope(lv_obj_t * obj, lv_chart_series_t * ser, lv_layer_t * layer,
+                                 lv_draw_line_dsc_t * line_dsc, int32_t x_ofs, int32_t y_ofs, int32_t w, int32_t h)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    uint32_t n = chart->point_cnt;
+    uint32_t block = ser->env_block;
+    uint32_t wr = ser->start_point;
+    uint32_t wr_block = wr / block;
+    bool shift = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT;
+    int32_t y_min_value = chart->ymin[ser->y_axis_sec];
+    int32_t y_range = chart->ymax[ser->y_axis_sec] - y_min_value;
+    int32_t ext = line_dsc->width;
+    int32_t prev = LV_CHART_POINT_NONE;
+
+    int32_t old_min;
+    int32_t old_max;
+    envelope_scan(ser->y_points, wr, LV_MIN((wr_block + 1) * block, n), &old_min, &old_max);
+
+    /*In shift mode the oldest point is on the left, so the block being written is drawn
+     *twice: first with its old points, at the end with its new points*/
+    uint32_t seg_cnt = shift ? ser->env_cnt + 1 : ser->env_cnt;
+    uint32_t s;
+    for(s = 0; s < seg_cnt; s++) {
+        uint32_t k = shift ? (wr_block + s) % ser->env_cnt : s;
+        int32_t v_min = ser->env_min[k];
+        int32_t v_max = ser->env_max[k];
+        uint32_t last = LV_MIN((k + 1) * block, n) - 1;
+
+        if(k == wr_block) {
+            if(shift && s == 0) {
+                v_min = old_min;
+                v_max = old_max;
+            }
+            else if(shift) {
+                last = wr - 1;  /*Not used if there are no new points yet*/
+            }
+            else {
+                v_min = LV_MIN(v_min, old_min);
+                v_max = LV_MAX(v_max, old_max);
+            }
+        }
+
+        /*Only LV_CHART_POINT_NONE in the block*/
+        if(v_min > v_max) {
+            prev = LV_CHART_POINT_NONE;
+            continue;
+        }
+
+        if(prev != LV_CHART_POINT_NONE) {
+            v_min = LV_MIN(v_min, prev);
+            v_max = LV_MAX(v_max, prev);
+        }
+        prev = ser->y_points[last];
+
+        uint32_t d = shift ? (last + n - wr) % n : last;
+        int32_t x = (int32_t)(((int64_t)w * d) / (n - 1)) + x_ofs;
+        if(x < layer->_clip_area.x1 - ext || x > layer->_clip_area.x2 + ext) continue;
+
+        line_dsc->p1.x = x;
+        line_dsc->p2.x = x;
+        line_dsc->p1.y = h - (int32_t)((v_max - y_min_value) * h) / y_range + y_ofs;
+        line_dsc->p2.y = h - (int32_t)((v_min - y_min_value) * h) / y_range + y_ofs;
+        if(line_dsc->p1.y == line_dsc->p2.y) line_dsc->p2.y++;    /*If they are the same no line will be drawn*/
+        line_dsc->base.id2 = d;
+        lv_draw_line(layer, line_dsc);
+    }
+}
+
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
 {
     lv_chart_t * chart  = (lv_chart_t *)obj;
@@ -1723,4 +1847,110 @@ static int32_t value_to_y(lv_obj_t * obj, lv_chart_series_t * ser, int32_t v, in
     return lv_map(v, chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
 }
 
+/**
+ * Size the envelope of a series for a content width and build it if needed
+ * @param obj   pointer to a chart
+ * @param ser   pointer to the series
+ * @param w     content width of the chart
+ * @return      true: the envelope is ready to draw; false: out of memory
+ */
+static bool envelope_prepare(lv_obj_t * obj, lv_chart_series_t * ser, int32_t w)
+{
+    lv_chart_t * chart = (lv_chart_t *) obj;
+    if(w <= 0) return false;
+    if(ser->env_w == w) return true;
+
+    uint32_t block = (chart->point_cnt + w - 1) / w;
+    uint32_t cnt = (chart->point_cnt + block - 1) / block;
+    if(ser->env_min == NULL || ser->env_cnt != cnt) {
+        envelope_free(ser);
+        ser->env_min = lv_malloc(sizeof(int32_t) * cnt);
+        ser->env_max = lv_malloc(sizeof(int32_t) * cnt);
+        LV_ASSERT_MALLOC(ser->env_min);
+        LV_ASSERT_MALLOC(ser->env_max);
+        if(ser->env_min == NULL || ser->env_max == NULL) {
+            envelope_free(ser);
+            return false;
+        }
+        ser->env_cnt = cnt;
+    }
+    ser->env_block = block;
+
+    /*The block being written holds only its new points*/
+    uint32_t wr = ser->start_point;
+    uint32_t k;
+    for(k = 0; k < cnt; k++) {
+        uint32_t from = k * block;
+        uint32_t to = k == wr / block ? wr : LV_MIN(from + block, chart->point_cnt);
+        envelope_scan(ser->y_points, from, to, &ser->env_min[k], &ser->env_max[k]);
+    }
+
+    ser->env_w = w;
+    return true;
+}
+
+/**
+ * Add a new value to the envelope of its block
+ * @param obj   pointer to a chart
+ * @param ser   pointer to the series
+ * @param id    index of the new value in the y array
+ * @param value the new value
+ */
+static void envelope_add(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, int32_t value)
+{
+    lv_chart_t * chart = (lv_chart_t *) obj;
+    if(ser->env_w == 0) return;     /*Not built or will be rebuilt anyway*/
+
+    uint32_t block = ser->env_block;
+    uint32_t k = id / block;
+    if(value != LV_CHART_POINT_NONE) {
+        if(value < ser->env_min[k]) ser->env_min[k] = value;
+        if(value > ser->env_max[k]) ser->env_max[k] = value;
+    }
+
+    /*The next value starts a new block. Its old points are not in its envelope*/
+    uint32_t next = (id + 1) % chart->point_cnt;
+    if(next % block == 0) {
+        ser->env_min[next / block] = INT32_MAX;
+        ser->env_max[next / block] = INT32_MIN;
+    }
+
+    /*In circular mode only the columns around the point are redrawn. The block's line is at
+     *its last point and the next block's line is joined to it.*/
+    if(chart->update_mode == LV_CHART_UPDATE_MODE_CIRCULAR) {
+        uint32_t last = LV_MIN((k + 1) * block, chart->point_cnt) - 1;
+        invalidate_point(obj, last);
+        invalidate_point(obj, LV_MIN(last + block, chart->point_cnt - 1));
+    }
+}
+
+/**
+ * Get the min. and max. of the points in [from, to), ignoring `LV_CHART_POINT_NONE`.
+ * If there are no such points min. will be greater than max.
+ */
+static void envelope_scan(const int32_t * points, uint32_t from, uint32_t to, int32_t * min, int32_t * max)
+{
+    int32_t v_min = INT32_MAX;
+    int32_t v_max = INT32_MIN;
+    uint32_t i;
+    for(i = from; i < to; i++) {
+        int32_t v = points[i];
+        if(v == LV_CHART_POINT_NONE) continue;
+        if(v < v_min) v_min = v;
+        if(v > v_max) v_max = v;
+    }
+    *min = v_min;
+    *max = v_max;
+}
+
+static void envelope_free(lv_chart_series_t * ser)
+{
+    lv_free(ser->env_min);
+    lv_free(ser->env_max);
+    ser->env_min = NULL;
+    ser->env_max = NULL;
+    ser->env_cnt = 0;
+    ser->env_w = 0;
+}
+
 #endif
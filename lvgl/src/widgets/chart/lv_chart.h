@@ -254,6 +254,30 @@ void lv_chart_set_series_color(lv_obj_t * chart, lv_chart_series_t * series, lv_
  */
 lv_color_t lv_chart_get_series_color(lv_obj_t * chart, const lv_chart_series_t * series);
 
+/**
+ * Draw a line series as a min/max envelope: one vertical line per pixel column
+ * spanning the smallest and largest value of the points in that column.
+ * Useful with a large point count (e.g. 100k points of history): the drawing time
+ * depends on the chart's width and not on the number of points.
+ * The envelope of blocks of points is kept up to date by `lv_chart_set_next_value()`
+ * at constant cost. Other ways of changing the values (e.g. writing the y array
+ * and calling `lv_chart_refresh()`) rebuild it on the next draw.
+ * Used only if the chart type is `LV_CHART_TYPE_LINE` and there are at least as many
+ * points as pixels; otherwise the series is drawn as usual.
+ * @param obj       pointer to a chart object
+ * @param ser       pointer to a series object
+ * @param en        true: enable decimation
+ */
+void lv_chart_set_series_decimate(lv_obj_t * obj, lv_chart_series_t * ser, bool en);
+
+/**
+ * Get whether a series is drawn as a min/max envelope
+ * @param obj       pointer to a chart object
+ * @param ser       pointer to a series object
+ * @return          true: decimation is enabled
+ */
+bool lv_chart_get_series_decimate(const lv_obj_t * obj, const lv_chart_series_t * ser);
+
 /**
  * Set the index of the x-axis start point in the data array.
  * This point will be considers the first (left) point and the other points will be drawn after it.
@@ -35,11 +35,17 @@ struct _lv_chart_series_t {
     int32_t * y_points;
     lv_color_t color;
     uint32_t start_point;
+    int32_t * env_min;          /**< Decimation: min. of each block of points (NULL if not built) */
+    int32_t * env_max;          /**< Decimation: max. of each block of points */
+    uint32_t env_block;         /**< Decimation: points per block */
+    uint32_t env_cnt;           /**< Decimation: number of blocks */
+    int32_t env_w;              /**< Decimation: content width the blocks were built for, 0: rebuild */
     uint32_t hidden : 1;
     uint32_t x_ext_buf_assigned : 1;
     uint32_t y_ext_buf_assigned : 1;
     uint32_t x_axis_sec : 1;
     uint32_t y_axis_sec : 1;
+    uint32_t decimate : 1;
 };
 
 struct _lv_chart_cursor_t {
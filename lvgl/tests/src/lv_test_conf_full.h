@@ -206,6 +206,10 @@
 
 #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    1
 
+#if defined(__SSE2__) || defined(_M_X64)
+    #define LV_USE_DRAW_SW_ASM  LV_DRAW_SW_ASM_X86_SIMD
+#endif
+
 #define LV_USE_GESTURE_RECOGNITION 1
 
 #define LV_DISABLE_API_MAPPING 1
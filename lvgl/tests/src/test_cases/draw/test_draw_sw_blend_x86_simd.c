@@ -0,0 +1,245 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD
+
+#include "../../src/draw/sw/blend/x86_simd/lv_blend_x86_simd.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_argb8888.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb888.h"
+
+#define BUF_W       37  /*Not a multiple of 4 or 8 to exercise the scalar tails too*/
+#define BUF_H       4
+#define BUF_STRIDE  (40 * 4)
+
+static uint32_t dest_ref[BUF_H * BUF_STRIDE / 4];
+static uint32_t dest_simd[BUF_H * BUF_STRIDE / 4];
+static uint32_t src_buf[BUF_H * BUF_STRIDE / 4];
+static lv_opa_t mask_buf[BUF_H * BUF_W];
+static uint32_t rnd_state;
+
+void setUp(void)
+{
+    rnd_state = 12345;
+}
+
+void tearDown(void)
+{
+    lv_draw_sw_blend_x86_simd_force_sse2(false);
+    lv_draw_sw_blend_x86_simd_set_enabled(true);
+}
+
+static uint32_t rnd(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return rnd_state >> 8;
+}
+
+/*Bias the alpha values towards the thresholds where the blending takes shortcuts*/
+static uint8_t rnd_alpha(void)
+{
+    static const uint8_t edges[] = {0, 1, 2, 3, 127, 128, 252, 253, 254, 255};
+    uint32_t r = rnd();
+    if(r & 1) return edges[(r >> 1) % sizeof(edges)];
+    else return (uint8_t)(r >> 1);
+}
+
+static void fill_random(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(dest_ref) / sizeof(dest_ref[0]); i++) {
+        dest_ref[i] = ((uint32_t)rnd_alpha() << 24) | (rnd() & 0xffffff);
+        dest_simd[i] = dest_ref[i];
+        src_buf[i] = ((uint32_t)rnd_alpha() << 24) | (rnd() & 0xffffff);
+    }
+
+    for(i = 0; i < sizeof(mask_buf); i++) {
+        mask_buf[i] = rnd_alpha();
+    }
+}
+
+static void check_fill(bool xrgb, bool use_mask, lv_opa_t opa)
+{
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_w = BUF_W;
+    dsc.dest_h = BUF_H;
+    dsc.dest_stride = BUF_STRIDE;
+    dsc.mask_buf = use_mask ? mask_buf : NULL;
+    dsc.mask_stride = BUF_W;
+    dsc.color = lv_color_hex(0x10a0f0);
+    dsc.opa = opa;
+
+    /*Reference: the C routines of the software renderer with the x86 kernels turned off*/
+    dsc.dest_buf = dest_ref;
+    lv_draw_sw_blend_x86_simd_set_enabled(false);
+    if(xrgb) lv_draw_sw_blend_color_to_rgb888(&dsc, 4);
+    else lv_draw_sw_blend_color_to_argb8888(&dsc);
+    lv_draw_sw_blend_x86_simd_set_enabled(true);
+
+    dsc.dest_buf = dest_simd;
+    lv_result_t res;
+    if(use_mask && opa >= LV_OPA_MAX) {
+        res = xrgb ? lv_draw_sw_blend_x86_simd_color_to_rgb888_with_mask(&dsc, 4) :
+              lv_draw_sw_blend_x86_simd_color_to_argb8888_with_mask(&dsc);
+    }
+    else if(use_mask) {
+        res = xrgb ? lv_draw_sw_blend_x86_simd_color_to_rgb888_with_opa_mask(&dsc, 4) :
+              lv_draw_sw_blend_x86_simd_color_to_argb8888_with_opa_mask(&dsc);
+    }
+    else if(opa < LV_OPA_MAX) {
+        res = xrgb ? lv_draw_sw_blend_x86_simd_color_to_rgb888_with_opa(&dsc, 4) :
+              lv_draw_sw_blend_x86_simd_color_to_argb8888_with_opa(&dsc);
+    }
+    else {
+        res = xrgb ? lv_draw_sw_blend_x86_simd_color_to_rgb888(&dsc, 4) :
+              lv_draw_sw_blend_x86_simd_color_to_argb8888(&dsc);
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(dest_ref, dest_simd, sizeof(dest_ref) / sizeof(dest_ref[0]));
+}
+
+static void check_image(bool xrgb, bool use_mask, lv_opa_t opa)
+{
+    lv_draw_sw_blend_image_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_w = BUF_W;
+    dsc.dest_h = BUF_H;
+    dsc.dest_stride = BUF_STRIDE;
+    dsc.mask_buf = use_mask ? mask_buf : NULL;
+    dsc.mask_stride = BUF_W;
+    dsc.src_buf = src_buf;
+    dsc.src_stride = BUF_STRIDE;
+    dsc.src_color_format = LV_COLOR_FORMAT_ARGB8888;
+    dsc.opa = opa;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    dsc.dest_buf = dest_ref;
+    lv_draw_sw_blend_x86_simd_set_enabled(false);
+    if(xrgb) lv_draw_sw_blend_image_to_rgb888(&dsc, 4);
+    else lv_draw_sw_blend_image_to_argb8888(&dsc);
+    lv_draw_sw_blend_x86_simd_set_enabled(true);
+
+    dsc.dest_buf = dest_simd;
+    lv_result_t res;
+    if(use_mask && opa >= LV_OPA_MAX) {
+        res = xrgb ? lv_draw_sw_blend_x86_simd_argb8888_to_rgb888_with_mask(&dsc, 4) :
+              lv_draw_sw_blend_x86_simd_argb8888_to_argb8888_with_mask(&dsc);
+    }
+    else if(use_mask) {
+        res = xrgb ? lv_draw_sw_blend_x86_simd_argb8888_to_rgb888_with_opa_mask(&dsc, 4) :
+              lv_draw_sw_blend_x86_simd_argb8888_to_argb8888_with_opa_mask(&dsc);
+    }
+    else if(opa < LV_OPA_MAX) {
+        res = xrgb ? lv_draw_sw_blend_x86_simd_argb8888_to_rgb888_with_opa(&dsc, 4) :
+              lv_draw_sw_blend_x86_simd_argb8888_to_argb8888_with_opa(&dsc);
+    }
+    else {
+        res = xrgb ? lv_draw_sw_blend_x86_simd_argb8888_to_rgb888(&dsc, 4) :
+              lv_draw_sw_blend_x86_simd_argb8888_to_argb8888(&dsc);
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(dest_ref, dest_simd, sizeof(dest_ref) / sizeof(dest_ref[0]));
+}
+
+static void check_all(void)
+{
+    static const lv_opa_t opas[] = {LV_OPA_COVER, LV_OPA_MAX, LV_OPA_70, LV_OPA_50, 3, LV_OPA_TRANSP};
+    uint32_t i;
+    uint32_t round;
+    for(round = 0; round < 50; round++) {
+        for(i = 0; i < sizeof(opas); i++) {
+            uint32_t xrgb;
+            for(xrgb = 0; xrgb < 2; xrgb++) {
+                fill_random();
+                check_fill(xrgb, false, opas[i]);
+                fill_random();
+                check_fill(xrgb, true, opas[i]);
+                fill_random();
+                check_image(xrgb, false, opas[i]);
+                fill_random();
+                check_image(xrgb, true, opas[i]);
+            }
+        }
+    }
+}
+
+void test_x86_simd_blend_sse2_matches_scalar(void)
+{
+    lv_draw_sw_blend_x86_simd_force_sse2(true);
+    TEST_ASSERT_FALSE(lv_draw_sw_blend_x86_simd_has_avx2());
+    check_all();
+}
+
+void test_x86_simd_blend_avx2_matches_scalar(void)
+{
+    if(!lv_draw_sw_blend_x86_simd_has_avx2()) {
+        TEST_PASS_MESSAGE("AVX2 is not available on this CPU");
+    }
+    check_all();
+}
+
+void test_x86_simd_fill(void)
+{
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = dest_simd;
+    dsc.dest_w = BUF_W;
+    dsc.dest_h = BUF_H;
+    dsc.dest_stride = BUF_STRIDE;
+    dsc.color = lv_color_hex(0x123456);
+    dsc.opa = LV_OPA_COVER;
+
+    fill_random();
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_sw_blend_x86_simd_color_to_argb8888(&dsc));
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < BUF_H; y++) {
+        for(x = 0; x < BUF_STRIDE / 4; x++) {
+            uint32_t i = y * BUF_STRIDE / 4 + x;
+            TEST_ASSERT_EQUAL_HEX32(x < BUF_W ? 0xff123456 : dest_ref[i], dest_simd[i]);
+        }
+    }
+
+    /*RGB888 is not accelerated*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_draw_sw_blend_x86_simd_color_to_rgb888(&dsc, 3));
+
+    /*Disabled kernels leave the work to the C routines*/
+    lv_draw_sw_blend_x86_simd_set_enabled(false);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_draw_sw_blend_x86_simd_color_to_argb8888(&dsc));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_draw_sw_blend_x86_simd_color_to_rgb888_with_opa(&dsc, 4));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_x86_simd_blend_sse2_matches_scalar(void)
+{
+    ;
+}
+
+void test_x86_simd_blend_avx2_matches_scalar(void)
+{
+    ;
+}
+
+void test_x86_simd_fill(void)
+{
+    ;
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86_SIMD*/
+
+#endif
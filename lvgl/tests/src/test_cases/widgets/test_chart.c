@@ -219,6 +219,177 @@ void test_chart_scatter(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_scatter.png");
 }
 
+static uint32_t envelope_line_cnt;
+static int32_t envelope_top;
+static int32_t envelope_top_x;
+static int32_t envelope_bottom;
+static int32_t envelope_gap_x1;
+static int32_t envelope_gap_x2;
+static uint32_t envelope_gap_cnt;
+
+static void envelope_event_cb(lv_event_t * e)
+{
+    lv_draw_task_t * draw_task = lv_event_get_draw_task(e);
+    if(lv_draw_task_get_type(draw_task) != LV_DRAW_TASK_TYPE_LINE) return;
+
+    lv_draw_line_dsc_t * line_dsc = lv_draw_task_get_line_dsc(draw_task);
+    if(line_dsc->base.part != LV_PART_ITEMS) return;
+
+    envelope_line_cnt++;
+    int32_t top = (int32_t)LV_MIN(line_dsc->p1.y, line_dsc->p2.y);
+    if(top < envelope_top) {
+        envelope_top = top;
+        envelope_top_x = (int32_t)line_dsc->p1.x;
+    }
+    envelope_bottom = LV_MAX(envelope_bottom, (int32_t)LV_MAX(line_dsc->p1.y, line_dsc->p2.y));
+    if(LV_MAX(line_dsc->p1.x, line_dsc->p2.x) > envelope_gap_x1 &&
+       LV_MIN(line_dsc->p1.x, line_dsc->p2.x) < envelope_gap_x2) {
+        envelope_gap_cnt++;
+    }
+}
+
+static void envelope_redraw(void)
+{
+    envelope_line_cnt = 0;
+    envelope_top = INT32_MAX;
+    envelope_bottom = INT32_MIN;
+    envelope_gap_cnt = 0;
+    lv_obj_invalidate(chart);
+    lv_refr_now(NULL);
+}
+
+void test_chart_decimate_draws_one_line_per_column(void)
+{
+    lv_obj_set_size(chart, 300, 200);
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(chart, envelope_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+    lv_chart_set_point_count(chart, 5000);
+
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    TEST_ASSERT_FALSE(lv_chart_get_series_decimate(chart, ser));
+    lv_chart_set_series_decimate(chart, ser, true);
+    TEST_ASSERT_TRUE(lv_chart_get_series_decimate(chart, ser));
+
+    for(uint32_t i = 0; i < 7500; i++) {
+        lv_chart_set_next_value(chart, ser, (int32_t)(i % 100));
+    }
+    envelope_redraw();
+
+    int32_t content_w = lv_obj_get_content_width(chart);
+    TEST_ASSERT_GREATER_THAN(0, envelope_line_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(content_w + 1, envelope_line_cnt);
+}
+
+void test_chart_decimate_keeps_peaks_until_shifted_out(void)
+{
+    lv_obj_set_size(chart, 300, 200);
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(chart, envelope_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_point_count(chart, 5000);
+
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_set_series_decimate(chart, ser, true);
+    lv_chart_set_all_values(chart, ser, 10);
+    envelope_redraw();
+    int32_t flat_top = envelope_top;
+
+    /*A single peak among 5000 points is still drawn*/
+    lv_chart_set_next_value(chart, ser, 90);
+    envelope_redraw();
+    TEST_ASSERT_LESS_THAN(flat_top, envelope_top);
+
+    /*It is still drawn after the envelope is rebuilt*/
+    lv_chart_refresh(chart);
+    envelope_redraw();
+    TEST_ASSERT_LESS_THAN(flat_top, envelope_top);
+
+    /*Shifted out: only the flat line remains*/
+    for(uint32_t i = 0; i < 5000; i++) {
+        lv_chart_set_next_value(chart, ser, 10);
+    }
+    envelope_redraw();
+    TEST_ASSERT_EQUAL_INT32(flat_top, envelope_top);
+
+    /*Turning decimation off draws the same line*/
+    lv_chart_set_series_decimate(chart, ser, false);
+    envelope_redraw();
+    TEST_ASSERT_EQUAL_INT32(flat_top, envelope_top);
+}
+
+void test_chart_decimate_circular_peak_is_drawn_where_it_was_written(void)
+{
+    lv_obj_set_size(chart, 300, 200);
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(chart, envelope_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_chart_set_point_count(chart, 5000);
+    envelope_gap_x1 = INT32_MAX;
+    envelope_gap_x2 = INT32_MIN;
+
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_set_series_decimate(chart, ser, true);
+    lv_chart_set_all_values(chart, ser, 10);
+    envelope_redraw();
+    int32_t flat_top = envelope_top;
+
+    for(uint32_t i = 0; i < 2500; i++) {
+        lv_chart_set_next_value(chart, ser, 10);
+    }
+    lv_chart_set_next_value(chart, ser, 90);
+    envelope_redraw();
+    TEST_ASSERT_LESS_THAN(flat_top, envelope_top);
+
+    /*The peak is in the middle; the seam at the write position may move it by a column or two*/
+    lv_obj_update_layout(chart);
+    int32_t x_ofs = chart->coords.x1 + lv_obj_get_style_pad_left(chart, LV_PART_MAIN) +
+                    lv_obj_get_style_border_width(chart, LV_PART_MAIN);
+    int32_t peak_x = x_ofs + (lv_obj_get_content_width(chart) * 2500) / 4999;
+    TEST_ASSERT_INT32_WITHIN(3, peak_x, envelope_top_x);
+
+    /*Overwritten after a full round*/
+    for(uint32_t i = 0; i < 5000; i++) {
+        lv_chart_set_next_value(chart, ser, 10);
+    }
+    envelope_redraw();
+    TEST_ASSERT_EQUAL_INT32(flat_top, envelope_top);
+}
+
+void test_chart_decimate_skips_none_points(void)
+{
+    lv_obj_set_size(chart, 300, 200);
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(chart, envelope_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_point_count(chart, 5000);
+
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_set_series_decimate(chart, ser, true);
+    for(uint32_t i = 0; i < 5000; i++) {
+        lv_chart_set_next_value(chart, ser, (i >= 2000 && i < 3000) ? LV_CHART_POINT_NONE : 50);
+    }
+
+    lv_obj_update_layout(chart);
+    int32_t x_ofs = chart->coords.x1 + lv_obj_get_style_pad_left(chart, LV_PART_MAIN) +
+                    lv_obj_get_style_border_width(chart, LV_PART_MAIN);
+    int32_t w = lv_obj_get_content_width(chart);
+    envelope_gap_x1 = x_ofs + (w * 2000) / 4999 + 2;
+    envelope_gap_x2 = x_ofs + (w * 2999) / 4999 - 2;
+    envelope_redraw();
+
+    /*Lines on both sides of the gap, nothing inside it and no drop to the bottom at its edges
+     *(a flat block is drawn 1 px tall)*/
+    TEST_ASSERT_GREATER_THAN(0, envelope_line_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, envelope_gap_cnt);
+    TEST_ASSERT_INT32_WITHIN(1, envelope_top, envelope_bottom);
+
+    /*The same after the envelope is rebuilt*/
+    lv_chart_refresh(chart);
+    envelope_redraw();
+    TEST_ASSERT_EQUAL_UINT32(0, envelope_gap_cnt);
+    TEST_ASSERT_INT32_WITHIN(1, envelope_top, envelope_bottom);
+}
+
 void test_chart_properties(void)
 {
 #if LV_USE_OBJ_PROPERTY
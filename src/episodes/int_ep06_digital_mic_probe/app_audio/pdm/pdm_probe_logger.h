@@ -1,8 +0,0 @@
-#ifndef PDM_PROBE_LOGGER_H
-#define PDM_PROBE_LOGGER_H
-
-#include "cy_result.h"
-
-cy_rslt_t pdm_probe_logger_start(void);
-
-#endif /* PDM_PROBE_LOGGER_H */
\ No newline at end of file
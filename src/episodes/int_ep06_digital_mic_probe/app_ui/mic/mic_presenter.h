@@ -23,11 +23,18 @@ typedef struct
     uint32_t left_ui_pct;
     uint32_t right_ui_pct;
     int32_t balance_lr;
+    uint32_t left_rms_abs;
+    uint32_t right_rms_abs;
 } mic_presenter_sample_t;
 
+/* start() runs on the LVGL thread before the producer; publish_sample() is
+ * the single producer and never blocks (see spsc_channel.h). */
 cy_rslt_t mic_presenter_start(void);
 void mic_presenter_publish_sample(const mic_presenter_sample_t *sample);
 
+/* Frames the history ring had to drop because the UI read too slowly */
+uint32_t mic_presenter_get_dropped_frames(void);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -2,38 +2,78 @@
 
 #include <stdbool.h>
 
-#include "FreeRTOS.h"
-#include "task.h"
-
 #include "lvgl.h"
 
 #include "mic_view.h"
+#include "spsc_channel.h"
 
 #define MIC_UI_TIMER_PERIOD_MS    (50U)
 
+/* Windows kept between two UI reads: the PDM logger publishes one window per
+ * 100 ms (10 frames of 10 ms), the UI reads every 50 ms, so 32 slots ride out
+ * a UI thread stalled for about 3 s. Power of two. */
+#define MIC_HISTORY_DEPTH         (32U)
+
 static lv_timer_t *s_ui_timer = NULL;
 static bool s_view_ready = false;
-static bool s_has_sample = false;
-static mic_presenter_sample_t s_latest_sample = {0};
 
-/* Run on LVGL thread cadence: copy latest sample and refresh view. */
-static void mic_presenter_ui_timer_cb(lv_timer_t *timer)
+/*
+ * Producer (PDM logger task/thread) -> LVGL thread, no critical sections:
+ * the latest channel always holds the newest window, the history ring keeps
+ * every window since the last UI read so short peaks are not lost between
+ * UI ticks. A full ring drops the new window (counted) instead of blocking.
+ */
+static spsc_latest_t s_latest;
+static uint32_t s_latest_words[SPSC_LATEST_WORDS(mic_presenter_sample_t)];
+static spsc_ring_t s_history;
+static mic_presenter_sample_t s_history_buf[MIC_HISTORY_DEPTH];
+static bool s_channel_ready = false;
+
+static void mic_presenter_channel_init(void)
 {
-    (void)timer;
+    if (s_channel_ready)
+    {
+        return;
+    }
 
-    mic_presenter_sample_t local = {0};
-    bool has_sample = false;
+    spsc_latest_init(&s_latest, s_latest_words, sizeof(mic_presenter_sample_t));
+    spsc_ring_init(&s_history, s_history_buf, MIC_HISTORY_DEPTH, sizeof(mic_presenter_sample_t));
+    s_channel_ready = true;
+}
 
-    /* Producer runs in another task, so protect shared sample snapshot. */
-    taskENTER_CRITICAL();
-    has_sample = s_has_sample;
-    if (has_sample)
+/* Consumer side: newest window with peaks held over all windows since last call. */
+static bool mic_presenter_collect(mic_presenter_sample_t *out_sample)
+{
+    if (!s_channel_ready || !spsc_latest_read(&s_latest, out_sample, NULL))
     {
-        local = s_latest_sample;
+        return false;
     }
-    taskEXIT_CRITICAL();
 
-    if (has_sample && s_view_ready)
+    mic_presenter_sample_t frame;
+    while (spsc_ring_pop(&s_history, &frame, 1U) > 0U)
+    {
+        if (frame.left_peak_abs > out_sample->left_peak_abs)
+        {
+            out_sample->left_peak_abs = frame.left_peak_abs;
+            out_sample->left_peak_tenth_pct_fs = frame.left_peak_tenth_pct_fs;
+        }
+        if (frame.right_peak_abs > out_sample->right_peak_abs)
+        {
+            out_sample->right_peak_abs = frame.right_peak_abs;
+            out_sample->right_peak_tenth_pct_fs = frame.right_peak_tenth_pct_fs;
+        }
+    }
+
+    return true;
+}
+
+/* Run on LVGL thread cadence: collect latest sample and refresh view. */
+static void mic_presenter_ui_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+
+    mic_presenter_sample_t local;
+    if (mic_presenter_collect(&local) && s_view_ready)
     {
         mic_view_apply(&local);
     }
@@ -46,6 +86,8 @@ cy_rslt_t mic_presenter_start(void)
         return CY_RSLT_SUCCESS;
     }
 
+    mic_presenter_channel_init();
+
     cy_rslt_t rslt = mic_view_create();
     if (CY_RSLT_SUCCESS != rslt)
     {
@@ -62,19 +104,23 @@ cy_rslt_t mic_presenter_start(void)
     return CY_RSLT_SUCCESS;
 }
 
+void mic_presenter_init_channel(void)
+{
+    mic_presenter_channel_init();
+}
+
 void mic_presenter_publish_sample(const mic_presenter_sample_t *sample)
 {
-    if (NULL == sample)
+    if ((NULL == sample) || !s_channel_ready)
     {
         return;
     }
 
-    /* Latest-sample wins policy to keep UI responsive and non-blocking. */
-    taskENTER_CRITICAL();
-    s_latest_sample = *sample;
-    s_has_sample = true;
-    taskEXIT_CRITICAL();
+    /* Latest-sample wins for the display; history keeps the peaks. */
+    spsc_latest_publish(&s_latest, sample);
+    (void)spsc_ring_push(&s_history, sample);
 }
+
 bool mic_presenter_get_latest_sample(mic_presenter_sample_t *out_sample)
 {
     if (out_sample == NULL)
@@ -82,15 +128,10 @@ bool mic_presenter_get_latest_sample(mic_presenter_sample_t *out_sample)
         return false;
     }
 
-    bool has_sample = false;
-
-    taskENTER_CRITICAL();
-    has_sample = s_has_sample;
-    if (has_sample)
-    {
-        *out_sample = s_latest_sample;
-    }
-    taskEXIT_CRITICAL();
+    return mic_presenter_collect(out_sample);
+}
 
-    return has_sample;
+uint32_t mic_presenter_get_dropped_frames(void)
+{
+    return s_channel_ready ? spsc_ring_dropped(&s_history) : 0U;
 }
@@ -24,12 +24,27 @@ typedef struct
     uint32_t left_ui_pct;
     uint32_t right_ui_pct;
     int32_t balance_lr;
+    uint32_t left_rms_abs;
+    uint32_t right_rms_abs;
 } mic_presenter_sample_t;
 
+/*
+ * Threading: publish_sample() is the single producer and may run on its own
+ * task/thread; start(), get_latest_sample() and get_dropped_frames() belong
+ * to the LVGL thread. The channel is lock-free (spsc_channel.h), so neither
+ * side ever waits for the other. init_channel() must run before the producer
+ * starts; start() calls it too.
+ */
 cy_rslt_t mic_presenter_start(void);
+void mic_presenter_init_channel(void);
 void mic_presenter_publish_sample(const mic_presenter_sample_t *sample);
+
+/* Newest frame, with peak fields held over every frame since the last call */
 bool mic_presenter_get_latest_sample(mic_presenter_sample_t *out_sample);
 
+/* Frames the history ring had to drop because the UI read too slowly */
+uint32_t mic_presenter_get_dropped_frames(void);
+
 #if defined(__cplusplus)
 }
 #endif
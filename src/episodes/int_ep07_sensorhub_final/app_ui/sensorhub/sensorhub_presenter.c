@@ -15,6 +15,7 @@
 #include "sensorhub_view.h"
 #include "sht4x_config.h"
 #include "sht4x_reader.h"
+#include "spsc_channel.h"
 
 #define HUB_UI_POLL_MS                (100U)
 #define HUB_STATUS_LOG_INTERVAL       (20U)
@@ -40,6 +41,20 @@ typedef struct
     uint32_t bmm_cal_last_sample_pct;
     uint32_t bmm_cal_last_coverage_pct;
 
+    /* Producer -> UI handoff, one latest-value channel per sensor */
+    spsc_latest_t dps_ch;
+    spsc_latest_t sht_ch;
+    spsc_latest_t bmi_ch;
+    spsc_latest_t bmm_ch;
+    uint32_t dps_words[SPSC_LATEST_WORDS(dps368_sample_t)];
+    uint32_t sht_words[SPSC_LATEST_WORDS(sht4x_sample_t)];
+    uint32_t bmi_words[SPSC_LATEST_WORDS(bmi270_sample_t)];
+    uint32_t bmm_words[SPSC_LATEST_WORDS(bmm350_sample_t)];
+    uint32_t dps_version;
+    uint32_t sht_version;
+    uint32_t bmi_version;
+    uint32_t bmm_version;
+
     dps368_sample_t dps_sample;
     sht4x_sample_t sht_sample;
     bmi270_sample_t bmi_sample;
@@ -157,8 +172,17 @@ static void sensorhub_on_tab(sensorhub_page_t page, void *user_data)
     printf("[EP07][HUB] PAGE -> %s\r\n", page_to_text(page));
 }
 
-/* Poll DPS368 on its own sampling period and push value to Env page. */
-static void sensorhub_poll_dps(uint32_t now_ms)
+/*
+ * Each sensor is split into a producer half (sensorhub_sample_*: read the
+ * driver on its own period, publish to the sensor's channel) and a consumer
+ * half (sensorhub_apply_*: take the newest sample once per UI tick and update
+ * the view). The halves share nothing but the lock-free channel, so the
+ * producers can move to their own task/thread without touching the UI code.
+ * On the simulator they still run from the UI poll timer.
+ */
+
+/* Producer: DPS368 on its own sampling period. */
+static void sensorhub_sample_dps(uint32_t now_ms)
 {
     if ((!s_ctx.dps_ready) || ((int32_t)(now_ms - s_ctx.next_dps_ms) < 0))
     {
@@ -170,18 +194,8 @@ static void sensorhub_poll_dps(uint32_t now_ms)
     dps368_sample_t sample;
     if (dps368_reader_poll(&sample))
     {
-        s_ctx.dps_sample = sample;
-        s_ctx.has_dps = true;
         s_ctx.dps_last_error = CY_RSLT_SUCCESS;
-        sensorhub_view_update_env(&s_ctx.dps_sample, s_ctx.has_sht ? &s_ctx.sht_sample : NULL);
-
-        if ((sample.sample_count % HUB_STATUS_LOG_INTERVAL) == 0U)
-        {
-            printf("[EP07][DPS368] p=%.1f hPa t=%.1f C\r\n",
-                   (double)sample.pressure_hpa,
-                   (double)sample.temperature_c);
-        }
-
+        spsc_latest_publish(&s_ctx.dps_ch, &sample);
         return;
     }
 
@@ -193,8 +207,8 @@ static void sensorhub_poll_dps(uint32_t now_ms)
     }
 }
 
-/* Poll SHT4x on its own sampling period and push value to Env page. */
-static void sensorhub_poll_sht(uint32_t now_ms)
+/* Producer: SHT4x on its own sampling period. */
+static void sensorhub_sample_sht(uint32_t now_ms)
 {
     if ((!s_ctx.sht_ready) || ((int32_t)(now_ms - s_ctx.next_sht_ms) < 0))
     {
@@ -206,18 +220,8 @@ static void sensorhub_poll_sht(uint32_t now_ms)
     sht4x_sample_t sample;
     if (sht4x_reader_poll(&sample))
     {
-        s_ctx.sht_sample = sample;
-        s_ctx.has_sht = true;
         s_ctx.sht_last_error = CY_RSLT_SUCCESS;
-        sensorhub_view_update_env(s_ctx.has_dps ? &s_ctx.dps_sample : NULL, &s_ctx.sht_sample);
-
-        if ((sample.sample_count % HUB_STATUS_LOG_INTERVAL) == 0U)
-        {
-            printf("[EP07][SHT4X] t=%.1f C rh=%.1f%%\r\n",
-                   (double)sample.temperature_c,
-                   (double)sample.humidity_rh);
-        }
-
+        spsc_latest_publish(&s_ctx.sht_ch, &sample);
         return;
     }
 
@@ -229,8 +233,8 @@ static void sensorhub_poll_sht(uint32_t now_ms)
     }
 }
 
-/* Poll BMI270 and push motion data to Motion page widgets. */
-static void sensorhub_poll_bmi(uint32_t now_ms)
+/* Producer: BMI270 on its own sampling period. */
+static void sensorhub_sample_bmi(uint32_t now_ms)
 {
     if ((!s_ctx.bmi_ready) || ((int32_t)(now_ms - s_ctx.next_bmi_ms) < 0))
     {
@@ -242,18 +246,8 @@ static void sensorhub_poll_bmi(uint32_t now_ms)
     bmi270_sample_t sample;
     if (bmi270_reader_poll(&sample))
     {
-        s_ctx.bmi_sample = sample;
-        s_ctx.has_bmi = true;
         s_ctx.bmi_last_error = CY_RSLT_SUCCESS;
-        sensorhub_view_update_motion(&s_ctx.bmi_sample);
-
-        if ((sample.sample_count % HUB_STATUS_LOG_INTERVAL) == 0U)
-        {
-            printf("[EP07][BMI270] acc=%.2f g gyr=%.1f dps\r\n",
-                   (double)sample.acc_mag_g,
-                   (double)sample.gyr_mag_dps);
-        }
-
+        spsc_latest_publish(&s_ctx.bmi_ch, &sample);
         return;
     }
 
@@ -265,8 +259,8 @@ static void sensorhub_poll_bmi(uint32_t now_ms)
     }
 }
 
-/* Poll BMM350 and push heading + axis values to Compass page. */
-static void sensorhub_poll_bmm(uint32_t now_ms)
+/* Producer: BMM350 on its own sampling period. */
+static void sensorhub_sample_bmm(uint32_t now_ms)
 {
     if ((!s_ctx.bmm_ready) || ((int32_t)(now_ms - s_ctx.next_bmm_ms) < 0))
     {
@@ -278,18 +272,8 @@ static void sensorhub_poll_bmm(uint32_t now_ms)
     bmm350_sample_t sample;
     if (bmm350_reader_poll(&sample))
     {
-        s_ctx.bmm_sample = sample;
-        s_ctx.has_bmm = true;
         s_ctx.bmm_last_error = CY_RSLT_SUCCESS;
-        sensorhub_view_update_compass(&s_ctx.bmm_sample);
-
-        if ((sample.sample_count % HUB_STATUS_LOG_INTERVAL) == 0U)
-        {
-            printf("[EP07][BMM350] heading=%.1f field=%.1f\r\n",
-                   (double)sample.heading_deg,
-                   (double)sample.field_strength_ut);
-        }
-
+        spsc_latest_publish(&s_ctx.bmm_ch, &sample);
         return;
     }
 
@@ -301,6 +285,92 @@ static void sensorhub_poll_bmm(uint32_t now_ms)
     }
 }
 
+/* Consumer: read a channel, true only if it holds a sample not applied yet. */
+static bool sensorhub_take(spsc_latest_t *ch, void *out, uint32_t *applied_version)
+{
+    uint32_t version = 0U;
+    if (!spsc_latest_read(ch, out, &version) || (version == *applied_version))
+    {
+        return false;
+    }
+
+    *applied_version = version;
+    return true;
+}
+
+/* Consumer: newest DPS368 / SHT4x samples to the Env page. */
+static void sensorhub_apply_env(void)
+{
+    bool dps_new = sensorhub_take(&s_ctx.dps_ch, &s_ctx.dps_sample, &s_ctx.dps_version);
+    bool sht_new = sensorhub_take(&s_ctx.sht_ch, &s_ctx.sht_sample, &s_ctx.sht_version);
+
+    if (dps_new)
+    {
+        s_ctx.has_dps = true;
+        if ((s_ctx.dps_sample.sample_count % HUB_STATUS_LOG_INTERVAL) == 0U)
+        {
+            printf("[EP07][DPS368] p=%.1f hPa t=%.1f C\r\n",
+                   (double)s_ctx.dps_sample.pressure_hpa,
+                   (double)s_ctx.dps_sample.temperature_c);
+        }
+    }
+
+    if (sht_new)
+    {
+        s_ctx.has_sht = true;
+        if ((s_ctx.sht_sample.sample_count % HUB_STATUS_LOG_INTERVAL) == 0U)
+        {
+            printf("[EP07][SHT4X] t=%.1f C rh=%.1f%%\r\n",
+                   (double)s_ctx.sht_sample.temperature_c,
+                   (double)s_ctx.sht_sample.humidity_rh);
+        }
+    }
+
+    if (dps_new || sht_new)
+    {
+        sensorhub_view_update_env(s_ctx.has_dps ? &s_ctx.dps_sample : NULL,
+                                  s_ctx.has_sht ? &s_ctx.sht_sample : NULL);
+    }
+}
+
+/* Consumer: newest BMI270 sample to the Motion page. */
+static void sensorhub_apply_bmi(void)
+{
+    if (!sensorhub_take(&s_ctx.bmi_ch, &s_ctx.bmi_sample, &s_ctx.bmi_version))
+    {
+        return;
+    }
+
+    s_ctx.has_bmi = true;
+    sensorhub_view_update_motion(&s_ctx.bmi_sample);
+
+    if ((s_ctx.bmi_sample.sample_count % HUB_STATUS_LOG_INTERVAL) == 0U)
+    {
+        printf("[EP07][BMI270] acc=%.2f g gyr=%.1f dps\r\n",
+               (double)s_ctx.bmi_sample.acc_mag_g,
+               (double)s_ctx.bmi_sample.gyr_mag_dps);
+    }
+}
+
+/* Consumer: newest BMM350 sample to the Compass page. */
+static void sensorhub_apply_bmm(void)
+{
+    if (!sensorhub_take(&s_ctx.bmm_ch, &s_ctx.bmm_sample, &s_ctx.bmm_version))
+    {
+        return;
+    }
+
+    s_ctx.has_bmm = true;
+    sensorhub_view_update_compass(&s_ctx.bmm_sample);
+
+    if ((s_ctx.bmm_sample.sample_count % HUB_STATUS_LOG_INTERVAL) == 0U)
+    {
+        printf("[EP07][BMM350] heading=%.1f field=%.1f\r\n",
+               (double)s_ctx.bmm_sample.heading_deg,
+               (double)s_ctx.bmm_sample.field_strength_ut);
+    }
+}
+
 /* Track calibration progress and print only when progress buckets change. */
 static void sensorhub_poll_bmm_calibration(void)
 {
@@ -353,7 +423,7 @@ static void sensorhub_poll_bmm_calibration(void)
     s_ctx.bmm_cal_last_coverage_pct = cal.coverage_progress_pct;
 }
 
-/* Audio samples are produced by PDM logger task; latest-sample wins. */
+/* Audio samples are produced by PDM logger task; latest frame with held peaks. */
 static void sensorhub_poll_mic(void)
 {
     mic_presenter_sample_t sample;
@@ -380,10 +450,14 @@ static void sensorhub_poll_timer_cb(lv_timer_t *timer)
 
     uint32_t now_ms = lv_tick_get();
 
-    sensorhub_poll_dps(now_ms);
-    sensorhub_poll_sht(now_ms);
-    sensorhub_poll_bmi(now_ms);
-    sensorhub_poll_bmm(now_ms);
+    sensorhub_sample_dps(now_ms);
+    sensorhub_sample_sht(now_ms);
+    sensorhub_sample_bmi(now_ms);
+    sensorhub_sample_bmm(now_ms);
+
+    sensorhub_apply_env();
+    sensorhub_apply_bmi();
+    sensorhub_apply_bmm();
     sensorhub_poll_bmm_calibration();
     sensorhub_poll_mic();
 
@@ -423,6 +497,12 @@ cy_rslt_t sensorhub_presenter_start(mtb_hal_i2c_t *sensor_i2c,
         return CY_RSLT_SUCCESS;
     }
 
+    spsc_latest_init(&s_ctx.dps_ch, s_ctx.dps_words, sizeof(dps368_sample_t));
+    spsc_latest_init(&s_ctx.sht_ch, s_ctx.sht_words, sizeof(sht4x_sample_t));
+    spsc_latest_init(&s_ctx.bmi_ch, s_ctx.bmi_words, sizeof(bmi270_sample_t));
+    spsc_latest_init(&s_ctx.bmm_ch, s_ctx.bmm_words, sizeof(bmm350_sample_t));
+    mic_presenter_init_channel();
+
     sensorhub_view_create();
     sensorhub_view_bind_tab_handler(sensorhub_on_tab, NULL);
     sensorhub_view_bind_compass_cal_handler(sensorhub_on_compass_calibrate, NULL);
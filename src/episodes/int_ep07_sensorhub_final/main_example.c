@@ -24,7 +24,7 @@
 #include "sensor_bus.h"
 
 #include "sensorhub/sensorhub_presenter.h"
-#include "pdm/pdm_probe_logger.h"
+#include "pdm_probe_logger.h"
 
 void example_main(lv_obj_t *parent)
 {
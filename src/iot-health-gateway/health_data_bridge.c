@@ -0,0 +1,463 @@
+/*******************************************************************************
+ * File Name        : health_data_bridge.c
+ *
+ * Description      : Simulated BLE ingest, see health_data_bridge.h.
+ *
+ *                    producer thread   steps every device once per ms and
+ *                                      pushes due readings into s_queue
+ *                                      (spsc_channel.h, never blocks).
+ *                    LVGL thread       apply_batch() pops up to
+ *                                      HDB_APPLY_BATCH_MAX readings into
+ *                                      hdp_ingest() and refreshes the UI,
+ *                                      then waits a frame if more are queued.
+ *
+ *                    s_apply_armed makes sure at most one apply is pending:
+ *                    whoever sets it schedules one, apply_batch() clears it
+ *                    only once the queue is empty.
+ *
+ *******************************************************************************/
+
+#include "health_data_bridge.h"
+
+#include "health_data_provider.h"
+#include "spsc_channel.h"
+#include "ui/health/health_ui_root.h"
+
+#include "lvgl.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define HDB_SEC_PER_HOUR        (3600U)
+#define HDB_BACKLOG_SPACING_SEC (6U * HDB_SEC_PER_HOUR)
+#define HDB_PRODUCER_TICK_MS    (1U)
+#define HDB_STATS_LOG_MS        (2000U)
+
+typedef struct {
+    hdp_measurement_t meas;
+    uint64_t          enqueue_ns;
+} hdb_queue_item_t;
+
+/* Producer thread only */
+typedef struct {
+    hdp_measurement_type_t type;
+    uint8_t          member_index;
+    uint8_t          addr[6];
+    char             name[32];
+    uint32_t         rng;
+    uint32_t         backlog_left;
+    uint32_t         backlog_base_sec;  /* timestamp of the oldest stored reading */
+    uint32_t         next_due_ms;
+    bool             holding;           /* reading waits for queue space */
+    bool             stalled;
+    uint32_t         held_since_ms;
+    hdb_queue_item_t pending;
+} sim_device_t;
+
+static bool s_started = false;
+static pthread_t s_producer_thread;
+static sim_device_t s_devices[HDB_SIM_DEVICE_COUNT];
+
+static spsc_ring_t s_queue;
+static hdb_queue_item_t s_queue_buf[HDB_QUEUE_DEPTH];
+
+static uint32_t s_apply_armed = 0U;
+static uint32_t s_reboot_requested = 0U;
+static uint32_t s_backlog_outstanding = 0U;     /* readings still to sync */
+static uint64_t s_burst_start_ns = 0U;
+static uint32_t s_burst_active = 0U;
+
+/* LVGL thread only */
+static lv_timer_t *s_frame_timer = NULL;
+static uint32_t s_last_apply_tick = 0U;
+static uint64_t s_latency_sum_ms = 0U;
+static uint64_t s_last_log_ns = 0U;
+
+/* Written by one thread each, read by anyone */
+static health_data_bridge_stats_t s_stats;
+
+#define STAT_ADD(field, n)   __atomic_fetch_add(&s_stats.field, (n), __ATOMIC_RELAXED)
+#define STAT_GET(field)      __atomic_load_n(&s_stats.field, __ATOMIC_RELAXED)
+#define STAT_MAX(field, v)                                                  \
+    do {                                                                    \
+        if ((v) > STAT_GET(field)) {                                        \
+            __atomic_store_n(&s_stats.field, (v), __ATOMIC_RELAXED);        \
+        }                                                                   \
+    } while (0)
+
+/*******************************************************************************
+ * Time
+ *******************************************************************************/
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t now_ms(void) {
+    return (uint32_t)(now_ns() / 1000000ULL);
+}
+
+static void sleep_ms(uint32_t ms) {
+    struct timespec ts;
+    ts.tv_sec  = (time_t)(ms / 1000U);
+    ts.tv_nsec = (long)(ms % 1000U) * 1000000L;
+    nanosleep(&ts, NULL);
+}
+
+/*******************************************************************************
+ * Device model (producer thread)
+ *******************************************************************************/
+static uint32_t rng_next(uint32_t *state) {
+    /* xorshift32 */
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static int32_t rng_range(uint32_t *state, int32_t lo, int32_t hi) {
+    return lo + (int32_t)(rng_next(state) % (uint32_t)(hi - lo + 1));
+}
+
+static void make_reading(sim_device_t *dev, hdp_measurement_t *meas) {
+    uint32_t *rng = &dev->rng;
+
+    memset(meas, 0, sizeof(*meas));
+    meas->type = dev->type;
+    meas->member_index = dev->member_index;
+    meas->device_type = (uint8_t)dev->type;
+    memcpy(meas->addr, dev->addr, sizeof(meas->addr));
+    memcpy(meas->device_name, dev->name, sizeof(meas->device_name));
+
+    if (dev->backlog_left > 0U) {
+        meas->timestamp_sec = dev->backlog_base_sec +
+            (HDB_SIM_BACKLOG_READINGS - dev->backlog_left) * HDB_BACKLOG_SPACING_SEC;
+    }
+    else {
+        meas->timestamp_sec = (uint32_t)time(NULL);
+    }
+
+    switch (dev->type) {
+    case HDP_MEAS_BLOOD_PRESSURE:
+        meas->raw_value = hdp_pack_bp((uint16_t)rng_range(rng, 105, 145),
+                                      (uint16_t)rng_range(rng, 65, 92),
+                                      (uint16_t)rng_range(rng, 58, 95));
+        break;
+    case HDP_MEAS_SPO2_HR:
+        meas->raw_value = hdp_pack_spo2_hr((uint16_t)rng_range(rng, 94, 99),
+                                           (uint16_t)rng_range(rng, 60, 100));
+        break;
+    case HDP_MEAS_TEMPERATURE:
+        meas->raw_value = rng_range(rng, 362, 375);     /* x10 degC */
+        break;
+    default:
+        meas->raw_value = rng_range(rng, 80, 160);      /* mg/dL */
+        break;
+    }
+}
+
+static void reset_devices(uint32_t now) {
+    static const hdp_measurement_type_t types[] = {
+        HDP_MEAS_BLOOD_PRESSURE, HDP_MEAS_SPO2_HR,
+        HDP_MEAS_TEMPERATURE, HDP_MEAS_GLUCOSE
+    };
+    static const char *const prefixes[] = { "BP", "OXI", "THERM", "GLU" };
+    uint32_t boot_sec = (uint32_t)time(NULL);
+    uint32_t i;
+
+    for (i = 0U; i < HDB_SIM_DEVICE_COUNT; i++) {
+        sim_device_t *dev = &s_devices[i];
+        uint32_t kind = i % (sizeof(types) / sizeof(types[0]));
+
+        memset(dev, 0, sizeof(*dev));
+        dev->type = types[kind];
+        dev->member_index = (uint8_t)((i / 4U) % HDP_MAX_MEMBERS);
+        dev->addr[0] = 0xC0U;
+        dev->addr[1] = 0xDEU;
+        dev->addr[4] = (uint8_t)(i >> 8);
+        dev->addr[5] = (uint8_t)i;
+        (void)snprintf(dev->name, sizeof(dev->name), "%s-%02u", prefixes[kind],
+                       (unsigned)(i + 1U));
+        dev->rng = 0x9E3779B9U ^ (i * 2654435761U) ^ now;
+        if (0U == dev->rng) {
+            dev->rng = 1U;
+        }
+        dev->backlog_left = HDB_SIM_BACKLOG_READINGS;
+        dev->backlog_base_sec = boot_sec - HDB_SIM_BACKLOG_READINGS * HDB_BACKLOG_SPACING_SEC
+                                + (rng_next(&dev->rng) % HDB_SEC_PER_HOUR);
+        dev->next_due_ms = now + rng_next(&dev->rng) % (HDB_SIM_RECONNECT_SPREAD_MS + 1U);
+    }
+
+    __atomic_store_n(&s_backlog_outstanding, HDB_SIM_DEVICE_COUNT * HDB_SIM_BACKLOG_READINGS,
+                     __ATOMIC_RELAXED);
+    __atomic_store_n(&s_burst_start_ns, now_ns(), __ATOMIC_RELAXED);
+    __atomic_store_n(&s_burst_active, 1U, __ATOMIC_RELEASE);
+}
+
+static void schedule_next(sim_device_t *dev, uint32_t now) {
+    if (dev->backlog_left > 0U) {
+        dev->backlog_left--;
+        (void)__atomic_fetch_sub(&s_backlog_outstanding, 1U, __ATOMIC_RELAXED);
+    }
+    if (dev->backlog_left > 0U) {
+        dev->next_due_ms = now + HDB_SIM_CONN_INTERVAL_MS;
+    }
+    else {
+        dev->next_due_ms = now + HDB_SIM_LIVE_PERIOD_MS / 2U +
+                           rng_next(&dev->rng) % (HDB_SIM_LIVE_PERIOD_MS + 1U);
+    }
+}
+
+/*******************************************************************************
+ * Hand-off to the LVGL thread
+ *******************************************************************************/
+static void apply_batch(void *user_data);
+
+#if LV_USE_OS != LV_OS_NONE
+/* Producer side: lv_lock() makes lv_async_call() safe from this thread and
+ * wakes the event-driven main loop through the timer resume callback. */
+static void arm_apply(void) {
+    if (0U == __atomic_exchange_n(&s_apply_armed, 1U, __ATOMIC_ACQ_REL)) {
+        lv_lock();
+        (void)lv_async_call(apply_batch, NULL);
+        lv_unlock();
+    }
+}
+#else
+/* Without an OS layer LVGL may not be touched from the producer: a frame
+ * timer on the LVGL thread notices queued readings instead. */
+static void arm_apply(void) {}
+
+static void poll_queue_cb(lv_timer_t *timer) {
+    (void)timer;
+    if ((spsc_ring_count(&s_queue) > 0U) &&
+        (0U == __atomic_exchange_n(&s_apply_armed, 1U, __ATOMIC_ACQ_REL))) {
+        (void)lv_async_call(apply_batch, NULL);
+    }
+}
+#endif
+
+static void device_step(sim_device_t *dev, uint32_t now) {
+    uint32_t depth;
+
+    if (!dev->holding) {
+        if ((int32_t)(now - dev->next_due_ms) < 0) {
+            return;
+        }
+        make_reading(dev, &dev->pending.meas);
+        dev->holding = true;
+        dev->stalled = false;
+        dev->held_since_ms = now;
+        STAT_ADD(produced, 1U);
+    }
+
+    dev->pending.enqueue_ns = now_ns();
+    if (spsc_ring_push(&s_queue, &dev->pending)) {
+        STAT_ADD(queued, 1U);
+        depth = spsc_ring_count(&s_queue);
+        STAT_MAX(queue_high_water, depth);
+        if (dev->stalled) {
+            STAT_ADD(stall_ms, now - dev->held_since_ms);
+        }
+        dev->holding = false;
+        schedule_next(dev, now);
+        arm_apply();
+        return;
+    }
+
+    /* Queue full: hold the reading, the device is flow-controlled. */
+    if (!dev->stalled) {
+        dev->stalled = true;
+        STAT_ADD(stalls, 1U);
+    }
+    if ((now - dev->held_since_ms) >= HDB_BACKPRESSURE_TIMEOUT_MS) {
+        STAT_ADD(stall_ms, now - dev->held_since_ms);
+        STAT_ADD(dropped, 1U);
+        dev->holding = false;
+        schedule_next(dev, now);
+    }
+}
+
+static void *producer_thread_main(void *arg) {
+    (void)arg;
+
+    reset_devices(now_ms());
+    while (1) {
+        uint32_t now = now_ms();
+        uint32_t i;
+
+        if (0U != __atomic_exchange_n(&s_reboot_requested, 0U, __ATOMIC_ACQ_REL)) {
+            reset_devices(now);
+        }
+        for (i = 0U; i < HDB_SIM_DEVICE_COUNT; i++) {
+            device_step(&s_devices[i], now);
+        }
+        sleep_ms(HDB_PRODUCER_TICK_MS);
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+ * Apply (LVGL thread)
+ *******************************************************************************/
+static void log_stats(const char *what) {
+    health_data_bridge_stats_t st;
+
+    health_data_bridge_get_stats(&st);
+    LV_LOG_USER("bridge %s: produced=%u queued=%u applied=%u rejected=%u dropped=%u "
+                "stalls=%u (%u ms) queue_hw=%u/%u batches=%u max_batch=%u "
+                "apply_max=%u us latency avg=%u max=%u ms",
+                what, (unsigned)st.produced, (unsigned)st.queued,
+                (unsigned)st.applied, (unsigned)st.rejected, (unsigned)st.dropped,
+                (unsigned)st.stalls, (unsigned)st.stall_ms,
+                (unsigned)st.queue_high_water, (unsigned)HDB_QUEUE_DEPTH,
+                (unsigned)st.batches, (unsigned)st.max_batch,
+                (unsigned)st.max_apply_us, (unsigned)st.avg_latency_ms,
+                (unsigned)st.max_latency_ms);
+}
+
+static void schedule_next_frame(void) {
+    lv_timer_reset(s_frame_timer);
+    lv_timer_resume(s_frame_timer);
+}
+
+static void frame_timer_cb(lv_timer_t *timer) {
+    lv_timer_pause(timer);
+    apply_batch(NULL);
+}
+
+static void apply_batch(void *user_data) {
+    static hdb_queue_item_t batch[HDB_APPLY_BATCH_MAX];
+    uint64_t t0;
+    uint32_t n, i;
+
+    (void)user_data;
+    /* At most one batch per frame: an early wake-up waits for the frame
+     * timer, which keeps the apply armed. */
+    if (lv_tick_elaps(s_last_apply_tick) < HDB_APPLY_PERIOD_MS) {
+        schedule_next_frame();
+        return;
+    }
+    s_last_apply_tick = lv_tick_get();
+
+    t0 = now_ns();
+    n = spsc_ring_pop(&s_queue, batch, HDB_APPLY_BATCH_MAX);
+    for (i = 0U; i < n; i++) {
+        uint32_t latency_ms = (uint32_t)((t0 - batch[i].enqueue_ns) / 1000000ULL);
+
+        if (hdp_ingest(&batch[i].meas)) {
+            STAT_ADD(applied, 1U);
+        }
+        else {
+            STAT_ADD(rejected, 1U);
+        }
+        STAT_MAX(max_latency_ms, latency_ms);
+        s_latency_sum_ms += latency_ms;
+    }
+
+    if (n > 0U) {
+        uint32_t apply_us;
+
+        /* One UI refresh for the whole batch. */
+        health_ui_root_poll();
+        apply_us = (uint32_t)((now_ns() - t0) / 1000U);
+
+        STAT_ADD(batches, 1U);
+        STAT_MAX(max_batch, n);
+        STAT_MAX(max_apply_us, apply_us);
+        __atomic_store_n(&s_stats.avg_latency_ms,
+                         (uint32_t)(s_latency_sum_ms / (STAT_GET(applied) + STAT_GET(rejected))),
+                         __ATOMIC_RELAXED);
+    }
+
+    if (spsc_ring_count(&s_queue) > 0U) {
+        /* More waiting: next batch next frame, stay armed. */
+        schedule_next_frame();
+    }
+    else {
+        __atomic_store_n(&s_apply_armed, 0U, __ATOMIC_RELEASE);
+        /* A push between the count and the store saw us armed and did not
+         * schedule; catch it here. */
+        if ((spsc_ring_count(&s_queue) > 0U) &&
+            (0U == __atomic_exchange_n(&s_apply_armed, 1U, __ATOMIC_ACQ_REL))) {
+            schedule_next_frame();
+        }
+        else if ((0U == __atomic_load_n(&s_backlog_outstanding, __ATOMIC_RELAXED)) &&
+                 (0U != __atomic_exchange_n(&s_burst_active, 0U, __ATOMIC_ACQ_REL))) {
+            uint64_t start = __atomic_load_n(&s_burst_start_ns, __ATOMIC_RELAXED);
+            char what[48];
+
+            (void)snprintf(what, sizeof(what), "burst drained in %u ms",
+                           (unsigned)((now_ns() - start) / 1000000ULL));
+            log_stats(what);
+            s_last_log_ns = t0;
+        }
+    }
+
+    if ((n > 0U) && ((t0 - s_last_log_ns) >= (uint64_t)HDB_STATS_LOG_MS * 1000000ULL)) {
+        log_stats("stats");
+        s_last_log_ns = t0;
+    }
+}
+
+/*******************************************************************************
+ * Public API
+ *******************************************************************************/
+void health_data_bridge_init(void) {
+    if (s_started) {
+        return;
+    }
+
+    memset(&s_stats, 0, sizeof(s_stats));
+    spsc_ring_init(&s_queue, s_queue_buf, HDB_QUEUE_DEPTH, sizeof(hdb_queue_item_t));
+    s_latency_sum_ms = 0U;
+    s_last_log_ns = now_ns();
+    s_last_apply_tick = lv_tick_get() - HDB_APPLY_PERIOD_MS;
+
+    s_frame_timer = lv_timer_create(frame_timer_cb, HDB_APPLY_PERIOD_MS, NULL);
+    lv_timer_pause(s_frame_timer);
+#if LV_USE_OS == LV_OS_NONE
+    (void)lv_timer_create(poll_queue_cb, HDB_APPLY_PERIOD_MS, NULL);
+#endif
+
+    if (pthread_create(&s_producer_thread, NULL, producer_thread_main, NULL) != 0) {
+        LV_LOG_WARN("bridge: producer thread not started");
+        return;
+    }
+    pthread_detach(s_producer_thread);
+
+    s_started = true;
+    LV_LOG_USER("bridge: %u devices x %u stored readings, queue=%u, batch=%u/frame",
+                (unsigned)HDB_SIM_DEVICE_COUNT, (unsigned)HDB_SIM_BACKLOG_READINGS,
+                (unsigned)HDB_QUEUE_DEPTH, (unsigned)HDB_APPLY_BATCH_MAX);
+}
+
+void health_data_bridge_simulate_reboot(void) {
+    __atomic_store_n(&s_reboot_requested, 1U, __ATOMIC_RELEASE);
+}
+
+void health_data_bridge_get_stats(health_data_bridge_stats_t *out) {
+    if (NULL == out) {
+        return;
+    }
+
+    out->produced         = STAT_GET(produced);
+    out->queued           = STAT_GET(queued);
+    out->stalls           = STAT_GET(stalls);
+    out->stall_ms         = STAT_GET(stall_ms);
+    out->dropped          = STAT_GET(dropped);
+    out->queue_high_water = STAT_GET(queue_high_water);
+    out->applied          = STAT_GET(applied);
+    out->rejected         = STAT_GET(rejected);
+    out->batches          = STAT_GET(batches);
+    out->max_batch        = STAT_GET(max_batch);
+    out->max_apply_us     = STAT_GET(max_apply_us);
+    out->max_latency_ms   = STAT_GET(max_latency_ms);
+    out->avg_latency_ms   = STAT_GET(avg_latency_ms);
+}
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * File Name        : health_data_bridge.h
+ *
+ * Description      : Simulated BLE ingest path for the Health UI (built with
+ *                    ENABLE_BLE_DATA_BRIDGE=1, CMake option
+ *                    HEALTH_BLE_BRIDGE_SIM).
+ *
+ *                    A producer thread plays HDB_SIM_DEVICE_COUNT devices
+ *                    reconnecting after a gateway reboot: each one syncs its
+ *                    stored readings back to back, then sends a live reading
+ *                    now and then. Readings cross to the LVGL thread through
+ *                    a bounded lock-free queue and are applied in batches of
+ *                    at most HDB_APPLY_BATCH_MAX, one batch per frame, by a
+ *                    callback scheduled with lv_async_call().
+ *
+ *                    Back-pressure: when the queue is full a device holds
+ *                    its reading and retries (BLE flow control). A reading
+ *                    held longer than HDB_BACKPRESSURE_TIMEOUT_MS is dropped
+ *                    (the link would time out on the board).
+ *
+ *******************************************************************************/
+
+#ifndef HEALTH_DATA_BRIDGE_H
+#define HEALTH_DATA_BRIDGE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+ * Configuration
+ *******************************************************************************/
+#ifndef HDB_SIM_DEVICE_COUNT
+#define HDB_SIM_DEVICE_COUNT        (50U)
+#endif
+
+/* Stored readings each device syncs after it reconnects. */
+#ifndef HDB_SIM_BACKLOG_READINGS
+#define HDB_SIM_BACKLOG_READINGS    (40U)
+#endif
+
+/* Devices reconnect at random within this window after the reboot. */
+#ifndef HDB_SIM_RECONNECT_SPREAD_MS
+#define HDB_SIM_RECONNECT_SPREAD_MS (3000U)
+#endif
+
+/* One reading per BLE connection interval while a device syncs. */
+#ifndef HDB_SIM_CONN_INTERVAL_MS
+#define HDB_SIM_CONN_INTERVAL_MS    (8U)
+#endif
+
+/* Live readings after the sync, per device (+/- 50 % jitter). */
+#ifndef HDB_SIM_LIVE_PERIOD_MS
+#define HDB_SIM_LIVE_PERIOD_MS      (10000U)
+#endif
+
+/* Queue slots, a power of two. */
+#ifndef HDB_QUEUE_DEPTH
+#define HDB_QUEUE_DEPTH             (256U)
+#endif
+
+/* Readings applied to the store per frame. */
+#ifndef HDB_APPLY_BATCH_MAX
+#define HDB_APPLY_BATCH_MAX         (64U)
+#endif
+
+#ifndef HDB_APPLY_PERIOD_MS
+#define HDB_APPLY_PERIOD_MS         (33U)
+#endif
+
+#ifndef HDB_BACKPRESSURE_TIMEOUT_MS
+#define HDB_BACKPRESSURE_TIMEOUT_MS (500U)
+#endif
+
+/*******************************************************************************
+ * Counters
+ *******************************************************************************/
+typedef struct {
+    /* producer thread */
+    uint32_t produced;          /* readings generated by the devices */
+    uint32_t queued;            /* readings that entered the queue */
+    uint32_t stalls;            /* readings that met a full queue at least once */
+    uint32_t stall_ms;          /* device-milliseconds spent held back */
+    uint32_t dropped;           /* readings given up after the timeout */
+    uint32_t queue_high_water;
+    /* LVGL thread */
+    uint32_t applied;           /* accepted by hdp_ingest() */
+    uint32_t rejected;          /* refused by hdp_ingest() (duplicate, ...) */
+    uint32_t batches;
+    uint32_t max_batch;
+    uint32_t max_apply_us;      /* longest batch apply incl. UI refresh */
+    uint32_t max_latency_ms;    /* queue entry to store, worst reading */
+    uint32_t avg_latency_ms;
+} health_data_bridge_stats_t;
+
+/** Start the producer thread and the per-frame apply. Call from the LVGL
+ *  thread after hdp_init(). */
+void health_data_bridge_init(void);
+
+/** Disconnect every device and replay the post-reboot burst. Any thread. */
+void health_data_bridge_simulate_reboot(void);
+
+/** Snapshot of the counters; callable from any thread. */
+void health_data_bridge_get_stats(health_data_bridge_stats_t *out);
+
+#endif /* HEALTH_DATA_BRIDGE_H */
@@ -0,0 +1,768 @@
+/*******************************************************************************
+ * File Name        : health_data_provider.c
+ *
+ * Description      : Measurement store behind health_data_provider.h.
+ *                    Each (member, type) pair owns a fixed ring of compact
+ *                    records kept in timestamp order, so the latest reading
+ *                    is the ring tail and range queries binary-search the
+ *                    start. A direct-mapped table of day buckets (slot =
+ *                    day % HDP_STORE_DAY_BUCKETS) is updated on ingest and
+ *                    serves the daily/weekly chart aggregates.
+ *                    With HDP_PERSIST_ENABLE, every stored reading is also
+ *                    appended to a nor_log stream and replayed at init.
+ *
+ *******************************************************************************/
+
+#include "health_data_provider.h"
+
+#include "lvgl.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Store layout
+ *******************************************************************************/
+#define HDP_TYPE_COUNT      (4U)
+#define HDP_SEC_PER_DAY     (86400U)
+#define HDP_NO_DEVICE       (0xFFU)
+#define HDP_CSV_LINE_SIZE   (160U)
+
+typedef struct {
+    uint32_t timestamp_sec;
+    int32_t  raw_value;
+} hdp_record_t;
+
+typedef struct {
+    uint32_t day_tag;                 /* day since epoch + 1; 0 = empty */
+    uint32_t count;
+    int16_t  min[HDP_AGG_CHANNELS];
+    int16_t  max[HDP_AGG_CHANNELS];
+    int32_t  sum[HDP_AGG_CHANNELS];
+} hdp_day_bucket_t;
+
+typedef struct {
+    hdp_record_t     records[HDP_STORE_RING_CAPACITY];
+    uint8_t          device_slot[HDP_STORE_RING_CAPACITY];
+    uint32_t         head;            /* physical index of the oldest record */
+    uint32_t         count;
+    hdp_day_bucket_t days[HDP_STORE_DAY_BUCKETS];
+} hdp_ring_t;
+
+static hdp_ring_t s_rings[HDP_MAX_MEMBERS][HDP_TYPE_COUNT];
+static hdp_device_info_t s_devices[HDP_MAX_DEVICES];
+static uint32_t s_device_count = 0U;
+static uint32_t s_device_generation = 0U;
+static uint32_t s_record_count = 0U;
+static uint32_t s_newest_sec = 0U;
+static bool s_rtc_set = false;
+static uint32_t s_rtc_epoch = 0U;
+static uint32_t s_rtc_tick_base = 0U;
+
+#if HDP_PERSIST_ENABLE
+#define HDP_PERSIST_STREAM  "hdp"
+
+/* Fixed layout so the image does not depend on enum or struct padding. */
+typedef struct {
+    uint32_t timestamp_sec;
+    int32_t  raw_value;
+    uint8_t  type;
+    uint8_t  member_index;
+    uint8_t  device_type;
+    uint8_t  reserved;
+    uint8_t  addr[6];
+    char     device_name[32];
+} hdp_persist_record_t;
+
+static nor_log_t s_persist;
+static bool s_persist_open = false;
+static bool s_persist_dirty = false;
+static bool s_persist_commit_failed = false;    /* warned once per failure streak */
+static lv_timer_t *s_persist_timer = NULL;
+#endif
+
+static hdp_ring_t *get_ring(uint8_t member_index, hdp_measurement_type_t type) {
+    if ((member_index >= HDP_MAX_MEMBERS) || (type < HDP_MEAS_TEMPERATURE) ||
+        (type > HDP_MEAS_BLOOD_PRESSURE)) {
+        return NULL;
+    }
+    return &s_rings[member_index][(uint32_t)type - 1U];
+}
+
+static uint32_t ring_phys(const hdp_ring_t *ring, uint32_t logical) {
+    return (ring->head + logical) % HDP_STORE_RING_CAPACITY;
+}
+
+/* First logical index whose timestamp is > ts (insert point after equals). */
+static uint32_t ring_upper_bound(const hdp_ring_t *ring, uint32_t ts) {
+    uint32_t lo = 0U;
+    uint32_t hi = ring->count;
+
+    while (lo < hi) {
+        uint32_t mid = lo + ((hi - lo) / 2U);
+        if (ring->records[ring_phys(ring, mid)].timestamp_sec <= ts) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* First logical index whose timestamp is >= ts. */
+static uint32_t ring_lower_bound(const hdp_ring_t *ring, uint32_t ts) {
+    uint32_t lo = 0U;
+    uint32_t hi = ring->count;
+
+    while (lo < hi) {
+        uint32_t mid = lo + ((hi - lo) / 2U);
+        if (ring->records[ring_phys(ring, mid)].timestamp_sec < ts) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/*******************************************************************************
+ * Devices
+ *******************************************************************************/
+/* Slot of the device with this address, added when new. The generation
+ * moves when a device is added or its name or type changes. */
+static uint8_t upsert_device(uint8_t device_type, const uint8_t addr[6],
+                             const char *name) {
+    static const uint8_t zero_addr[6] = {0};
+    uint32_t i;
+    hdp_device_info_t *dev;
+    bool added = false;
+
+    if ((0 == memcmp(addr, zero_addr, sizeof(zero_addr))) && ('\0' == name[0])) {
+        return HDP_NO_DEVICE;
+    }
+
+    for (i = 0U; i < s_device_count; i++) {
+        if (0 == memcmp(s_devices[i].addr, addr, sizeof(s_devices[i].addr))) {
+            break;
+        }
+    }
+    if (i == s_device_count) {
+        if (s_device_count >= HDP_MAX_DEVICES) {
+            return HDP_NO_DEVICE;
+        }
+        s_device_count++;
+        added = true;
+    }
+
+    dev = &s_devices[i];
+    if (added || (dev->device_type != device_type) ||
+        (0 != strncmp(dev->name, name, sizeof(dev->name) - 1U))) {
+        s_device_generation++;
+    }
+    dev->active = true;
+    dev->device_type = device_type;
+    memcpy(dev->addr, addr, sizeof(dev->addr));
+    (void)snprintf(dev->name, sizeof(dev->name), "%.*s",
+                   (int)(sizeof(dev->name) - 1U), name);
+    return (uint8_t)i;
+}
+
+static uint8_t register_device(const hdp_measurement_t *meas) {
+    char name[sizeof(meas->device_name)];
+    uint8_t slot;
+    hdp_device_info_t *dev;
+
+    memcpy(name, meas->device_name, sizeof(name));
+    name[sizeof(name) - 1U] = '\0';
+    slot = upsert_device(meas->device_type, meas->addr, name);
+    if (HDP_NO_DEVICE == slot) {
+        return HDP_NO_DEVICE;
+    }
+
+    dev = &s_devices[slot];
+    if (meas->timestamp_sec > dev->last_measurement_sec) {
+        dev->last_measurement_sec = meas->timestamp_sec;
+    }
+    dev->measurement_count++;
+    return slot;
+}
+
+/*******************************************************************************
+ * Aggregation
+ *******************************************************************************/
+static uint32_t extract_channels(hdp_measurement_type_t type, int32_t raw_value,
+                                 int16_t out[HDP_AGG_CHANNELS]) {
+    switch (type) {
+        case HDP_MEAS_BLOOD_PRESSURE: {
+            hdp_bp_values_t v;
+            hdp_unpack_bp(raw_value, &v);
+            out[0] = (int16_t)v.sys_mmhg;
+            out[1] = (int16_t)v.dia_mmhg;
+            out[2] = (int16_t)v.pulse_bpm;
+            return 3U;
+        }
+        case HDP_MEAS_SPO2_HR: {
+            hdp_spo2_hr_values_t v;
+            hdp_unpack_spo2_hr(raw_value, &v);
+            out[0] = (int16_t)v.spo2_pct;
+            out[1] = (int16_t)v.hr_bpm;
+            return 2U;
+        }
+        case HDP_MEAS_TEMPERATURE:
+            out[0] = hdp_get_temp_x10(raw_value);
+            return 1U;
+        case HDP_MEAS_GLUCOSE:
+            out[0] = hdp_get_glucose_mgdl(raw_value);
+            return 1U;
+        default:
+            return 0U;
+    }
+}
+
+static void add_to_day_bucket(hdp_ring_t *ring, hdp_measurement_type_t type,
+                              const hdp_measurement_t *meas) {
+    uint32_t day_tag = (meas->timestamp_sec / HDP_SEC_PER_DAY) + 1U;
+    hdp_day_bucket_t *b = &ring->days[day_tag % HDP_STORE_DAY_BUCKETS];
+    int16_t ch[HDP_AGG_CHANNELS] = {0};
+    uint32_t n = extract_channels(type, meas->raw_value, ch);
+    uint32_t i;
+
+    if (b->day_tag != day_tag) {
+        if (b->day_tag > day_tag) {
+            return; /* slot already holds a newer day: this one is too old */
+        }
+        memset(b, 0, sizeof(*b));
+        b->day_tag = day_tag;
+    }
+
+    for (i = 0U; i < n; i++) {
+        if ((0U == b->count) || (ch[i] < b->min[i])) {
+            b->min[i] = ch[i];
+        }
+        if ((0U == b->count) || (ch[i] > b->max[i])) {
+            b->max[i] = ch[i];
+        }
+        b->sum[i] += ch[i];
+    }
+    b->count++;
+}
+
+static const hdp_day_bucket_t *find_day_bucket(const hdp_ring_t *ring,
+                                               uint32_t day) {
+    const hdp_day_bucket_t *b = &ring->days[(day + 1U) % HDP_STORE_DAY_BUCKETS];
+    return (b->day_tag == (day + 1U)) ? b : NULL;
+}
+
+/* Merge the day buckets of [first_day, first_day + day_span) into out. */
+static void aggregate_days(const hdp_ring_t *ring, uint32_t first_day,
+                           uint32_t day_span, hdp_aggregate_t *out) {
+    int32_t sum[HDP_AGG_CHANNELS] = {0};
+    uint32_t d, i;
+
+    memset(out, 0, sizeof(*out));
+    out->start_sec = first_day * HDP_SEC_PER_DAY;
+
+    for (d = first_day; d < (first_day + day_span); d++) {
+        const hdp_day_bucket_t *b = find_day_bucket(ring, d);
+        if ((NULL == b) || (0U == b->count)) {
+            continue;
+        }
+        for (i = 0U; i < HDP_AGG_CHANNELS; i++) {
+            if ((0U == out->count) || (b->min[i] < out->min[i])) {
+                out->min[i] = b->min[i];
+            }
+            if ((0U == out->count) || (b->max[i] > out->max[i])) {
+                out->max[i] = b->max[i];
+            }
+            sum[i] += b->sum[i];
+        }
+        out->count += b->count;
+    }
+
+    if (out->count > 0U) {
+        for (i = 0U; i < HDP_AGG_CHANNELS; i++) {
+            out->mean[i] = (int16_t)(sum[i] / (int32_t)out->count);
+        }
+    }
+}
+
+static uint32_t get_aggregates(uint8_t member_index,
+                               hdp_measurement_type_t type, uint32_t end_sec,
+                               uint32_t bucket_count, uint32_t days_per_bucket,
+                               hdp_aggregate_t *out_array) {
+    const hdp_ring_t *ring = get_ring(member_index, type);
+    uint32_t end_day = end_sec / HDP_SEC_PER_DAY;
+    uint32_t filled = 0U;
+    uint32_t k;
+
+    if ((NULL == out_array) || (0U == bucket_count)) {
+        return 0U;
+    }
+
+    for (k = 0U; k < bucket_count; k++) {
+        uint32_t back = (bucket_count - k) * days_per_bucket - 1U;
+        hdp_aggregate_t *out = &out_array[k];
+
+        if ((NULL == ring) || (back > end_day)) {
+            memset(out, 0, sizeof(*out));
+            continue;
+        }
+        aggregate_days(ring, end_day - back, days_per_bucket, out);
+        if (out->count > 0U) {
+            filled++;
+        }
+    }
+    return filled;
+}
+
+/*******************************************************************************
+ * Records
+ *******************************************************************************/
+static void fill_measurement(const hdp_ring_t *ring, uint32_t phys,
+                             uint8_t member_index, hdp_measurement_type_t type,
+                             hdp_measurement_t *out) {
+    uint8_t slot = ring->device_slot[phys];
+
+    memset(out, 0, sizeof(*out));
+    out->type = type;
+    out->raw_value = ring->records[phys].raw_value;
+    out->timestamp_sec = ring->records[phys].timestamp_sec;
+    out->member_index = member_index;
+    if (slot < s_device_count) {
+        out->device_type = s_devices[slot].device_type;
+        memcpy(out->addr, s_devices[slot].addr, sizeof(out->addr));
+        memcpy(out->device_name, s_devices[slot].name, sizeof(out->device_name));
+    }
+}
+
+static bool store_reading(const hdp_measurement_t *meas);
+
+/*******************************************************************************
+ * Persistence
+ *******************************************************************************/
+#if HDP_PERSIST_ENABLE
+static bool replay_record(const void *data, uint32_t len, void *user) {
+    hdp_persist_record_t rec;
+    hdp_measurement_t meas;
+
+    (void)user;
+    if (len != sizeof(rec)) {
+        return true; /* written by another layout; skip */
+    }
+    memcpy(&rec, data, sizeof(rec));
+
+    memset(&meas, 0, sizeof(meas));
+    meas.timestamp_sec = rec.timestamp_sec;
+    meas.raw_value = rec.raw_value;
+    meas.type = (hdp_measurement_type_t)rec.type;
+    meas.member_index = rec.member_index;
+    meas.device_type = rec.device_type;
+    memcpy(meas.addr, rec.addr, sizeof(meas.addr));
+    memcpy(meas.device_name, rec.device_name, sizeof(meas.device_name));
+    meas.device_name[sizeof(meas.device_name) - 1U] = '\0';
+    (void)store_reading(&meas);
+    return true;
+}
+
+static void persist_reading(const hdp_measurement_t *meas) {
+    hdp_persist_record_t rec;
+
+    if (!s_persist_open) {
+        return;
+    }
+    memset(&rec, 0, sizeof(rec));
+    rec.timestamp_sec = meas->timestamp_sec;
+    rec.raw_value = meas->raw_value;
+    rec.type = (uint8_t)meas->type;
+    rec.member_index = meas->member_index;
+    rec.device_type = meas->device_type;
+    memcpy(rec.addr, meas->addr, sizeof(rec.addr));
+    memcpy(rec.device_name, meas->device_name, sizeof(rec.device_name));
+    if (nor_log_append(&s_persist, HDP_PERSIST_STREAM, &rec, sizeof(rec))) {
+        s_persist_dirty = true;
+    }
+}
+
+static void persist_commit_cb(lv_timer_t *timer) {
+    (void)timer;
+    if (!s_persist_dirty) {
+        return;
+    }
+    /* A failed commit keeps the batch staged; retry on the next tick. */
+    if (nor_log_commit(&s_persist)) {
+        s_persist_dirty = false;
+        s_persist_commit_failed = false;
+    }
+    else if (!s_persist_commit_failed) {
+        LV_LOG_WARN("hdp: commit to %s failed, retrying", HDP_PERSIST_FILE);
+        s_persist_commit_failed = true;
+    }
+}
+
+static void persist_open(void) {
+    nor_log_stats_t st;
+    uint32_t replayed;
+
+    if (!s_persist_open) {
+        s_persist_open = nor_log_open(&s_persist, HDP_PERSIST_FILE, HDP_PERSIST_SECTORS);
+        if (!s_persist_open) {
+            LV_LOG_WARN("hdp: cannot open %s, history is RAM only", HDP_PERSIST_FILE);
+            return;
+        }
+    }
+
+    replayed = nor_log_iterate(&s_persist, HDP_PERSIST_STREAM, replay_record, NULL);
+    nor_log_get_stats(&s_persist, &st);
+    LV_LOG_USER("hdp: replayed %u readings (%u batches, %u torn) in %u us",
+                (unsigned)replayed, (unsigned)st.recovered_batches,
+                (unsigned)st.torn_batches, (unsigned)st.recovery_us);
+
+    if (NULL == s_persist_timer) {
+        s_persist_timer = lv_timer_create(persist_commit_cb, HDP_PERSIST_COMMIT_MS, NULL);
+    }
+}
+
+void hdp_get_persist_stats(nor_log_stats_t *out) {
+    if (s_persist_open) {
+        nor_log_get_stats(&s_persist, out);
+    }
+    else if (NULL != out) {
+        memset(out, 0, sizeof(*out));
+    }
+}
+#endif
+
+void hdp_init(void) {
+    memset(s_rings, 0, sizeof(s_rings));
+    memset(s_devices, 0, sizeof(s_devices));
+    s_device_count = 0U;
+    s_device_generation++;
+    s_record_count = 0U;
+    s_newest_sec = 0U;
+#if HDP_PERSIST_ENABLE
+    persist_open();
+#endif
+#ifdef HDP_SEED_FILE
+    (void)hdp_load_csv(HDP_SEED_FILE);
+#endif
+}
+
+bool hdp_ingest(const hdp_measurement_t *meas) {
+    if (!store_reading(meas)) {
+        return false;
+    }
+#if HDP_PERSIST_ENABLE
+    persist_reading(meas);
+#endif
+    return true;
+}
+
+static bool store_reading(const hdp_measurement_t *meas) {
+    hdp_ring_t *ring;
+    uint32_t pos, i;
+
+    if (NULL == meas) {
+        return false;
+    }
+    ring = get_ring(meas->member_index, meas->type);
+    if (NULL == ring) {
+        return false;
+    }
+
+    pos = ring_upper_bound(ring, meas->timestamp_sec);
+
+    /* Devices resend stored readings after a reconnect. */
+    for (i = pos; i > 0U; i--) {
+        const hdp_record_t *r = &ring->records[ring_phys(ring, i - 1U)];
+        if (r->timestamp_sec != meas->timestamp_sec) {
+            break;
+        }
+        if (r->raw_value == meas->raw_value) {
+            return false;
+        }
+    }
+
+    if (ring->count == HDP_STORE_RING_CAPACITY) {
+        if (0U == pos) {
+            return false; /* older than everything a full ring keeps */
+        }
+        ring->head = ring_phys(ring, 1U);
+        ring->count--;
+        s_record_count--;
+        pos--;
+    }
+
+    /* Late reading: open a gap. In-order ingest (the common case) skips this. */
+    for (i = ring->count; i > pos; i--) {
+        uint32_t dst = ring_phys(ring, i);
+        uint32_t src = ring_phys(ring, i - 1U);
+        ring->records[dst] = ring->records[src];
+        ring->device_slot[dst] = ring->device_slot[src];
+    }
+
+    i = ring_phys(ring, pos);
+    ring->records[i].timestamp_sec = meas->timestamp_sec;
+    ring->records[i].raw_value = meas->raw_value;
+    ring->device_slot[i] = register_device(meas);
+    ring->count++;
+    s_record_count++;
+
+    add_to_day_bucket(ring, meas->type, meas);
+    if (meas->timestamp_sec > s_newest_sec) {
+        s_newest_sec = meas->timestamp_sec;
+    }
+    return true;
+}
+
+/*******************************************************************************
+ * CSV stand-in for the BLE bridge
+ *******************************************************************************/
+static bool parse_csv_type(const char *token, hdp_measurement_type_t *out_type,
+                           uint32_t *out_value_count) {
+    if (0 == strcmp(token, "bp")) {
+        *out_type = HDP_MEAS_BLOOD_PRESSURE;
+        *out_value_count = 3U;
+    } else if (0 == strcmp(token, "spo2")) {
+        *out_type = HDP_MEAS_SPO2_HR;
+        *out_value_count = 2U;
+    } else if (0 == strcmp(token, "temp")) {
+        *out_type = HDP_MEAS_TEMPERATURE;
+        *out_value_count = 1U;
+    } else if (0 == strcmp(token, "glucose")) {
+        *out_type = HDP_MEAS_GLUCOSE;
+        *out_value_count = 1U;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/* A stable fake address per device name, so the device table works. */
+static void name_to_addr(const char *name, uint8_t addr[6]) {
+    uint32_t hash = 2166136261U;
+    uint32_t i;
+
+    while ('\0' != *name) {
+        hash = (hash ^ (uint8_t)*name++) * 16777619U;
+    }
+    for (i = 0U; i < 6U; i++) {
+        addr[i] = (uint8_t)(hash >> ((i % 4U) * 8U));
+    }
+    addr[5] |= 0xC0U; /* static random address */
+}
+
+static bool parse_csv_line(char *line, hdp_measurement_t *out) {
+    char *fields[8];
+    uint32_t field_count = 0U;
+    uint32_t value_count;
+    float values[3];
+    char *cursor;
+    uint32_t i;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    while ((' ' == *line) || ('\t' == *line)) {
+        line++;
+    }
+    if (('\0' == *line) || ('#' == *line)) {
+        return false;
+    }
+
+    cursor = line;
+    while (field_count < 8U) {
+        fields[field_count++] = cursor;
+        cursor = strchr(cursor, ',');
+        if (NULL == cursor) {
+            break;
+        }
+        *cursor++ = '\0';
+    }
+
+    memset(out, 0, sizeof(*out));
+    if ((field_count < 4U) ||
+        !parse_csv_type(fields[2], &out->type, &value_count) ||
+        (field_count < (3U + value_count))) {
+        return false;
+    }
+
+    out->timestamp_sec = (uint32_t)strtoul(fields[0], NULL, 10);
+    out->member_index = (uint8_t)strtoul(fields[1], NULL, 10);
+    for (i = 0U; i < value_count; i++) {
+        values[i] = strtof(fields[3U + i], NULL);
+    }
+
+    switch (out->type) {
+        case HDP_MEAS_BLOOD_PRESSURE:
+            out->raw_value = hdp_pack_bp((uint16_t)values[0], (uint16_t)values[1],
+                                         (uint16_t)values[2]);
+            break;
+        case HDP_MEAS_SPO2_HR:
+            out->raw_value = hdp_pack_spo2_hr((uint16_t)values[0],
+                                              (uint16_t)values[1]);
+            break;
+        case HDP_MEAS_TEMPERATURE:
+            out->raw_value = (int32_t)(values[0] * 10.0f + 0.5f);
+            break;
+        default:
+            out->raw_value = (int32_t)values[0];
+            break;
+    }
+
+    if (field_count > (3U + value_count)) {
+        (void)snprintf(out->device_name, sizeof(out->device_name), "%s",
+                       fields[3U + value_count]);
+        name_to_addr(out->device_name, out->addr);
+        out->device_type = (uint8_t)out->type;
+    }
+    return true;
+}
+
+uint32_t hdp_load_csv(const char *path) {
+    char line[HDP_CSV_LINE_SIZE];
+    hdp_measurement_t meas;
+    uint32_t stored = 0U;
+    FILE *fp;
+
+    if (NULL == path) {
+        return 0U;
+    }
+    fp = fopen(path, "r");
+    if (NULL == fp) {
+        return 0U;
+    }
+
+    while (NULL != fgets(line, sizeof(line), fp)) {
+        if (parse_csv_line(line, &meas) && hdp_ingest(&meas)) {
+            stored++;
+        }
+    }
+    fclose(fp);
+    return stored;
+}
+
+/*******************************************************************************
+ * Queries
+ *******************************************************************************/
+bool hdp_get_latest(uint8_t member_index, hdp_measurement_type_t type,
+                    hdp_measurement_t *out) {
+    const hdp_ring_t *ring = get_ring(member_index, type);
+
+    if ((NULL == ring) || (NULL == out) || (0U == ring->count)) {
+        return false;
+    }
+    fill_measurement(ring, ring_phys(ring, ring->count - 1U), member_index,
+                     type, out);
+    return true;
+}
+
+uint32_t hdp_get_measurement_count(uint8_t member_index) {
+    uint32_t total = 0U;
+    uint32_t t;
+
+    if (member_index >= HDP_MAX_MEMBERS) {
+        return 0U;
+    }
+    for (t = 0U; t < HDP_TYPE_COUNT; t++) {
+        total += s_rings[member_index][t].count;
+    }
+    return total;
+}
+
+uint32_t hdp_get_history(uint8_t member_index, hdp_measurement_type_t type,
+                         hdp_measurement_t *out_array, uint32_t max_count) {
+    const hdp_ring_t *ring = get_ring(member_index, type);
+    uint32_t n, i;
+
+    if ((NULL == ring) || (NULL == out_array)) {
+        return 0U;
+    }
+
+    n = (ring->count < max_count) ? ring->count : max_count;
+    for (i = 0U; i < n; i++) {
+        fill_measurement(ring, ring_phys(ring, ring->count - 1U - i),
+                         member_index, type, &out_array[i]);
+    }
+    return n;
+}
+
+uint32_t hdp_get_history_range(uint8_t member_index,
+                               hdp_measurement_type_t type,
+                               uint32_t from_sec, uint32_t to_sec,
+                               hdp_measurement_t *out_array,
+                               uint32_t max_count) {
+    const hdp_ring_t *ring = get_ring(member_index, type);
+    uint32_t pos;
+    uint32_t n = 0U;
+
+    if ((NULL == ring) || (NULL == out_array) || (from_sec >= to_sec)) {
+        return 0U;
+    }
+
+    for (pos = ring_lower_bound(ring, from_sec);
+         (pos < ring->count) && (n < max_count); pos++) {
+        uint32_t phys = ring_phys(ring, pos);
+        if (ring->records[phys].timestamp_sec >= to_sec) {
+            break;
+        }
+        fill_measurement(ring, phys, member_index, type, &out_array[n++]);
+    }
+    return n;
+}
+
+uint32_t hdp_get_daily_aggregates(uint8_t member_index,
+                                  hdp_measurement_type_t type,
+                                  uint32_t end_sec, uint32_t day_count,
+                                  hdp_aggregate_t *out_array) {
+    return get_aggregates(member_index, type, end_sec, day_count, 1U, out_array);
+}
+
+uint32_t hdp_get_weekly_aggregates(uint8_t member_index,
+                                   hdp_measurement_type_t type,
+                                   uint32_t end_sec, uint32_t week_count,
+                                   hdp_aggregate_t *out_array) {
+    return get_aggregates(member_index, type, end_sec, week_count, 7U, out_array);
+}
+
+bool hdp_get_device_info(uint32_t device_index, hdp_device_info_t *out) {
+    if ((device_index >= s_device_count) || (NULL == out)) {
+        return false;
+    }
+    *out = s_devices[device_index];
+    return true;
+}
+
+uint32_t hdp_get_device_count(void) {
+    return s_device_count;
+}
+
+bool hdp_add_device(uint8_t device_type, const uint8_t addr[6],
+                    const char *name) {
+    if ((NULL == addr) || (NULL == name)) {
+        return false;
+    }
+    return HDP_NO_DEVICE != upsert_device(device_type, addr, name);
+}
+
+uint32_t hdp_get_device_generation(void) {
+    return s_device_generation;
+}
+
+/*******************************************************************************
+ * Clock
+ *******************************************************************************/
+void hdp_set_rtc_epoch(uint32_t epoch_sec, uint32_t tick_base) {
+    s_rtc_epoch = epoch_sec;
+    s_rtc_tick_base = tick_base;
+    s_rtc_set = (0U != epoch_sec);
+}
+
+uint32_t hdp_get_current_epoch(void) {
+    if (s_rtc_set) {
+        return s_rtc_epoch + (lv_tick_elaps(s_rtc_tick_base) / 1000U);
+    }
+    return s_newest_sec;
+}
+
+bool hdp_has_real_data(void) {
+    return s_record_count > 0U;
+}
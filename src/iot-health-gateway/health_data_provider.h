@@ -1,13 +1,15 @@
 /*******************************************************************************
  * File Name        : health_data_provider.h
  *
- * Description      : Stub health data provider for SIM-ONLY mode.
- *                    All hdp_* functions return "no real data" so the
- *                    health_ui_data_adapter falls back to simulation data.
+ * Description      : In-process measurement store for the Health UI.
+ *                    Readings enter through hdp_ingest() (BLE bridge) or
+ *                    hdp_load_csv() (file-backed stand-in for testing) and
+ *                    are kept in one time-ordered ring per (member, type)
+ *                    plus per-day aggregates. While the store is empty every
+ *                    query returns "no data" and health_ui_data_adapter
+ *                    falls back to simulation data.
  *
- *                    When BLE IPC is integrated (ENABLE_BLE_DATA_BRIDGE=1),
- *                    replace this with the real health_data_provider.h/c from
- *                    tesaiot-health-gateway.
+ *                    Not thread-safe: ingest and query from the UI thread.
  *
  *******************************************************************************/
 
@@ -17,13 +19,61 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nor_log.h"
+
 /*******************************************************************************
  * Configuration
  *******************************************************************************/
 #define HDP_MAX_MEMBERS         (4U)
+/* Paired devices remembered (at most 255). The simulated BLE bridge pairs
+ * HDB_SIM_DEVICE_COUNT of them. */
+#ifndef HDP_MAX_DEVICES
+#if defined(ENABLE_BLE_DATA_BRIDGE) && (ENABLE_BLE_DATA_BRIDGE != 0)
+#define HDP_MAX_DEVICES         (64U)
+#else
 #define HDP_MAX_DEVICES         (6U)
-#define HDP_MAX_MEASUREMENTS    (32U)
+#endif
+#endif
+
+/* Chart window: points for recent-readings charts, days for daily charts. */
+#ifndef HDP_MAX_HISTORY_POINTS
 #define HDP_MAX_HISTORY_POINTS  (7U)
+#endif
+
+/* Raw readings kept per (member, measurement type). 512 covers four
+ * readings a day for about four months; older ones are overwritten. */
+#ifndef HDP_STORE_RING_CAPACITY
+#define HDP_STORE_RING_CAPACITY (512U)
+#endif
+
+/* Daily aggregates kept per (member, measurement type). They outlive the
+ * raw readings they were built from. */
+#ifndef HDP_STORE_DAY_BUCKETS
+#define HDP_STORE_DAY_BUCKETS   (91U)
+#endif
+
+/* Optional CSV file loaded by hdp_init() (see hdp_load_csv). */
+/* #define HDP_SEED_FILE "health_seed.csv" */
+
+/* Stored readings are also appended to a nor_log image (emulated NOR flash)
+ * and replayed by hdp_init(), so history survives a restart. The stream is
+ * bounded by the image size: the oldest readings expire first. */
+#ifndef HDP_PERSIST_ENABLE
+#define HDP_PERSIST_ENABLE      (1)
+#endif
+
+#ifndef HDP_PERSIST_FILE
+#define HDP_PERSIST_FILE        "health_history.nvm"
+#endif
+
+#ifndef HDP_PERSIST_SECTORS
+#define HDP_PERSIST_SECTORS     (64U)       /* x 4 KiB */
+#endif
+
+/* Readings are batched and committed at most this often. */
+#ifndef HDP_PERSIST_COMMIT_MS
+#define HDP_PERSIST_COMMIT_MS   (1000U)
+#endif
 
 /*******************************************************************************
  * Measurement types
@@ -65,7 +115,12 @@ typedef struct {
 
 /*******************************************************************************
  * Device info
+ *
+ * device_type is the hdp_measurement_type_t the device reports, or one of
+ * the HDP_DEVICE_* values below for devices whose readings are not stored.
  *******************************************************************************/
+#define HDP_DEVICE_WEIGHT_SCALE (0x80U)
+
 typedef struct {
     bool     active;
     uint8_t  device_type;
@@ -76,40 +131,48 @@ typedef struct {
 } hdp_device_info_t;
 
 /*******************************************************************************
- * Stub API — all return "no data" so UI falls back to sim
+ * Aggregates (one day or one week of readings)
+ *
+ * Channels per type: BP = sys, dia, pulse; SpO2/HR = spo2, hr;
+ * temperature = x10 degC; glucose = mg/dL.
  *******************************************************************************/
+#define HDP_AGG_CHANNELS        (3U)
 
-static inline void hdp_init(void) {}
-
-static inline bool hdp_get_latest(uint8_t member_index,
-                                  hdp_measurement_type_t type,
-                                  hdp_measurement_t *out) {
-    (void)member_index; (void)type; (void)out;
-    return false;
-}
+typedef struct {
+    uint32_t start_sec;               /* UTC midnight that opens the bucket */
+    uint32_t count;                   /* readings; 0 = no data, rest unset */
+    int16_t  min[HDP_AGG_CHANNELS];
+    int16_t  max[HDP_AGG_CHANNELS];
+    int16_t  mean[HDP_AGG_CHANNELS];
+} hdp_aggregate_t;
 
-static inline uint32_t hdp_get_measurement_count(uint8_t member_index) {
-    (void)member_index;
-    return 0U;
+/*******************************************************************************
+ * Value packing (raw_value layout)
+ *******************************************************************************/
+static inline int32_t hdp_pack_bp(uint16_t sys, uint16_t dia, uint16_t pulse) {
+    return (int32_t)(((uint32_t)sys & 0x3FFU) |
+                     (((uint32_t)dia & 0x3FFU) << 10) |
+                     (((uint32_t)pulse & 0x3FFU) << 20));
 }
 
-static inline uint32_t hdp_get_history(uint8_t member_index,
-                                       hdp_measurement_type_t type,
-                                       hdp_measurement_t *out_array,
-                                       uint32_t max_count) {
-    (void)member_index; (void)type; (void)out_array; (void)max_count;
-    return 0U;
+static inline void hdp_unpack_bp(int32_t raw_value, hdp_bp_values_t *out) {
+    if (out) {
+        out->sys_mmhg = (uint16_t)((uint32_t)raw_value & 0x3FFU);
+        out->dia_mmhg = (uint16_t)(((uint32_t)raw_value >> 10) & 0x3FFU);
+        out->pulse_bpm = (uint16_t)(((uint32_t)raw_value >> 20) & 0x3FFU);
+    }
 }
 
-static inline void hdp_unpack_bp(int32_t raw_value, hdp_bp_values_t *out) {
-    (void)raw_value;
-    if (out) { out->sys_mmhg = 0; out->dia_mmhg = 0; out->pulse_bpm = 0; }
+static inline int32_t hdp_pack_spo2_hr(uint16_t spo2_pct, uint16_t hr_bpm) {
+    return (int32_t)((uint32_t)spo2_pct | ((uint32_t)hr_bpm << 16));
 }
 
 static inline void hdp_unpack_spo2_hr(int32_t raw_value,
                                        hdp_spo2_hr_values_t *out) {
-    (void)raw_value;
-    if (out) { out->spo2_pct = 0; out->hr_bpm = 0; }
+    if (out) {
+        out->spo2_pct = (uint16_t)((uint32_t)raw_value & 0xFFFFU);
+        out->hr_bpm = (uint16_t)((uint32_t)raw_value >> 16);
+    }
 }
 
 static inline int16_t hdp_get_temp_x10(int32_t raw_value) {
@@ -120,20 +183,82 @@ static inline int16_t hdp_get_glucose_mgdl(int32_t raw_value) {
     return (int16_t)raw_value;
 }
 
-static inline bool hdp_get_device_info(uint32_t device_index,
-                                       hdp_device_info_t *out) {
-    (void)device_index; (void)out;
-    return false;
-}
+/*******************************************************************************
+ * Store API
+ *******************************************************************************/
 
-static inline uint32_t hdp_get_device_count(void) { return 0U; }
+/** Clear the store, replay the persisted history, then load HDP_SEED_FILE
+ *  when that is defined. Call after lv_init(). */
+void hdp_init(void);
 
-static inline void hdp_set_rtc_epoch(uint32_t epoch_sec, uint32_t tick_base) {
-    (void)epoch_sec; (void)tick_base;
-}
+/** Add one reading. Late readings are inserted in time order. Returns false
+ *  when nothing was stored: bad member/type, an exact duplicate (same time,
+ *  type and value), or a reading older than everything in a full ring. */
+bool hdp_ingest(const hdp_measurement_t *meas);
+
+/** Load readings from a CSV file, one per line:
+ *    epoch,member,type,value[,value[,value]][,device name]
+ *  type is bp (sys,dia,pulse), spo2 (pct,hr), temp (degC) or glucose (mg/dL).
+ *  Blank lines and lines starting with '#' are skipped.
+ *  Returns the number of readings stored. */
+uint32_t hdp_load_csv(const char *path);
+
+/** Most recent reading, O(1). */
+bool hdp_get_latest(uint8_t member_index, hdp_measurement_type_t type,
+                    hdp_measurement_t *out);
+
+/** Readings currently held for a member, all types. */
+uint32_t hdp_get_measurement_count(uint8_t member_index);
+
+/** Up to max_count most recent readings, most recent first. */
+uint32_t hdp_get_history(uint8_t member_index, hdp_measurement_type_t type,
+                         hdp_measurement_t *out_array, uint32_t max_count);
+
+/** Readings with from_sec <= timestamp < to_sec, oldest first. Finds the
+ *  start by binary search, so the cost is O(log n + returned). */
+uint32_t hdp_get_history_range(uint8_t member_index,
+                               hdp_measurement_type_t type,
+                               uint32_t from_sec, uint32_t to_sec,
+                               hdp_measurement_t *out_array,
+                               uint32_t max_count);
+
+/** day_count daily aggregates ending with the day that holds end_sec, oldest
+ *  first. Returns the number of days that have readings. */
+uint32_t hdp_get_daily_aggregates(uint8_t member_index,
+                                  hdp_measurement_type_t type,
+                                  uint32_t end_sec, uint32_t day_count,
+                                  hdp_aggregate_t *out_array);
+
+/** Same as daily, in 7-day buckets ending with the day that holds end_sec. */
+uint32_t hdp_get_weekly_aggregates(uint8_t member_index,
+                                   hdp_measurement_type_t type,
+                                   uint32_t end_sec, uint32_t week_count,
+                                   hdp_aggregate_t *out_array);
+
+bool hdp_get_device_info(uint32_t device_index, hdp_device_info_t *out);
+
+uint32_t hdp_get_device_count(void);
+
+/** Add a paired device that has not sent a reading yet, or update the name
+ *  and type of a known address. Returns false when the table is full. */
+bool hdp_add_device(uint8_t device_type, const uint8_t addr[6],
+                    const char *name);
+
+/** Changes whenever a device is added or renamed, or the store is cleared;
+ *  compare with an earlier value to know the device list must be redrawn. */
+uint32_t hdp_get_device_generation(void);
+
+/** Wall clock: epoch_sec was current at tick_base (lv_tick_get() ms). */
+void hdp_set_rtc_epoch(uint32_t epoch_sec, uint32_t tick_base);
+
+/** RTC time when set; otherwise the newest stored reading, or 0. */
+uint32_t hdp_get_current_epoch(void);
 
-static inline uint32_t hdp_get_current_epoch(void) { return 0U; }
+bool hdp_has_real_data(void);
 
-static inline bool hdp_has_real_data(void) { return false; }
+#if HDP_PERSIST_ENABLE
+/** Write amplification, wear and recovery time of the history image. */
+void hdp_get_persist_stats(nor_log_stats_t *out);
+#endif
 
 #endif /* HEALTH_DATA_PROVIDER_H */
@@ -6,16 +6,21 @@
  * GFXSS driver; here we hardcode the 4.3" viewport (832×480) to match
  * the target display for layout development.
  *
- * Switch to 1024×600 to preview the 7" layout.
+ * Switch to 1024×600 to preview the 7" layout, or pass both sizes on the
+ * command line (CMake: -DHEALTH_UI_VIEWPORT=1024x600). Each size needs a
+ * layout token table, see tools/gen_layout_tokens.py.
  ******************************************************************************/
 
 #ifndef LV_PORT_DISP_H
 #define LV_PORT_DISP_H
 
+#if defined(MY_DISP_HOR_RES) && defined(MY_DISP_VER_RES)
+/* Viewport chosen by the build */
+#else
 /* Simulate 4.3" Waveshare DSI (800×480, LVGL viewport 832×480) */
 #define MTB_DISPLAY_W4P3INCH_RPI
 
-#ifdef MTB_DISPLAY_W4P3INCH_RPI
+#if defined(MTB_DISPLAY_W4P3INCH_RPI)
 #define MY_DISP_HOR_RES (832U)
 #define MY_DISP_VER_RES (480U)
 #else
@@ -23,5 +28,6 @@
 #define MY_DISP_HOR_RES (1024U)
 #define MY_DISP_VER_RES (600U)
 #endif
+#endif
 
 #endif /* LV_PORT_DISP_H */
@@ -5,20 +5,54 @@
  * Initializes the Health UI layout shell + root with simulation data.
  ******************************************************************************/
 
+#include <stdio.h>
+#include <stdlib.h>
+
 #include "lvgl.h"
+#include "health_data_provider.h"
 #include "ui/health/health_layout_shell.h"
 #include "ui/health/health_ui_root.h"
 #include "ui/health/sim/health_ui_sim_data.h"
 #include "tesaiot/app_interface.h"
+#include "ui/health/health_ui_display_policy.h"
+
+#if HEALTH_UI_VIEWPORT_HOT_SWITCH
+/* HEALTH_UI_VIEWPORT=1024x600 picks another panel's token tables at start-up
+ * and resizes the simulator window to match. The UI is built once, so the
+ * viewport cannot change while it runs. */
+static void select_viewport_from_env(void)
+{
+    const char *env = getenv("HEALTH_UI_VIEWPORT");
+    unsigned w = 0U;
+    unsigned h = 0U;
+
+    if ((NULL == env) || (2 != sscanf(env, "%ux%u", &w, &h))) {
+        return;
+    }
+    if (!hl_viewport_select(w, h)) {
+        LV_LOG_WARN("HEALTH_UI_VIEWPORT=%s has no token table, keeping %ux%u",
+                    env, (unsigned)MY_DISP_HOR_RES, (unsigned)MY_DISP_VER_RES);
+        return;
+    }
+    lv_display_set_resolution(lv_display_get_default(), (int32_t)w, (int32_t)h);
+}
+#endif
 
 void example_main(lv_obj_t *parent)
 {
     (void)parent;
 
+#if HEALTH_UI_VIEWPORT_HOT_SWITCH
+    select_viewport_from_env();
+#endif
+
     /* Background color matching embedded firmware */
     lv_obj_t *scr = lv_screen_active();
     lv_obj_set_style_bg_color(scr, lv_color_hex(0x003366), LV_PART_MAIN);
 
+    /* Empty unless built with HDP_SEED_FILE; the UI then shows sim data. */
+    hdp_init();
+
     health_layout_shell_init();
     health_ui_root_init();
 }
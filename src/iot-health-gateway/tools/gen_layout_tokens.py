@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Generate the Health UI layout token tables.
+
+Scans ui/health for HL_SCALE_V(<px>) / HL_SCALE_H(<px>) with a literal
+argument and writes ui/health/layout/layout_token_tables.h: one row of
+pre-scaled values per supported viewport. health_ui_display_policy.h turns
+each HL_SCALE_* into a table lookup with a constant index (folded by the
+compiler) or, with HEALTH_UI_VIEWPORT_HOT_SWITCH, a runtime index.
+
+Values use the same truncating integer math the macros used, so existing
+layouts do not move by a pixel.
+
+    python3 tools/gen_layout_tokens.py          regenerate
+    python3 tools/gen_layout_tokens.py --check  fail if the file is stale
+"""
+import argparse
+import os
+import re
+import sys
+
+# Panels the Health UI ships on or is tested against (width, height).
+VIEWPORTS = [
+    (800, 480),     # 4.3" panel, full frame
+    (832, 480),     # 4.3" Waveshare DSI, LVGL viewport
+    (1024, 600),    # 7" Waveshare DSI (design reference)
+    (1280, 800),    # 10.1" panel, multi-panel testing
+]
+
+REF_WIDTH = 1024
+REF_HEIGHT = 600
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+UI_DIR = os.path.normpath(os.path.join(HERE, "..", "ui", "health"))
+OUT_PATH = os.path.join(UI_DIR, "layout", "layout_token_tables.h")
+
+SCALE_RE = re.compile(r"\bHL_SCALE_([VH])\(\s*(\d+)U?\s*\)")
+
+
+def scan():
+    uses = {"V": {0}, "H": {0}}  # slot 0 keeps both tables non-empty
+    for root, _dirs, files in os.walk(UI_DIR):
+        for name in files:
+            if not name.endswith((".c", ".h")):
+                continue
+            path = os.path.join(root, name)
+            if path == OUT_PATH:
+                continue
+            with open(path, encoding="utf-8") as f:
+                for axis, px in SCALE_RE.findall(f.read()):
+                    uses[axis].add(int(px))
+    return {axis: sorted(vals) for axis, vals in uses.items()}
+
+
+def scaled(px, actual, ref):
+    return px * actual // ref
+
+
+def emit_table(lines, axis, slots):
+    ref = REF_HEIGHT if axis == "V" else REF_WIDTH
+    lines.append("/* HL_SCALE_%s(px) slots */" % axis)
+    for i, px in enumerate(slots):
+        lines.append("#define HL_%sSLOT_%d (%d)" % (axis, px, i))
+    lines.append("#define HL_%sSLOT_COUNT (%d)" % (axis, len(slots)))
+    lines.append("")
+    lines.append("static const int16_t hl_%s_tokens[HL_VIEWPORT_COUNT][HL_%sSLOT_COUNT] = {"
+                 % (axis.lower(), axis))
+    for w, h in VIEWPORTS:
+        actual = h if axis == "V" else w
+        vals = [str(scaled(px, actual, ref)) for px in slots]
+        lines.append("    /* %dx%d */" % (w, h))
+        row = "    {"
+        for k in range(0, len(vals), 16):
+            chunk = ", ".join(vals[k:k + 16])
+            row += ("" if k == 0 else ",\n     ") + chunk
+        lines.append(row + "},")
+    lines.append("};")
+    lines.append("")
+
+
+def generate():
+    uses = scan()
+    lines = [
+        "/* GENERATED by tools/gen_layout_tokens.py -- do not edit.",
+        " * Pre-scaled layout tokens, one row per viewport (reference %dx%d)."
+        % (REF_WIDTH, REF_HEIGHT),
+        " * Include through health_ui_display_policy.h only. */",
+        "#ifndef HEALTH_LAYOUT_TOKEN_TABLES_H",
+        "#define HEALTH_LAYOUT_TOKEN_TABLES_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#define HL_VIEWPORT_COUNT (%dU)" % len(VIEWPORTS),
+    ]
+    for i, (w, h) in enumerate(VIEWPORTS):
+        lines.append("#define HL_VIEWPORT_%dX%d (%dU)" % (w, h, i))
+    lines.append("")
+    lines.append("/* Viewport this build targets */")
+    for i, (w, h) in enumerate(VIEWPORTS):
+        kw = "#if" if i == 0 else "#elif"
+        lines.append("%s (MY_DISP_HOR_RES == %dU) && (MY_DISP_VER_RES == %dU)" % (kw, w, h))
+        lines.append("#define HL_VIEWPORT_BUILD HL_VIEWPORT_%dX%d" % (w, h))
+    lines.append("#else")
+    lines.append('#error "No layout token table for this viewport: add it to tools/gen_layout_tokens.py"')
+    lines.append("#endif")
+    lines.append("")
+    lines.append("typedef struct {")
+    lines.append("    uint16_t width;")
+    lines.append("    uint16_t height;")
+    lines.append("} hl_viewport_desc_t;")
+    lines.append("")
+    lines.append("static const hl_viewport_desc_t hl_viewports[HL_VIEWPORT_COUNT] = {")
+    for w, h in VIEWPORTS:
+        lines.append("    {%d, %d}," % (w, h))
+    lines.append("};")
+    lines.append("")
+    emit_table(lines, "V", uses["V"])
+    emit_table(lines, "H", uses["H"])
+    lines.append("#endif")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true",
+                        help="exit 1 if %s is out of date" % os.path.relpath(OUT_PATH))
+    args = parser.parse_args()
+
+    text = generate()
+    current = None
+    if os.path.exists(OUT_PATH):
+        with open(OUT_PATH, encoding="utf-8") as f:
+            current = f.read()
+
+    if args.check:
+        if current != text:
+            print("%s is stale; run %s" % (OUT_PATH, sys.argv[0]))
+            return 1
+        return 0
+
+    if current != text:
+        with open(OUT_PATH, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+        print("wrote %s" % OUT_PATH)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,5 +1,27 @@
 #include "comp_device_card.h"
 
+#include "../../health_ui_binding.h"
+
+/* The card's widgets are bound to these subjects; bind() only publishes. */
+typedef struct {
+  health_ui_text_subject_t avatar_text;
+  health_ui_text_subject_t name;
+  health_ui_text_subject_t type;
+  lv_subject_t avatar_bg_color; /* 0xRRGGBB */
+} device_card_refs_t;
+
+static void on_device_card_deleted(lv_event_t *e) {
+  device_card_refs_t *refs = (device_card_refs_t *)lv_event_get_user_data(e);
+  if (NULL != refs) {
+    /* Sent before the children go: detach their observers, then free. */
+    health_ui_text_subject_deinit(&refs->avatar_text);
+    health_ui_text_subject_deinit(&refs->name);
+    health_ui_text_subject_deinit(&refs->type);
+    lv_subject_deinit(&refs->avatar_bg_color);
+    lv_free(refs);
+  }
+}
+
 lv_obj_t *comp_device_card_create(lv_obj_t *parent,
                                   const comp_device_card_data_t *data) {
   lv_obj_t *card;
@@ -8,26 +30,15 @@ lv_obj_t *comp_device_card_create(lv_obj_t *parent,
   lv_obj_t *text_col;
   lv_obj_t *name_label;
   lv_obj_t *type_label;
-  const char *name = "Device";
-  const char *type = "";
-  const char *avatar_label = "";
-  uint32_t avatar_bg_color = COMP_DEVICE_CARD_AVATAR_BG_COLOR_HEX;
+  device_card_refs_t *refs;
 
   if (NULL == parent) {
     return NULL;
   }
 
-  if (NULL != data) {
-    name = ((NULL != data->name) && (data->name[0] != '\0')) ? data->name : name;
-    type = ((NULL != data->type_text) && (data->type_text[0] != '\0')) ? data->type_text
-                                                                        : type;
-    avatar_label =
-        ((NULL != data->avatar_text) && (data->avatar_text[0] != '\0'))
-            ? data->avatar_text
-            : avatar_label;
-    if (0U != data->avatar_bg_color_hex) {
-      avatar_bg_color = data->avatar_bg_color_hex;
-    }
+  refs = (device_card_refs_t *)lv_malloc_zeroed(sizeof(*refs));
+  if (NULL == refs) {
+    return NULL;
   }
 
   card = lv_obj_create(parent);
@@ -56,14 +67,12 @@ lv_obj_t *comp_device_card_create(lv_obj_t *parent,
                   COMP_DEVICE_CARD_AVATAR_SIZE_PX);
   lv_obj_set_style_radius(avatar, COMP_DEVICE_CARD_AVATAR_RADIUS_PX,
                           LV_PART_MAIN);
-  lv_obj_set_style_bg_color(avatar, lv_color_hex(avatar_bg_color), LV_PART_MAIN);
   lv_obj_set_style_bg_opa(avatar, LV_OPA_COVER, LV_PART_MAIN);
   lv_obj_set_style_border_width(avatar, 0, LV_PART_MAIN);
   lv_obj_set_style_pad_all(avatar, 0, LV_PART_MAIN);
   lv_obj_clear_flag(avatar, LV_OBJ_FLAG_SCROLLABLE);
 
   avatar_text = lv_label_create(avatar);
-  lv_label_set_text(avatar_text, avatar_label);
   lv_obj_set_style_text_color(avatar_text,
                               lv_color_hex(COMP_DEVICE_CARD_AVATAR_TEXT_COLOR_HEX),
                               LV_PART_MAIN);
@@ -86,7 +95,6 @@ lv_obj_t *comp_device_card_create(lv_obj_t *parent,
   lv_obj_clear_flag(text_col, LV_OBJ_FLAG_SCROLLABLE);
 
   name_label = lv_label_create(text_col);
-  lv_label_set_text(name_label, name);
   lv_label_set_long_mode(name_label, LV_LABEL_LONG_DOT);
   lv_obj_set_width(name_label, lv_pct(100));
   lv_obj_set_style_text_color(name_label, lv_color_hex(COMP_DEVICE_CARD_NAME_COLOR_HEX),
@@ -94,12 +102,61 @@ lv_obj_t *comp_device_card_create(lv_obj_t *parent,
   lv_obj_set_style_text_font(name_label, COMP_DEVICE_CARD_NAME_FONT, LV_PART_MAIN);
 
   type_label = lv_label_create(text_col);
-  lv_label_set_text(type_label, type);
   lv_label_set_long_mode(type_label, LV_LABEL_LONG_DOT);
   lv_obj_set_width(type_label, lv_pct(100));
   lv_obj_set_style_text_color(type_label, lv_color_hex(COMP_DEVICE_CARD_TYPE_COLOR_HEX),
                               LV_PART_MAIN);
   lv_obj_set_style_text_font(type_label, COMP_DEVICE_CARD_TYPE_FONT, LV_PART_MAIN);
 
+  health_ui_text_subject_init(&refs->avatar_text, "");
+  health_ui_text_subject_init(&refs->name, "Device");
+  health_ui_text_subject_init(&refs->type, "");
+  lv_subject_init_int(&refs->avatar_bg_color,
+                      (int32_t)COMP_DEVICE_CARD_AVATAR_BG_COLOR_HEX);
+  (void)health_ui_bind_bg_color(avatar, &refs->avatar_bg_color);
+  (void)health_ui_bind_label(avatar_text, &refs->avatar_text);
+  (void)health_ui_bind_label(name_label, &refs->name);
+  (void)health_ui_bind_label(type_label, &refs->type);
+  lv_obj_set_user_data(card, refs);
+  lv_obj_add_event_cb(card, on_device_card_deleted, LV_EVENT_DELETE, refs);
+
+  comp_device_card_bind(card, data);
   return card;
 }
+
+void comp_device_card_bind(lv_obj_t *card, const comp_device_card_data_t *data) {
+  device_card_refs_t *refs;
+  const char *name = "Device";
+  const char *type = "";
+  const char *avatar_label = "";
+  uint32_t avatar_bg_color = COMP_DEVICE_CARD_AVATAR_BG_COLOR_HEX;
+
+  if (NULL == card) {
+    return;
+  }
+
+  refs = (device_card_refs_t *)lv_obj_get_user_data(card);
+  if (NULL == refs) {
+    return;
+  }
+
+  if (NULL != data) {
+    name = ((NULL != data->name) && (data->name[0] != '\0')) ? data->name : name;
+    type = ((NULL != data->type_text) && (data->type_text[0] != '\0')) ? data->type_text
+                                                                        : type;
+    avatar_label =
+        ((NULL != data->avatar_text) && (data->avatar_text[0] != '\0'))
+            ? data->avatar_text
+            : avatar_label;
+    if (0U != data->avatar_bg_color_hex) {
+      avatar_bg_color = data->avatar_bg_color_hex;
+    }
+  }
+
+  /* A recycled card showing the same device redraws nothing. */
+  (void)health_ui_int_subject_publish(&refs->avatar_bg_color,
+                                      (int32_t)avatar_bg_color);
+  (void)health_ui_text_subject_publish(&refs->avatar_text, avatar_label);
+  (void)health_ui_text_subject_publish(&refs->name, name);
+  (void)health_ui_text_subject_publish(&refs->type, type);
+}
@@ -9,11 +9,7 @@
 
 #ifndef COMP_DEVICE_CARD_WIDTH_PCT
 /* Fallback width when parent page does not apply runtime pixel-width override. */
-#if (MY_DISP_HOR_RES >= 1024)
-#define COMP_DEVICE_CARD_WIDTH_PCT (24)
-#else
-#define COMP_DEVICE_CARD_WIDTH_PCT (31)
-#endif
+#define COMP_DEVICE_CARD_WIDTH_PCT (HL_VIEWPORT_IS_WIDE ? 24 : 31)
 #endif
 
 #ifndef COMP_DEVICE_CARD_HEIGHT_PX
@@ -37,7 +33,7 @@
 #endif
 
 #ifndef COMP_DEVICE_CARD_PAD_VER_PX
-#define COMP_DEVICE_CARD_PAD_VER_PX HL_SCALE_V(COMP_DEVICE_CARD_PAD_PX)
+#define COMP_DEVICE_CARD_PAD_VER_PX HL_SCALE_V_EXPR(COMP_DEVICE_CARD_PAD_PX)
 #endif
 
 #ifndef COMP_DEVICE_CARD_COL_GAP_PX
@@ -96,4 +92,8 @@ typedef struct {
 lv_obj_t *comp_device_card_create(lv_obj_t *parent,
                                   const comp_device_card_data_t *data);
 
+/* Rebind an existing card to new data without recreating its children.
+ * The labels are bound to per-card subjects, so only changed fields redraw. */
+void comp_device_card_bind(lv_obj_t *card, const comp_device_card_data_t *data);
+
 #endif
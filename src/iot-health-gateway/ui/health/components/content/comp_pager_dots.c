@@ -42,32 +42,63 @@ lv_obj_t *comp_pager_dots_create(lv_obj_t *parent) {
   return dots;
 }
 
+static uint32_t get_window_start(uint32_t dot_count, uint32_t visible_count,
+                                 uint32_t active_idx) {
+  uint32_t start;
+
+  if ((dot_count <= visible_count) || (active_idx < (visible_count / 2U))) {
+    return 0U;
+  }
+
+  start = active_idx - (visible_count / 2U);
+  if (start > (dot_count - visible_count)) {
+    start = dot_count - visible_count;
+  }
+
+  return start;
+}
+
 void comp_pager_dots_build(lv_obj_t *dots, uint32_t dot_count,
                            uint32_t active_idx) {
   uint32_t i;
+  uint32_t visible_count;
+  uint32_t start;
 
   if (NULL == dots) {
     return;
   }
 
+  visible_count = dot_count;
+  if ((COMP_PAGER_DOTS_MAX_VISIBLE > 0U) &&
+      (visible_count > COMP_PAGER_DOTS_MAX_VISIBLE)) {
+    visible_count = COMP_PAGER_DOTS_MAX_VISIBLE;
+  }
+
+  /* Total page count is kept on the container for set_active() windowing. */
+  lv_obj_set_user_data(dots, (void *)(uintptr_t)dot_count);
+  start = get_window_start(dot_count, visible_count, active_idx);
+
   lv_obj_clean(dots);
-  for (i = 0U; i < dot_count; i++) {
+  for (i = 0U; i < visible_count; i++) {
     lv_obj_t *dot = lv_obj_create(dots);
-    set_dot_visual(dot, i == active_idx);
+    set_dot_visual(dot, (start + i) == active_idx);
   }
 }
 
 void comp_pager_dots_set_active(lv_obj_t *dots, uint32_t active_idx) {
   uint32_t i;
   uint32_t count;
+  uint32_t start;
 
   if (NULL == dots) {
     return;
   }
 
   count = (uint32_t)lv_obj_get_child_cnt(dots);
+  start = get_window_start((uint32_t)(uintptr_t)lv_obj_get_user_data(dots), count,
+                           active_idx);
   for (i = 0U; i < count; i++) {
     lv_obj_t *dot = lv_obj_get_child(dots, (int32_t)i);
-    set_dot_visual(dot, i == active_idx);
+    set_dot_visual(dot, (start + i) == active_idx);
   }
 }
@@ -21,6 +21,11 @@
 #define COMP_PAGER_DOT_INACTIVE_COLOR_HEX (0xD0D5DD)
 #endif
 
+#ifndef COMP_PAGER_DOTS_MAX_VISIBLE
+/* Long page lists show a sliding window of dots so the object count stays fixed. */
+#define COMP_PAGER_DOTS_MAX_VISIBLE (9U)
+#endif
+
 lv_obj_t *comp_pager_dots_create(lv_obj_t *parent);
 void comp_pager_dots_build(lv_obj_t *dots, uint32_t dot_count,
                            uint32_t active_idx);
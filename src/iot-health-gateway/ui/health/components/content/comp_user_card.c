@@ -1,5 +1,7 @@
 #include "comp_user_card.h"
 
+#include "../../health_ui_binding.h"
+
 #include <stdbool.h>
 #include <stdio.h>
 
@@ -7,9 +9,36 @@ typedef enum {
   CHIP_STYLE_NORMAL = 0,
   CHIP_STYLE_WARNING = 1,
   CHIP_STYLE_CRITICAL = 2,
-  CHIP_STYLE_MORE = 3
+  CHIP_STYLE_MORE = 3,
+  CHIP_STYLE_HIDDEN = 4 /* unused pool slot */
 } chip_style_t;
 
+/* Chips are pooled per card so rebinding never creates or deletes objects. */
+#if (COMP_USER_CARD_MAX_VISIBLE_CHIPS > 0U)
+#define CHIP_SLOT_COUNT (COMP_USER_CARD_MAX_VISIBLE_CHIPS + 1U)
+#else
+#define CHIP_SLOT_COUNT (4U)
+#endif
+
+/* The card's widgets are bound to these subjects; bind() only publishes. */
+typedef struct {
+  health_ui_text_subject_t text;
+  lv_subject_t style; /* chip_style_t */
+} chip_subjects_t;
+
+typedef struct {
+  lv_subject_t avatar_bg_color; /* 0xRRGGBB */
+  health_ui_text_subject_t name;
+  chip_subjects_t chips[CHIP_SLOT_COUNT];
+  health_ui_text_subject_t icon;
+  health_ui_text_subject_t title;
+  health_ui_text_subject_t time;
+  health_ui_text_subject_t value;
+  health_ui_text_subject_t unit;
+  health_ui_text_subject_t status;
+  lv_subject_t status_level; /* comp_user_status_level_t */
+} user_card_refs_t;
+
 static const char *get_condition_text(comp_user_condition_t condition) {
   switch (condition) {
   case COMP_USER_CONDITION_LOW_FEVER:
@@ -132,74 +161,111 @@ static lv_color_t get_chip_text_color(chip_style_t style) {
   }
 }
 
-static lv_obj_t *create_condition_chip(lv_obj_t *parent, const char *text,
-                                       chip_style_t style) {
+static void on_status_level_changed(lv_observer_t *observer,
+                                    lv_subject_t *subject) {
+  lv_obj_set_style_text_color(
+      lv_observer_get_target_obj(observer),
+      get_status_color((comp_user_status_level_t)lv_subject_get_int(subject)),
+      LV_PART_MAIN);
+}
+
+static void on_chip_style_changed(lv_observer_t *observer, lv_subject_t *subject) {
+  lv_obj_t *chip = lv_observer_get_target_obj(observer);
+  lv_obj_t *label = lv_obj_get_child(chip, 0);
+  chip_style_t style = (chip_style_t)lv_subject_get_int(subject);
+
+  if (CHIP_STYLE_HIDDEN == style) {
+    lv_obj_add_flag(chip, LV_OBJ_FLAG_HIDDEN);
+    return;
+  }
+
+  style_chip(chip, style);
+  lv_obj_set_style_text_color(label, get_chip_text_color(style), LV_PART_MAIN);
+  if (CHIP_STYLE_MORE == style) {
+    lv_obj_clear_flag(chip, LV_OBJ_FLAG_CLICKABLE);
+  } else {
+    lv_obj_add_flag(chip, LV_OBJ_FLAG_CLICKABLE);
+  }
+  lv_obj_clear_flag(chip, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void create_condition_chip(lv_obj_t *parent, chip_subjects_t *subjects) {
   lv_obj_t *chip;
   lv_obj_t *label;
 
   chip = lv_btn_create(parent);
-  style_chip(chip, style);
   lv_obj_clear_flag(chip, LV_OBJ_FLAG_SCROLLABLE);
 
   label = lv_label_create(chip);
-  lv_label_set_text(label, (NULL != text) ? text : "");
   lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
-  lv_obj_set_style_text_color(label, get_chip_text_color(style), LV_PART_MAIN);
   lv_obj_set_style_text_font(label, COMP_USER_CARD_CHIP_FONT, LV_PART_MAIN);
   lv_obj_center(label);
 
-  return chip;
+  health_ui_text_subject_init(&subjects->text, "");
+  lv_subject_init_int(&subjects->style, (int32_t)CHIP_STYLE_HIDDEN);
+  (void)health_ui_bind_label(label, &subjects->text);
+  (void)lv_subject_add_observer_obj(&subjects->style, on_chip_style_changed, chip,
+                                    NULL);
+}
+
+static void set_condition_chip(user_card_refs_t *refs, uint32_t slot,
+                               const char *text, chip_style_t style) {
+  chip_subjects_t *chip = &refs->chips[slot];
+
+  (void)health_ui_text_subject_publish(&chip->text, text);
+  (void)health_ui_int_subject_publish(&chip->style, (int32_t)style);
 }
 
-static void populate_conditions(lv_obj_t *container,
+static void populate_conditions(user_card_refs_t *refs,
                                 const comp_user_condition_t *conditions,
                                 uint32_t condition_count) {
   uint32_t i;
   uint32_t visible_actual;
-
-  if (NULL == container) {
-    return;
-  }
+  uint32_t used = 0U;
 
   if ((NULL == conditions) || (0U == condition_count)) {
-    (void)create_condition_chip(container, get_condition_text(COMP_USER_CONDITION_NORMAL),
-                                CHIP_STYLE_NORMAL);
-    return;
-  }
-
-  visible_actual = condition_count;
-  if ((COMP_USER_CARD_MAX_VISIBLE_CHIPS > 0U) &&
-      (visible_actual > COMP_USER_CARD_MAX_VISIBLE_CHIPS)) {
-    visible_actual = COMP_USER_CARD_MAX_VISIBLE_CHIPS;
+    set_condition_chip(refs, used++, get_condition_text(COMP_USER_CONDITION_NORMAL),
+                       CHIP_STYLE_NORMAL);
+  } else {
+    visible_actual = condition_count;
+    if ((COMP_USER_CARD_MAX_VISIBLE_CHIPS > 0U) &&
+        (visible_actual > COMP_USER_CARD_MAX_VISIBLE_CHIPS)) {
+      visible_actual = COMP_USER_CARD_MAX_VISIBLE_CHIPS;
+    }
+
+    /* Keep visual width stable: reserve one rendered slot for "+N more". */
+    if ((condition_count > visible_actual) && (visible_actual > 0U) &&
+        (COMP_USER_CARD_ENABLE_MORE_CHIP != 0U) &&
+        (COMP_USER_CARD_MORE_CHIP_USES_VISIBLE_SLOT != 0U)) {
+      visible_actual -= 1U;
+    }
+    if (visible_actual > (CHIP_SLOT_COUNT - 1U)) {
+      visible_actual = CHIP_SLOT_COUNT - 1U;
+    }
+
+    for (i = 0U; i < visible_actual; i++) {
+      set_condition_chip(refs, used++, get_condition_text(conditions[i]),
+                         get_chip_style(conditions[i]));
+    }
+
+    if ((COMP_USER_CARD_ENABLE_MORE_CHIP != 0U) &&
+        (condition_count > visible_actual)) {
+      char more_text[24];
+      uint32_t remain_count = condition_count - visible_actual;
+
+      (void)snprintf(more_text, sizeof(more_text), "+%lu more",
+                     (unsigned long)remain_count);
+      set_condition_chip(refs, used++, more_text, CHIP_STYLE_MORE);
+    }
   }
 
-  /* Keep visual width stable: reserve one rendered slot for "+N more". */
-  if ((condition_count > visible_actual) && (visible_actual > 0U) &&
-      (COMP_USER_CARD_ENABLE_MORE_CHIP != 0U) &&
-      (COMP_USER_CARD_MORE_CHIP_USES_VISIBLE_SLOT != 0U)) {
-    visible_actual -= 1U;
-  }
-
-  for (i = 0U; i < visible_actual; i++) {
-    const char *text = get_condition_text(conditions[i]);
-    (void)create_condition_chip(container, text, get_chip_style(conditions[i]));
-  }
-
-  if ((COMP_USER_CARD_ENABLE_MORE_CHIP != 0U) &&
-      (condition_count > visible_actual)) {
-    char more_text[24];
-    uint32_t remain_count = condition_count - visible_actual;
-    lv_obj_t *more_chip;
-
-    (void)snprintf(more_text, sizeof(more_text), "+%lu more",
-                   (unsigned long)remain_count);
-    more_chip = create_condition_chip(container, more_text, CHIP_STYLE_MORE);
-    lv_obj_clear_flag(more_chip, LV_OBJ_FLAG_CLICKABLE);
+  for (i = used; i < CHIP_SLOT_COUNT; i++) {
+    (void)health_ui_int_subject_publish(&refs->chips[i].style,
+                                        (int32_t)CHIP_STYLE_HIDDEN);
   }
 }
 
-static void create_metric_panel(lv_obj_t *card,
-                                const comp_user_metric_preview_t *metric) {
+static void create_metric_panel(lv_obj_t *card, user_card_refs_t *refs) {
   lv_obj_t *panel;
   lv_obj_t *top_row;
   lv_obj_t *left_group;
@@ -279,7 +345,6 @@ static void create_metric_panel(lv_obj_t *card,
   lv_obj_clear_flag(icon_bg, LV_OBJ_FLAG_SCROLLABLE);
 
   icon_label = lv_label_create(icon_bg);
-  lv_label_set_text(icon_label, get_metric_icon_text(metric->type));
   lv_obj_set_style_text_color(
       icon_label, lv_color_hex(COMP_USER_CARD_METRIC_ICON_TEXT_COLOR_HEX),
       LV_PART_MAIN);
@@ -288,7 +353,6 @@ static void create_metric_panel(lv_obj_t *card,
   lv_obj_center(icon_label);
 
   title = lv_label_create(left_group);
-  lv_label_set_text(title, get_metric_title(metric->type));
   lv_label_set_long_mode(title, LV_LABEL_LONG_DOT);
   lv_obj_set_width(title, COMP_USER_CARD_METRIC_TITLE_MAX_WIDTH_PX);
   lv_obj_set_style_text_color(title, lv_color_hex(COMP_USER_CARD_METRIC_TITLE_COLOR_HEX),
@@ -297,7 +361,6 @@ static void create_metric_panel(lv_obj_t *card,
                              LV_PART_MAIN);
 
   time_label = lv_label_create(top_row);
-  lv_label_set_text(time_label, (NULL != metric->time_text) ? metric->time_text : "--:--");
   lv_label_set_long_mode(time_label, LV_LABEL_LONG_DOT);
   lv_obj_set_width(time_label, COMP_USER_CARD_METRIC_TIME_MIN_WIDTH_PX);
   lv_obj_set_style_text_align(time_label, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN);
@@ -332,7 +395,6 @@ static void create_metric_panel(lv_obj_t *card,
   lv_obj_clear_flag(value_group, LV_OBJ_FLAG_SCROLLABLE);
 
   value_label = lv_label_create(value_group);
-  lv_label_set_text(value_label, (NULL != metric->value_text) ? metric->value_text : "--");
   lv_obj_set_style_text_color(value_label,
                               lv_color_hex(COMP_USER_CARD_METRIC_VALUE_COLOR_HEX),
                               LV_PART_MAIN);
@@ -340,7 +402,6 @@ static void create_metric_panel(lv_obj_t *card,
                              LV_PART_MAIN);
 
   unit_label = lv_label_create(value_group);
-  lv_label_set_text(unit_label, (NULL != metric->unit_text) ? metric->unit_text : "");
   lv_obj_set_style_text_color(unit_label,
                               lv_color_hex(COMP_USER_CARD_METRIC_MUTED_COLOR_HEX),
                               LV_PART_MAIN);
@@ -366,20 +427,78 @@ static void create_metric_panel(lv_obj_t *card,
 
   dot_label = lv_label_create(status_group);
   lv_label_set_text(dot_label, LV_SYMBOL_BULLET);
-  lv_obj_set_style_text_color(dot_label, get_status_color(metric->status_level),
-                              LV_PART_MAIN);
   lv_obj_set_style_text_font(dot_label, COMP_USER_CARD_METRIC_STATUS_FONT,
                              LV_PART_MAIN);
 
   status_label = lv_label_create(status_group);
-  lv_label_set_text(status_label,
-                    (NULL != metric->status_text) ? metric->status_text : "Normal");
   /* Keep label content-sized so bullet can sit tight to the status text. */
   lv_label_set_long_mode(status_label, LV_LABEL_LONG_CLIP);
-  lv_obj_set_style_text_color(status_label, get_status_color(metric->status_level),
-                              LV_PART_MAIN);
   lv_obj_set_style_text_font(status_label, COMP_USER_CARD_METRIC_STATUS_FONT,
                              LV_PART_MAIN);
+
+  health_ui_text_subject_init(&refs->icon, "");
+  health_ui_text_subject_init(&refs->title, "");
+  health_ui_text_subject_init(&refs->time, "--:--");
+  health_ui_text_subject_init(&refs->value, "--");
+  health_ui_text_subject_init(&refs->unit, "");
+  health_ui_text_subject_init(&refs->status, "Normal");
+  lv_subject_init_int(&refs->status_level, (int32_t)COMP_USER_STATUS_NORMAL);
+  (void)health_ui_bind_label(icon_label, &refs->icon);
+  (void)health_ui_bind_label(title, &refs->title);
+  (void)health_ui_bind_label(time_label, &refs->time);
+  (void)health_ui_bind_label(value_label, &refs->value);
+  (void)health_ui_bind_label(unit_label, &refs->unit);
+  (void)health_ui_bind_label(status_label, &refs->status);
+  (void)lv_subject_add_observer_obj(&refs->status_level, on_status_level_changed,
+                                    dot_label, NULL);
+  (void)lv_subject_add_observer_obj(&refs->status_level, on_status_level_changed,
+                                    status_label, NULL);
+}
+
+static void bind_metric_panel(user_card_refs_t *refs,
+                              const comp_user_metric_preview_t *metric) {
+  (void)health_ui_text_subject_publish(&refs->icon,
+                                       get_metric_icon_text(metric->type));
+  (void)health_ui_text_subject_publish(&refs->title,
+                                       get_metric_title(metric->type));
+  (void)health_ui_text_subject_publish(
+      &refs->time, (NULL != metric->time_text) ? metric->time_text : "--:--");
+  (void)health_ui_text_subject_publish(
+      &refs->value, (NULL != metric->value_text) ? metric->value_text : "--");
+  (void)health_ui_text_subject_publish(
+      &refs->unit, (NULL != metric->unit_text) ? metric->unit_text : "");
+  (void)health_ui_text_subject_publish(
+      &refs->status,
+      (NULL != metric->status_text) ? metric->status_text : "Normal");
+  (void)health_ui_int_subject_publish(&refs->status_level,
+                                      (int32_t)metric->status_level);
+}
+
+static void deinit_subjects(user_card_refs_t *refs) {
+  uint32_t i;
+
+  lv_subject_deinit(&refs->avatar_bg_color);
+  health_ui_text_subject_deinit(&refs->name);
+  for (i = 0U; i < CHIP_SLOT_COUNT; i++) {
+    health_ui_text_subject_deinit(&refs->chips[i].text);
+    lv_subject_deinit(&refs->chips[i].style);
+  }
+  health_ui_text_subject_deinit(&refs->icon);
+  health_ui_text_subject_deinit(&refs->title);
+  health_ui_text_subject_deinit(&refs->time);
+  health_ui_text_subject_deinit(&refs->value);
+  health_ui_text_subject_deinit(&refs->unit);
+  health_ui_text_subject_deinit(&refs->status);
+  lv_subject_deinit(&refs->status_level);
+}
+
+static void on_user_card_deleted(lv_event_t *e) {
+  user_card_refs_t *refs = (user_card_refs_t *)lv_event_get_user_data(e);
+  if (NULL != refs) {
+    /* Sent before the children go: detach their observers, then free. */
+    deinit_subjects(refs);
+    lv_free(refs);
+  }
 }
 
 lv_obj_t *comp_user_card_create(lv_obj_t *parent,
@@ -388,32 +507,16 @@ lv_obj_t *comp_user_card_create(lv_obj_t *parent,
   lv_obj_t *avatar;
   lv_obj_t *name_label;
   lv_obj_t *chip_row;
-  const char *name_text = "Member";
-  comp_user_metric_preview_t metric = {
-      .type = COMP_USER_METRIC_BLOOD_PRESSURE,
-      .value_text = "--",
-      .unit_text = "",
-      .status_text = "Normal",
-      .time_text = "--:--",
-      .status_level = COMP_USER_STATUS_NORMAL,
-  };
-  uint32_t avatar_bg = COMP_USER_CARD_AVATAR_BG_COLOR_HEX;
-  const comp_user_condition_t *conditions = NULL;
-  uint32_t condition_count = 0U;
+  user_card_refs_t *refs;
+  uint32_t i;
 
   if (NULL == parent) {
     return NULL;
   }
 
-  if (NULL != data) {
-    name_text = (NULL != data->name) ? data->name : name_text;
-    /* Card background is intentionally fixed by UX spec in this phase. */
-    (void)data->card_bg_color_hex;
-    avatar_bg = (0U != data->avatar_bg_color_hex) ? data->avatar_bg_color_hex
-                                                   : avatar_bg;
-    conditions = data->conditions;
-    condition_count = data->condition_count;
-    metric = data->metric;
+  refs = (user_card_refs_t *)lv_malloc_zeroed(sizeof(*refs));
+  if (NULL == refs) {
+    return NULL;
   }
 
   card = lv_obj_create(parent);
@@ -441,7 +544,6 @@ lv_obj_t *comp_user_card_create(lv_obj_t *parent,
   lv_obj_set_size(avatar, COMP_USER_CARD_AVATAR_SIZE_PX,
                   COMP_USER_CARD_AVATAR_SIZE_PX);
   lv_obj_set_style_radius(avatar, LV_RADIUS_CIRCLE, LV_PART_MAIN);
-  lv_obj_set_style_bg_color(avatar, lv_color_hex(avatar_bg), LV_PART_MAIN);
   lv_obj_set_style_bg_opa(avatar, LV_OPA_COVER, LV_PART_MAIN);
   lv_obj_set_style_border_width(avatar, 0, LV_PART_MAIN);
   lv_obj_set_style_shadow_width(avatar, 0, LV_PART_MAIN);
@@ -451,7 +553,6 @@ lv_obj_t *comp_user_card_create(lv_obj_t *parent,
   lv_obj_clear_flag(avatar, LV_OBJ_FLAG_SCROLLABLE);
 
   name_label = lv_label_create(card);
-  lv_label_set_text(name_label, name_text);
   lv_label_set_long_mode(name_label, LV_LABEL_LONG_DOT);
   lv_obj_set_width(name_label, lv_pct(100));
   lv_obj_set_style_text_align(name_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
@@ -473,8 +574,60 @@ lv_obj_t *comp_user_card_create(lv_obj_t *parent,
                         LV_FLEX_ALIGN_CENTER);
   lv_obj_clear_flag(chip_row, LV_OBJ_FLAG_SCROLLABLE);
 
-  populate_conditions(chip_row, conditions, condition_count);
-  create_metric_panel(card, &metric);
+  lv_subject_init_int(&refs->avatar_bg_color,
+                      (int32_t)COMP_USER_CARD_AVATAR_BG_COLOR_HEX);
+  health_ui_text_subject_init(&refs->name, "Member");
+  (void)health_ui_bind_bg_color(avatar, &refs->avatar_bg_color);
+  (void)health_ui_bind_label(name_label, &refs->name);
+  for (i = 0U; i < CHIP_SLOT_COUNT; i++) {
+    create_condition_chip(chip_row, &refs->chips[i]);
+  }
+  create_metric_panel(card, refs);
+
+  lv_obj_set_user_data(card, refs);
+  lv_obj_add_event_cb(card, on_user_card_deleted, LV_EVENT_DELETE, refs);
 
+  comp_user_card_bind(card, data);
   return card;
 }
+
+void comp_user_card_bind(lv_obj_t *card, const comp_user_card_data_t *data) {
+  user_card_refs_t *refs;
+  const char *name_text = "Member";
+  comp_user_metric_preview_t metric = {
+      .type = COMP_USER_METRIC_BLOOD_PRESSURE,
+      .value_text = "--",
+      .unit_text = "",
+      .status_text = "Normal",
+      .time_text = "--:--",
+      .status_level = COMP_USER_STATUS_NORMAL,
+  };
+  uint32_t avatar_bg = COMP_USER_CARD_AVATAR_BG_COLOR_HEX;
+  const comp_user_condition_t *conditions = NULL;
+  uint32_t condition_count = 0U;
+
+  if (NULL == card) {
+    return;
+  }
+
+  refs = (user_card_refs_t *)lv_obj_get_user_data(card);
+  if (NULL == refs) {
+    return;
+  }
+
+  if (NULL != data) {
+    name_text = (NULL != data->name) ? data->name : name_text;
+    /* Card background is intentionally fixed by UX spec in this phase. */
+    (void)data->card_bg_color_hex;
+    avatar_bg = (0U != data->avatar_bg_color_hex) ? data->avatar_bg_color_hex
+                                                   : avatar_bg;
+    conditions = data->conditions;
+    condition_count = data->condition_count;
+    metric = data->metric;
+  }
+
+  (void)health_ui_int_subject_publish(&refs->avatar_bg_color, (int32_t)avatar_bg);
+  (void)health_ui_text_subject_publish(&refs->name, name_text);
+  populate_conditions(refs, conditions, condition_count);
+  bind_metric_panel(refs, &metric);
+}
@@ -8,11 +8,7 @@
 #include "../../layout/layout_fonts.h"
 
 #ifndef COMP_USER_CARD_WIDTH_PCT
-#if (MY_DISP_HOR_RES >= 1024)
-#define COMP_USER_CARD_WIDTH_PCT (24)
-#else
-#define COMP_USER_CARD_WIDTH_PCT (31)
-#endif
+#define COMP_USER_CARD_WIDTH_PCT (HL_VIEWPORT_IS_WIDE ? 24 : 31)
 #endif
 
 #ifndef COMP_USER_CARD_RADIUS_PX
@@ -306,4 +302,9 @@ typedef struct {
 lv_obj_t *comp_user_card_create(lv_obj_t *parent,
                                 const comp_user_card_data_t *data);
 
+/* Rebind an existing card to new data without recreating its children
+ * (used by recycling carousels). The card's user data is owned by the card;
+ * its widgets are bound to per-card subjects, so only changed fields redraw. */
+void comp_user_card_bind(lv_obj_t *card, const comp_user_card_data_t *data);
+
 #endif
@@ -0,0 +1,241 @@
+#include "comp_virtual_carousel.h"
+
+#include <limits.h>
+#include <string.h>
+
+static uint32_t clamp_first_page(const comp_virtual_carousel_t *vc,
+                                 uint32_t page_index) {
+  uint32_t first = (page_index > 0U) ? (page_index - 1U) : 0U;
+
+  if ((first + vc->slot_count) > vc->page_count) {
+    first = vc->page_count - vc->slot_count;
+  }
+
+  return first;
+}
+
+static void notify_page(comp_virtual_carousel_t *vc, uint32_t page_index) {
+  vc->active_page = page_index;
+  if (NULL != vc->page_cb) {
+    vc->page_cb(page_index, vc->user_data);
+  }
+}
+
+static void bind_slot(comp_virtual_carousel_t *vc, uint32_t pos) {
+  if (NULL != vc->bind_cb) {
+    vc->bind_cb(vc->slots[pos], vc->slot_ids[pos], vc->first_page + pos,
+                vc->user_data);
+  }
+}
+
+static void scroll_to_slot(comp_virtual_carousel_t *vc, uint32_t pos) {
+  /* Slot order just changed; coordinates must be current before scrolling. */
+  lv_obj_update_layout(vc->carousel);
+  lv_obj_scroll_to_view(vc->slots[pos], LV_ANIM_OFF);
+}
+
+static uint32_t get_nearest_slot(const comp_virtual_carousel_t *vc) {
+  uint32_t i;
+  uint32_t nearest_pos = 0U;
+  int32_t nearest_distance = INT_MAX;
+  lv_area_t carousel_coords;
+  int32_t viewport_center_x;
+
+  lv_obj_get_coords(vc->carousel, &carousel_coords);
+  viewport_center_x =
+      carousel_coords.x1 + ((carousel_coords.x2 - carousel_coords.x1) / 2);
+
+  for (i = 0U; i < vc->slot_count; i++) {
+    lv_area_t slot_coords;
+    int32_t distance;
+
+    lv_obj_get_coords(vc->slots[i], &slot_coords);
+    distance = slot_coords.x1 + ((slot_coords.x2 - slot_coords.x1) / 2) -
+               viewport_center_x;
+    if (distance < 0) {
+      distance = -distance;
+    }
+    if (distance < nearest_distance) {
+      nearest_distance = distance;
+      nearest_pos = i;
+    }
+  }
+
+  return nearest_pos;
+}
+
+/* Move the window so that page_index sits in a middle slot. Slots that keep
+ * showing the same page are only reordered; the others are rebound. */
+static void shift_window(comp_virtual_carousel_t *vc, uint32_t page_index) {
+  lv_obj_t *old_slots[COMP_VIRTUAL_CAROUSEL_SLOT_COUNT];
+  uint32_t old_ids[COMP_VIRTUAL_CAROUSEL_SLOT_COUNT];
+  bool reused[COMP_VIRTUAL_CAROUSEL_SLOT_COUNT] = {false};
+  bool kept[COMP_VIRTUAL_CAROUSEL_SLOT_COUNT] = {false};
+  uint32_t new_first = clamp_first_page(vc, page_index);
+  uint32_t spare = 0U;
+  uint32_t pos;
+
+  if (new_first == vc->first_page) {
+    return;
+  }
+
+  (void)memcpy(old_slots, vc->slots, sizeof(old_slots));
+  (void)memcpy(old_ids, vc->slot_ids, sizeof(old_ids));
+
+  for (pos = 0U; pos < vc->slot_count; pos++) {
+    uint32_t page = new_first + pos;
+    if ((page >= vc->first_page) && (page < (vc->first_page + vc->slot_count))) {
+      uint32_t src = page - vc->first_page;
+      vc->slots[pos] = old_slots[src];
+      vc->slot_ids[pos] = old_ids[src];
+      reused[src] = true;
+      kept[pos] = true;
+    }
+  }
+
+  for (pos = 0U; pos < vc->slot_count; pos++) {
+    if (kept[pos]) {
+      continue;
+    }
+    while (reused[spare]) {
+      spare++;
+    }
+    vc->slots[pos] = old_slots[spare];
+    vc->slot_ids[pos] = old_ids[spare];
+    reused[spare] = true;
+  }
+
+  vc->first_page = new_first;
+  for (pos = 0U; pos < vc->slot_count; pos++) {
+    lv_obj_move_to_index(vc->slots[pos], (int32_t)pos);
+    if (!kept[pos]) {
+      bind_slot(vc, pos);
+    }
+  }
+}
+
+static void on_carousel_scroll(lv_event_t *e) {
+  comp_virtual_carousel_t *vc =
+      (comp_virtual_carousel_t *)lv_event_get_user_data(e);
+  uint32_t page_index;
+
+  if ((NULL == vc) || (NULL == vc->carousel) || (0U == vc->slot_count) ||
+      vc->recentering) {
+    return;
+  }
+
+  page_index = vc->first_page + get_nearest_slot(vc);
+  if (lv_event_get_code(e) == LV_EVENT_SCROLL_END) {
+    vc->recentering = true;
+    shift_window(vc, page_index);
+    scroll_to_slot(vc, page_index - vc->first_page);
+    vc->recentering = false;
+  }
+
+  if (page_index != vc->active_page) {
+    notify_page(vc, page_index);
+  }
+}
+
+static void on_carousel_deleted(lv_event_t *e) {
+  comp_virtual_carousel_t *vc =
+      (comp_virtual_carousel_t *)lv_event_get_user_data(e);
+
+  if (NULL != vc) {
+    vc->carousel = NULL;
+    vc->slot_count = 0U;
+  }
+}
+
+void comp_virtual_carousel_init(comp_virtual_carousel_t *vc, lv_obj_t *carousel,
+                                comp_virtual_carousel_create_cb_t create_cb,
+                                comp_virtual_carousel_bind_cb_t bind_cb,
+                                comp_virtual_carousel_page_cb_t page_cb,
+                                void *user_data) {
+  if ((NULL == vc) || (NULL == carousel)) {
+    return;
+  }
+
+  (void)memset(vc, 0, sizeof(*vc));
+  vc->carousel = carousel;
+  vc->create_cb = create_cb;
+  vc->bind_cb = bind_cb;
+  vc->page_cb = page_cb;
+  vc->user_data = user_data;
+
+  lv_obj_add_event_cb(carousel, on_carousel_scroll, LV_EVENT_SCROLL, vc);
+  lv_obj_add_event_cb(carousel, on_carousel_scroll, LV_EVENT_SCROLL_END, vc);
+  lv_obj_add_event_cb(carousel, on_carousel_deleted, LV_EVENT_DELETE, vc);
+}
+
+void comp_virtual_carousel_set_page_count(comp_virtual_carousel_t *vc,
+                                          uint32_t page_count) {
+  uint32_t slot_count;
+  uint32_t i;
+
+  if ((NULL == vc) || (NULL == vc->carousel)) {
+    return;
+  }
+
+  slot_count = (page_count < COMP_VIRTUAL_CAROUSEL_SLOT_COUNT)
+                   ? page_count
+                   : COMP_VIRTUAL_CAROUSEL_SLOT_COUNT;
+
+  if (slot_count != vc->slot_count) {
+    /* Only small page counts change the slot count; rebuild those outright.
+     * slot_count is cleared first: deleting slots can emit scroll events. */
+    vc->slot_count = 0U;
+    lv_obj_clean(vc->carousel);
+    for (i = 0U; i < slot_count; i++) {
+      lv_obj_t *slot = (NULL != vc->create_cb)
+                           ? vc->create_cb(vc->carousel, i, vc->user_data)
+                           : NULL;
+      if (NULL == slot) {
+        break;
+      }
+      vc->slots[i] = slot;
+      vc->slot_ids[i] = i;
+      vc->slot_count++;
+    }
+  }
+
+  vc->page_count = page_count;
+  vc->first_page = 0U;
+  comp_virtual_carousel_refresh(vc);
+
+  if (vc->slot_count > 0U) {
+    vc->recentering = true;
+    scroll_to_slot(vc, 0U);
+    vc->recentering = false;
+  }
+  notify_page(vc, 0U);
+}
+
+void comp_virtual_carousel_refresh(comp_virtual_carousel_t *vc) {
+  uint32_t pos;
+
+  if ((NULL == vc) || (NULL == vc->carousel)) {
+    return;
+  }
+
+  for (pos = 0U; pos < vc->slot_count; pos++) {
+    bind_slot(vc, pos);
+  }
+}
+
+void comp_virtual_carousel_show_page(comp_virtual_carousel_t *vc,
+                                     uint32_t page_index) {
+  if ((NULL == vc) || (NULL == vc->carousel) || (0U == vc->slot_count)) {
+    return;
+  }
+
+  if (page_index >= vc->page_count) {
+    page_index = vc->page_count - 1U;
+  }
+
+  vc->recentering = true;
+  shift_window(vc, page_index);
+  scroll_to_slot(vc, page_index - vc->first_page);
+  vc->recentering = false;
+  notify_page(vc, page_index);
+}
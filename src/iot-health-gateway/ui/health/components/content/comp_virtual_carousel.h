@@ -0,0 +1,73 @@
+#ifndef COMP_VIRTUAL_CAROUSEL_H
+#define COMP_VIRTUAL_CAROUSEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+/*
+ * Recycling horizontal pager. Only the active page and its neighbours exist
+ * as slot objects; when a scroll settles on an edge slot, the slot that fell
+ * out of the window is moved to the other side and rebound to the next page.
+ * The object count is therefore fixed no matter how many pages there are.
+ *
+ * The carousel object keeps its own flex/snap styling (one full-width slot
+ * per page, LV_SCROLL_SNAP_START, LV_OBJ_FLAG_SCROLL_ONE).
+ */
+
+#ifndef COMP_VIRTUAL_CAROUSEL_SLOT_COUNT
+/* Active page plus one neighbour on each side. */
+#define COMP_VIRTUAL_CAROUSEL_SLOT_COUNT (3U)
+#endif
+
+/* Create an empty slot (a full-width page container) inside carousel.
+ * slot_id is stable for the lifetime of the slot and < SLOT_COUNT. */
+typedef lv_obj_t *(*comp_virtual_carousel_create_cb_t)(lv_obj_t *carousel,
+                                                        uint32_t slot_id,
+                                                        void *user_data);
+
+/* Fill an existing slot with the items of page_index. */
+typedef void (*comp_virtual_carousel_bind_cb_t)(lv_obj_t *slot, uint32_t slot_id,
+                                                uint32_t page_index,
+                                                void *user_data);
+
+/* Active page changed (while scrolling, and after a rebind). */
+typedef void (*comp_virtual_carousel_page_cb_t)(uint32_t active_page,
+                                                void *user_data);
+
+typedef struct {
+  lv_obj_t *carousel;
+  comp_virtual_carousel_create_cb_t create_cb;
+  comp_virtual_carousel_bind_cb_t bind_cb;
+  comp_virtual_carousel_page_cb_t page_cb;
+  void *user_data;
+  /* Slots in on-screen order; slots[i] shows page first_page + i. */
+  lv_obj_t *slots[COMP_VIRTUAL_CAROUSEL_SLOT_COUNT];
+  uint32_t slot_ids[COMP_VIRTUAL_CAROUSEL_SLOT_COUNT];
+  uint32_t slot_count;
+  uint32_t page_count;
+  uint32_t first_page;
+  uint32_t active_page;
+  bool recentering;
+} comp_virtual_carousel_t;
+
+void comp_virtual_carousel_init(comp_virtual_carousel_t *vc, lv_obj_t *carousel,
+                                comp_virtual_carousel_create_cb_t create_cb,
+                                comp_virtual_carousel_bind_cb_t bind_cb,
+                                comp_virtual_carousel_page_cb_t page_cb,
+                                void *user_data);
+
+/* Resize the page range and show page 0. Slots are only recreated when the
+ * number of slots changes (fewer than SLOT_COUNT pages); otherwise rebound. */
+void comp_virtual_carousel_set_page_count(comp_virtual_carousel_t *vc,
+                                          uint32_t page_count);
+
+/* Rebind the materialized slots after the underlying data changed. */
+void comp_virtual_carousel_refresh(comp_virtual_carousel_t *vc);
+
+/* Jump to page_index (clamped), rebinding the window around it. */
+void comp_virtual_carousel_show_page(comp_virtual_carousel_t *vc,
+                                     uint32_t page_index);
+
+#endif
@@ -1,22 +1,21 @@
 #include "comp_system_status_bar.h"
 
+#include "../../health_ui_binding.h"
 #include "../../layout/layout_tokens.h"
 
-#include <stdio.h>
-#include <string.h>
-
 static lv_obj_t *s_status_root = NULL;
 static lv_obj_t *s_status_shell = NULL;
 static lv_obj_t *s_wifi_icon = NULL;
 static lv_obj_t *s_bt_icon = NULL;
 static lv_obj_t *s_time_label = NULL;
 static lv_obj_t *s_date_label = NULL;
-static bool s_wifi_known = false;
-static bool s_bt_known = false;
-static bool s_wifi_cached = false;
-static bool s_bt_cached = false;
-static char s_time_cache[COMP_STATUS_BAR_TEXT_CACHE_SIZE];
-static char s_date_cache[COMP_STATUS_BAR_TEXT_CACHE_SIZE];
+/* Published status values; the widgets are bound to them, so a value that
+ * did not change since the last update touches nothing on screen. */
+static bool s_subjects_ready = false;
+static lv_subject_t s_wifi_subject; /* -1 unknown, 0/1 connected */
+static lv_subject_t s_bt_subject;
+static health_ui_text_subject_t s_time_subject;
+static health_ui_text_subject_t s_date_subject;
 
 static void set_status_text_style(lv_obj_t *label, const lv_font_t *font) {
   if (NULL == label) {
@@ -71,33 +70,25 @@ static void set_icon_state(lv_obj_t *icon, bool connected) {
   lv_obj_set_style_text_color(icon, color, LV_PART_MAIN);
 }
 
-static void update_icon_if_changed(lv_obj_t *icon, bool connected, bool *known,
-                                   bool *cached) {
-  if ((NULL == icon) || (NULL == known) || (NULL == cached)) {
-    return;
-  }
+static void on_icon_state_changed(lv_observer_t *observer,
+                                  lv_subject_t *subject) {
+  int32_t state = lv_subject_get_int(subject);
 
-  if ((*known) && (*cached == connected)) {
-    return;
+  if (state >= 0) {
+    set_icon_state(lv_observer_get_target_obj(observer), state != 0);
   }
-
-  set_icon_state(icon, connected);
-  *known = true;
-  *cached = connected;
 }
 
-static void update_label_if_changed(lv_obj_t *label, char *cache,
-                                    const char *next_text) {
-  if ((NULL == label) || (NULL == cache) || (NULL == next_text)) {
+static void init_subjects_once(void) {
+  if (s_subjects_ready) {
     return;
   }
 
-  if (0 == strcmp(cache, next_text)) {
-    return;
-  }
-
-  (void)snprintf(cache, COMP_STATUS_BAR_TEXT_CACHE_SIZE, "%s", next_text);
-  lv_label_set_text(label, cache);
+  lv_subject_init_int(&s_wifi_subject, -1);
+  lv_subject_init_int(&s_bt_subject, -1);
+  health_ui_text_subject_init(&s_time_subject, "");
+  health_ui_text_subject_init(&s_date_subject, "");
+  s_subjects_ready = true;
 }
 
 void comp_system_status_bar_create(void) {
@@ -162,11 +153,14 @@ void comp_system_status_bar_create(void) {
   lv_obj_set_style_pad_right(s_date_label, COMP_STATUS_BAR_DATE_TEXT_RIGHT_INSET_PX,
                              LV_PART_MAIN);
 
-  /* Reset cache so first update always paints all fields. */
-  s_wifi_known = false;
-  s_bt_known = false;
-  s_time_cache[0] = '\0';
-  s_date_cache[0] = '\0';
+  /* Binding paints the current values; observers go away with the labels. */
+  init_subjects_once();
+  (void)lv_subject_add_observer_obj(&s_wifi_subject, on_icon_state_changed,
+                                    s_wifi_icon, NULL);
+  (void)lv_subject_add_observer_obj(&s_bt_subject, on_icon_state_changed,
+                                    s_bt_icon, NULL);
+  (void)health_ui_bind_label(s_time_label, &s_time_subject);
+  (void)health_ui_bind_label(s_date_label, &s_date_subject);
   comp_system_status_bar_update(&initial_state);
 }
 
@@ -198,16 +192,23 @@ void comp_system_status_bar_update(const comp_system_status_bar_state_t *state)
     return;
   }
 
+  init_subjects_once();
+
   if (state->wifi_valid) {
-    update_icon_if_changed(s_wifi_icon, state->wifi_connected, &s_wifi_known,
-                           &s_wifi_cached);
+    (void)health_ui_int_subject_publish(&s_wifi_subject,
+                                        state->wifi_connected ? 1 : 0);
   }
 
   if (state->bt_valid) {
-    update_icon_if_changed(s_bt_icon, state->bt_connected, &s_bt_known,
-                           &s_bt_cached);
+    (void)health_ui_int_subject_publish(&s_bt_subject,
+                                        state->bt_connected ? 1 : 0);
   }
 
-  update_label_if_changed(s_time_label, s_time_cache, state->time_text);
-  update_label_if_changed(s_date_label, s_date_cache, state->date_text);
+  /* NULL text leaves the field as it is (partial updates). */
+  if (NULL != state->time_text) {
+    (void)health_ui_text_subject_publish(&s_time_subject, state->time_text);
+  }
+  if (NULL != state->date_text) {
+    (void)health_ui_text_subject_publish(&s_date_subject, state->date_text);
+  }
 }
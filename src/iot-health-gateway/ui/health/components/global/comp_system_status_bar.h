@@ -44,11 +44,7 @@
 #define COMP_STATUS_BAR_DATE_TEXT_RIGHT_INSET_PX (6)
 #endif
 
-/* Text/cache/font tuning knobs for system status bar. */
-#ifndef COMP_STATUS_BAR_TEXT_CACHE_SIZE
-#define COMP_STATUS_BAR_TEXT_CACHE_SIZE (24U)
-#endif
-
+/* Font tuning knobs for system status bar. */
 #ifndef COMP_STATUS_BAR_FONT
 #define COMP_STATUS_BAR_FONT HL_FONT_CAPTION
 #endif
@@ -1,5 +1,6 @@
 #include "comp_tab_menu.h"
 
+#include "../../health_ui_binding.h"
 #include "../../layout/layout_tokens.h"
 
 #include <stdbool.h>
@@ -11,95 +12,27 @@ typedef enum {
   ICON_STYLE_PLAIN = 2
 } icon_style_t;
 
-static lv_obj_t *s_health_title_label = NULL;
-static lv_obj_t *s_home_title_label = NULL;
-static char s_health_title_text[COMP_TAB_MENU_TITLE_BUF_SIZE] = "Zac's Family : 6";
-static char s_home_title_text[COMP_TAB_MENU_TITLE_BUF_SIZE] = "Zac's Home";
-static char s_user_detail_name_text[COMP_TAB_MENU_USER_NAME_BUF_SIZE] = "Member";
-static char s_user_detail_age_text[COMP_TAB_MENU_USER_AGE_BUF_SIZE] = "Age: --";
-static uint32_t s_user_detail_avatar_bg_color_hex = COMP_TAB_MENU_AVATAR_BG_COLOR_HEX;
-
-#define COMP_TAB_MENU_USER_PROFILE_BINDING_MAX (16U)
-typedef struct {
-  lv_obj_t *avatar;
-  lv_obj_t *name_label;
-  lv_obj_t *age_label;
-} user_profile_binding_t;
-
-static user_profile_binding_t
-    s_user_profile_bindings[COMP_TAB_MENU_USER_PROFILE_BINDING_MAX] = {0};
-static uint32_t s_user_profile_binding_count = 0U;
-
-static bool is_valid_obj(const lv_obj_t *obj) {
-  return ((NULL != obj) && lv_obj_is_valid((lv_obj_t *)obj));
-}
-
-static void update_label_if_valid(lv_obj_t **label_ref, const char *text) {
-  if ((NULL == label_ref) || (NULL == text)) {
-    return;
-  }
-
-  if (is_valid_obj(*label_ref)) {
-    lv_label_set_text(*label_ref, text);
-  } else {
-    *label_ref = NULL;
-  }
-}
-
-static void update_bg_color_if_valid(lv_obj_t **obj_ref, uint32_t color_hex) {
-  if (NULL == obj_ref) {
+/* Menus are recreated on page switches; their labels bind to these subjects,
+ * so a publish reaches every live instance and new ones start current. */
+static bool s_subjects_ready = false;
+static health_ui_text_subject_t s_health_title_subject;
+static health_ui_text_subject_t s_home_title_subject;
+static health_ui_text_subject_t s_user_name_subject;
+static health_ui_text_subject_t s_user_age_subject;
+static lv_subject_t s_user_avatar_bg_color_subject; /* 0xRRGGBB */
+
+static void init_subjects_once(void) {
+  if (s_subjects_ready) {
     return;
   }
 
-  if (is_valid_obj(*obj_ref)) {
-    lv_obj_set_style_bg_color(*obj_ref, lv_color_hex(color_hex), LV_PART_MAIN);
-  } else {
-    *obj_ref = NULL;
-  }
-}
-
-static void compact_user_profile_bindings(void) {
-  uint32_t read_idx;
-  uint32_t write_idx = 0U;
-
-  for (read_idx = 0U; read_idx < s_user_profile_binding_count; read_idx++) {
-    user_profile_binding_t slot = s_user_profile_bindings[read_idx];
-    bool alive = is_valid_obj(slot.avatar) || is_valid_obj(slot.name_label) ||
-                 is_valid_obj(slot.age_label);
-
-    if (!alive) {
-      continue;
-    }
-
-    if (write_idx != read_idx) {
-      s_user_profile_bindings[write_idx] = slot;
-    }
-    write_idx++;
-  }
-
-  while (write_idx < s_user_profile_binding_count) {
-    s_user_profile_bindings[write_idx].avatar = NULL;
-    s_user_profile_bindings[write_idx].name_label = NULL;
-    s_user_profile_bindings[write_idx].age_label = NULL;
-    write_idx++;
-  }
-
-  s_user_profile_binding_count = write_idx;
-}
-
-static void register_user_profile_binding(lv_obj_t *avatar, lv_obj_t *name_label,
-                                          lv_obj_t *age_label) {
-  user_profile_binding_t *slot;
-
-  compact_user_profile_bindings();
-  if (s_user_profile_binding_count >= COMP_TAB_MENU_USER_PROFILE_BINDING_MAX) {
-    return;
-  }
-
-  slot = &s_user_profile_bindings[s_user_profile_binding_count++];
-  slot->avatar = avatar;
-  slot->name_label = name_label;
-  slot->age_label = age_label;
+  health_ui_text_subject_init(&s_health_title_subject, "Zac's Family : 6");
+  health_ui_text_subject_init(&s_home_title_subject, "Zac's Home");
+  health_ui_text_subject_init(&s_user_name_subject, "Member");
+  health_ui_text_subject_init(&s_user_age_subject, "Age: --");
+  lv_subject_init_int(&s_user_avatar_bg_color_subject,
+                      (int32_t)COMP_TAB_MENU_AVATAR_BG_COLOR_HEX);
+  s_subjects_ready = true;
 }
 
 static void add_event_bubble_recursive(lv_obj_t *obj) {
@@ -248,13 +181,9 @@ static void create_main_menu(lv_obj_t *menu, comp_tab_menu_mode_t mode,
   (void)create_icon_chip(left, LV_SYMBOL_HOME, ICON_STYLE_HOME_CHIP);
 
   title = lv_label_create(left);
-  if (mode == COMP_TAB_MENU_MODE_MAIN_HOME) {
-    s_home_title_label = title;
-    lv_label_set_text(title, s_home_title_text);
-  } else {
-    s_health_title_label = title;
-    lv_label_set_text(title, s_health_title_text);
-  }
+  (void)health_ui_bind_label(title, (mode == COMP_TAB_MENU_MODE_MAIN_HOME)
+                                        ? &s_home_title_subject
+                                        : &s_health_title_subject);
   lv_obj_set_style_text_color(title, lv_color_hex(COMP_TAB_MENU_TEXT_COLOR_HEX),
                               LV_PART_MAIN);
   lv_obj_set_style_text_font(title, COMP_TAB_MENU_TEXT_FONT, LV_PART_MAIN);
@@ -368,8 +297,7 @@ static void create_user_menu(lv_obj_t *menu, comp_tab_menu_refs_t *out_refs,
   lv_obj_set_size(avatar, COMP_TAB_MENU_AVATAR_SIZE_PX,
                   COMP_TAB_MENU_AVATAR_SIZE_PX);
   lv_obj_set_style_radius(avatar, COMP_TAB_MENU_AVATAR_RADIUS_PX, LV_PART_MAIN);
-  lv_obj_set_style_bg_color(avatar, lv_color_hex(s_user_detail_avatar_bg_color_hex),
-                            LV_PART_MAIN);
+  (void)health_ui_bind_bg_color(avatar, &s_user_avatar_bg_color_subject);
   lv_obj_set_style_border_width(avatar, 0, LV_PART_MAIN);
   lv_obj_set_style_pad_all(avatar, 0, LV_PART_MAIN);
   lv_obj_clear_flag(avatar, LV_OBJ_FLAG_SCROLLABLE);
@@ -393,17 +321,16 @@ static void create_user_menu(lv_obj_t *menu, comp_tab_menu_refs_t *out_refs,
   lv_obj_clear_flag(name_col, LV_OBJ_FLAG_SCROLLABLE);
 
   name = lv_label_create(name_col);
-  lv_label_set_text(name, s_user_detail_name_text);
+  (void)health_ui_bind_label(name, &s_user_name_subject);
   lv_obj_set_style_text_color(name, lv_color_hex(COMP_TAB_MENU_TEXT_COLOR_HEX),
                               LV_PART_MAIN);
   lv_obj_set_style_text_font(name, COMP_TAB_MENU_TEXT_FONT, LV_PART_MAIN);
 
   age = lv_label_create(name_col);
-  lv_label_set_text(age, s_user_detail_age_text);
+  (void)health_ui_bind_label(age, &s_user_age_subject);
   lv_obj_set_style_text_color(age, lv_color_hex(COMP_TAB_MENU_TEXT_COLOR_HEX),
                               LV_PART_MAIN);
   lv_obj_set_style_text_font(age, COMP_TAB_MENU_TEXT_FONT, LV_PART_MAIN);
-  register_user_profile_binding(avatar, name, age);
 
   add_event_bubble_recursive(left);
 
@@ -427,6 +354,7 @@ lv_obj_t *comp_tab_menu_create(lv_obj_t *parent, comp_tab_menu_mode_t mode,
     return NULL;
   }
 
+  init_subjects_once();
   refs = (NULL != out_refs) ? out_refs : &local_refs;
   refs->btn_health = NULL;
   refs->btn_home = NULL;
@@ -466,51 +394,41 @@ lv_obj_t *comp_tab_menu_create(lv_obj_t *parent, comp_tab_menu_mode_t mode,
   return menu;
 }
 
-void comp_tab_menu_set_family_summary(const char *family_name,
-                                      uint32_t member_count) {
+void comp_tab_menu_publish_family_summary(const char *family_name,
+                                          uint32_t member_count) {
+  char text[HEALTH_UI_BINDING_TEXT_SIZE];
   const char *name;
 
+  init_subjects_once();
   name = ((NULL != family_name) && (family_name[0] != '\0')) ? family_name
                                                               : "Family";
-  /* Keep both labels synchronized so mode switches never show stale family text. */
-  (void)snprintf(s_health_title_text, sizeof(s_health_title_text), "%s : %lu",
-                 name, (unsigned long)member_count);
-  (void)snprintf(s_home_title_text, sizeof(s_home_title_text), "%s Home", name);
-
-  /* Menu instances are recreated during page switches; validate before writing. */
-  update_label_if_valid(&s_health_title_label, s_health_title_text);
-  update_label_if_valid(&s_home_title_label, s_home_title_text);
+  /* Publish both titles so mode switches never show stale family text. */
+  (void)snprintf(text, sizeof(text), "%s : %lu", name,
+                 (unsigned long)member_count);
+  (void)health_ui_text_subject_publish(&s_health_title_subject, text);
+  (void)snprintf(text, sizeof(text), "%s Home", name);
+  (void)health_ui_text_subject_publish(&s_home_title_subject, text);
 }
 
-void comp_tab_menu_set_user_detail_profile(const char *user_name,
-                                           uint32_t age_years,
-                                           uint32_t avatar_bg_color_hex) {
-  uint32_t i;
+void comp_tab_menu_publish_user_detail_profile(const char *user_name,
+                                               uint32_t age_years,
+                                               uint32_t avatar_bg_color_hex) {
+  char age_text[HEALTH_UI_BINDING_TEXT_SIZE];
   const char *name;
 
+  init_subjects_once();
   name = ((NULL != user_name) && (user_name[0] != '\0')) ? user_name : "Member";
-
-  (void)snprintf(s_user_detail_name_text, sizeof(s_user_detail_name_text), "%s",
-                 name);
   if (age_years > 0U) {
-    (void)snprintf(s_user_detail_age_text, sizeof(s_user_detail_age_text),
-                   "Age: %lu", (unsigned long)age_years);
+    (void)snprintf(age_text, sizeof(age_text), "Age: %lu",
+                   (unsigned long)age_years);
   } else {
-    (void)snprintf(s_user_detail_age_text, sizeof(s_user_detail_age_text),
-                   "Age: --");
+    (void)snprintf(age_text, sizeof(age_text), "Age: --");
   }
 
-  s_user_detail_avatar_bg_color_hex =
-      (0U != avatar_bg_color_hex) ? avatar_bg_color_hex
-                                  : COMP_TAB_MENU_AVATAR_BG_COLOR_HEX;
-
-  compact_user_profile_bindings();
-  for (i = 0U; i < s_user_profile_binding_count; i++) {
-    update_label_if_valid(&s_user_profile_bindings[i].name_label,
-                          s_user_detail_name_text);
-    update_label_if_valid(&s_user_profile_bindings[i].age_label,
-                          s_user_detail_age_text);
-    update_bg_color_if_valid(&s_user_profile_bindings[i].avatar,
-                             s_user_detail_avatar_bg_color_hex);
-  }
+  (void)health_ui_text_subject_publish(&s_user_name_subject, name);
+  (void)health_ui_text_subject_publish(&s_user_age_subject, age_text);
+  (void)health_ui_int_subject_publish(
+      &s_user_avatar_bg_color_subject,
+      (int32_t)((0U != avatar_bg_color_hex) ? avatar_bg_color_hex
+                                            : COMP_TAB_MENU_AVATAR_BG_COLOR_HEX));
 }
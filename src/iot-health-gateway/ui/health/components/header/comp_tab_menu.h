@@ -90,19 +90,6 @@
 #define COMP_TAB_MENU_ACTION_BTN_LABEL_TEXT (LV_SYMBOL_PLUS " Add Data")
 #endif
 
-#ifndef COMP_TAB_MENU_TITLE_BUF_SIZE
-/* Runtime-updated title text cache (Family/Home labels). */
-#define COMP_TAB_MENU_TITLE_BUF_SIZE (64U)
-#endif
-
-#ifndef COMP_TAB_MENU_USER_NAME_BUF_SIZE
-#define COMP_TAB_MENU_USER_NAME_BUF_SIZE (64U)
-#endif
-
-#ifndef COMP_TAB_MENU_USER_AGE_BUF_SIZE
-#define COMP_TAB_MENU_USER_AGE_BUF_SIZE (24U)
-#endif
-
 /* Typography knobs (keep in this component to tune tab/header appearance fast). */
 #ifndef COMP_TAB_MENU_TEXT_FONT
 #define COMP_TAB_MENU_TEXT_FONT HL_FONT_HEADING
@@ -225,12 +212,13 @@ typedef struct {
 
 lv_obj_t *comp_tab_menu_create(lv_obj_t *parent, comp_tab_menu_mode_t mode,
                                comp_tab_menu_refs_t *out_refs);
-/* Updates runtime title text shown in Health/Home menu modes. */
-void comp_tab_menu_set_family_summary(const char *family_name,
-                                      uint32_t member_count);
-/* Updates user-detail left cluster (avatar color + name + age) at runtime. */
-void comp_tab_menu_set_user_detail_profile(const char *user_name,
-                                           uint32_t age_years,
-                                           uint32_t avatar_bg_color_hex);
+/* Publishes the title text shown in Health/Home menu modes. Every menu
+ * instance binds its title label, so only a changed title redraws. */
+void comp_tab_menu_publish_family_summary(const char *family_name,
+                                          uint32_t member_count);
+/* Publishes the user-detail left cluster (avatar color + name + age). */
+void comp_tab_menu_publish_user_detail_profile(const char *user_name,
+                                               uint32_t age_years,
+                                               uint32_t avatar_bg_color_hex);
 
 #endif
@@ -1,5 +1,6 @@
 #include "comp_add_device_list_modal.h"
 
+#include "../../health_ui_data_adapter.h"
 #include "../../sim/health_ui_sim_data.h"
 #include "comp_add_device_flow_modal.h"
 #include "comp_add_device_list_item.h"
@@ -229,7 +230,7 @@ static void build_pairable_device_list(lv_obj_t *panel) {
     return;
   }
 
-  device_count = health_ui_sim_data_get_device_count();
+  device_count = health_ui_data_get_device_count();
   if (0U == device_count) {
     lv_obj_t *empty_label = lv_label_create(panel);
     lv_label_set_text(empty_label, "No pairable device.");
@@ -247,7 +248,7 @@ static void build_pairable_device_list(lv_obj_t *panel) {
     comp_add_device_list_item_data_t item_data;
     lv_obj_t *row;
 
-    health_ui_sim_data_build_device_card(i, &device_data);
+    health_ui_data_build_device_card(i, &device_data);
     item_data.name = device_data.name;
     item_data.type_text = device_data.type_text;
     item_data.avatar_text = device_data.avatar_text;
@@ -1,5 +1,6 @@
 #include "comp_add_device_step_modal.h"
 
+#include "../../health_ui_data_adapter.h"
 #include "../../sim/health_ui_sim_data.h"
 #include "comp_add_device_flow_modal.h"
 #include "comp_add_device_step_indicator.h"
@@ -411,7 +412,7 @@ static void build_step_modal_content(void) {
     return;
   }
 
-  health_ui_sim_data_build_device_card(s_selected_device_index, &selected_device_data);
+  health_ui_data_build_device_card(s_selected_device_index, &selected_device_data);
 
   step_count = health_ui_sim_data_get_pairing_step_count(s_selected_device_index);
   if (0U == step_count) {
@@ -521,7 +522,7 @@ void comp_add_device_step_modal_open(uint32_t device_index, uint32_t device_id,
     return;
   }
 
-  health_ui_sim_data_build_device_card(s_selected_device_index, &selected_device_data);
+  health_ui_data_build_device_card(s_selected_device_index, &selected_device_data);
   if ((NULL != selected_device_data.name) && (selected_device_data.name[0] != '\0')) {
     safe_name = selected_device_data.name;
   }
@@ -0,0 +1,92 @@
+#include "health_ui_binding.h"
+
+#include <string.h>
+
+static health_ui_binding_stats_t s_stats = {0};
+
+void health_ui_text_subject_init(health_ui_text_subject_t *ts,
+                                 const char *initial_text) {
+  if (NULL == ts) {
+    return;
+  }
+
+  /* No prev buffer: change detection happens in publish, before the copy. */
+  lv_subject_init_string(&ts->subject, ts->buf, NULL, sizeof(ts->buf),
+                         (NULL != initial_text) ? initial_text : "");
+}
+
+void health_ui_text_subject_deinit(health_ui_text_subject_t *ts) {
+  if (NULL != ts) {
+    lv_subject_deinit(&ts->subject);
+  }
+}
+
+bool health_ui_text_subject_publish(health_ui_text_subject_t *ts,
+                                    const char *text) {
+  if (NULL == ts) {
+    return false;
+  }
+
+  if (NULL == text) {
+    text = "";
+  }
+
+  s_stats.published++;
+  /* Compare what the buffer would hold, so over-long text that was truncated
+   * last time does not count as a change on every tick. */
+  if (0 == strncmp(ts->buf, text, sizeof(ts->buf) - 1U)) {
+    return false;
+  }
+
+  s_stats.changed++;
+  lv_subject_copy_string(&ts->subject, text);
+  return true;
+}
+
+bool health_ui_int_subject_publish(lv_subject_t *subject, int32_t value) {
+  if (NULL == subject) {
+    return false;
+  }
+
+  s_stats.published++;
+  if (lv_subject_get_int(subject) == value) {
+    return false;
+  }
+
+  s_stats.changed++;
+  lv_subject_set_int(subject, value);
+  return true;
+}
+
+lv_observer_t *health_ui_bind_label(lv_obj_t *label,
+                                    health_ui_text_subject_t *ts) {
+  if ((NULL == label) || (NULL == ts)) {
+    return NULL;
+  }
+
+  return lv_label_bind_text(label, &ts->subject, NULL);
+}
+
+static void on_bg_color_changed(lv_observer_t *observer, lv_subject_t *subject) {
+  lv_obj_set_style_bg_color(lv_observer_get_target_obj(observer),
+                            lv_color_hex((uint32_t)lv_subject_get_int(subject)),
+                            LV_PART_MAIN);
+}
+
+lv_observer_t *health_ui_bind_bg_color(lv_obj_t *obj, lv_subject_t *subject) {
+  if ((NULL == obj) || (NULL == subject)) {
+    return NULL;
+  }
+
+  return lv_subject_add_observer_obj(subject, on_bg_color_changed, obj, NULL);
+}
+
+void health_ui_binding_get_stats(health_ui_binding_stats_t *out_stats) {
+  if (NULL != out_stats) {
+    *out_stats = s_stats;
+  }
+}
+
+void health_ui_binding_reset_stats(void) {
+  (void)memset(&s_stats, 0, sizeof(s_stats));
+}
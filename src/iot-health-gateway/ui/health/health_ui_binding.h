@@ -0,0 +1,54 @@
+#ifndef HEALTH_UI_BINDING_H
+#define HEALTH_UI_BINDING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+/*
+ * Change-detecting publish helpers on top of LVGL observer subjects.
+ *
+ * Producers publish every tick; a subject is only written (and its observers
+ * only run) when the value differs from what it already holds. Widgets bound
+ * to a subject therefore invalidate and relayout only on real changes.
+ */
+
+#ifndef HEALTH_UI_BINDING_TEXT_SIZE
+#define HEALTH_UI_BINDING_TEXT_SIZE (32U)
+#endif
+
+typedef struct {
+  lv_subject_t subject;
+  char buf[HEALTH_UI_BINDING_TEXT_SIZE];
+} health_ui_text_subject_t;
+
+typedef struct {
+  uint32_t published; /* publish calls */
+  uint32_t changed;   /* publishes that notified observers */
+} health_ui_binding_stats_t;
+
+void health_ui_text_subject_init(health_ui_text_subject_t *ts,
+                                 const char *initial_text);
+
+/* Detach every observer. Needed before freeing a subject whose widgets are
+ * still alive (subjects owned by a component's heap-allocated refs). */
+void health_ui_text_subject_deinit(health_ui_text_subject_t *ts);
+
+/* NULL publishes an empty string. Returns true when observers were notified. */
+bool health_ui_text_subject_publish(health_ui_text_subject_t *ts,
+                                    const char *text);
+
+bool health_ui_int_subject_publish(lv_subject_t *subject, int32_t value);
+
+/* Label shows the subject text; the binding is dropped with the label. */
+lv_observer_t *health_ui_bind_label(lv_obj_t *label,
+                                    health_ui_text_subject_t *ts);
+
+/* Main background color follows an int subject holding 0xRRGGBB. */
+lv_observer_t *health_ui_bind_bg_color(lv_obj_t *obj, lv_subject_t *subject);
+
+void health_ui_binding_get_stats(health_ui_binding_stats_t *out_stats);
+void health_ui_binding_reset_stats(void);
+
+#endif
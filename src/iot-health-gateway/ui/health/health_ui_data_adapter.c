@@ -13,6 +13,7 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 /*******************************************************************************
@@ -228,17 +229,269 @@ void health_ui_data_build_user_detail(uint32_t member_index,
     /* Weight and sleep: no BLE sensor — keep sim data */
 }
 
+/*******************************************************************************
+ * User detail subjects (published values, change-detected)
+ *******************************************************************************/
+static health_ui_user_detail_subjects_t s_user_detail_subjects;
+static bool s_user_detail_subjects_ready = false;
+static uint32_t s_user_detail_layout_sig = 0U;
+
+static void init_metric_card_subjects(health_ui_metric_card_subjects_t *s) {
+    health_ui_text_subject_init(&s->title, "");
+    health_ui_text_subject_init(&s->time, "--:--");
+    health_ui_text_subject_init(&s->value, "--");
+    health_ui_text_subject_init(&s->unit, "");
+    health_ui_text_subject_init(&s->status, "Normal");
+    health_ui_text_subject_init(&s->previous_time, "--");
+    health_ui_text_subject_init(&s->previous_value, "--");
+    lv_subject_init_int(&s->status_level, (int32_t)COMP_USER_STATUS_NORMAL);
+    lv_subject_init_int(&s->trend, (int32_t)HEALTH_UI_TREND_UNKNOWN);
+}
+
+static void init_user_detail_subjects(void) {
+    health_ui_bp_summary_subjects_t *bp = &s_user_detail_subjects.bp;
+
+    health_ui_text_subject_init(&bp->time, "--:--");
+    health_ui_text_subject_init(&bp->sys_value, "--");
+    health_ui_text_subject_init(&bp->sys_unit, "");
+    health_ui_text_subject_init(&bp->dia_value, "--");
+    health_ui_text_subject_init(&bp->dia_unit, "");
+    health_ui_text_subject_init(&bp->pulse_value, "--");
+    health_ui_text_subject_init(&bp->pulse_unit, "");
+    health_ui_text_subject_init(&bp->status, "Normal");
+    lv_subject_init_int(&bp->status_level, (int32_t)COMP_USER_STATUS_NORMAL);
+
+    init_metric_card_subjects(&s_user_detail_subjects.glucose);
+    init_metric_card_subjects(&s_user_detail_subjects.body_temp);
+    init_metric_card_subjects(&s_user_detail_subjects.spo2);
+    init_metric_card_subjects(&s_user_detail_subjects.weight);
+    init_metric_card_subjects(&s_user_detail_subjects.sleep_duration);
+    s_user_detail_subjects_ready = true;
+}
+
+static bool parse_first_float(const char *text, float *out_value) {
+    char *end_ptr = NULL;
+    float parsed;
+
+    if ((NULL == text) || (NULL == out_value)) {
+        return false;
+    }
+
+    parsed = strtof(text, &end_ptr);
+    if (end_ptr == text) {
+        return false;
+    }
+
+    *out_value = parsed;
+    return true;
+}
+
+static health_ui_trend_t resolve_metric_trend(
+    const health_ui_user_detail_metric_card_t *card) {
+    float current = 0.0f;
+    float previous = 0.0f;
+    float diff;
+
+    if (!card->previous_available ||
+        !parse_first_float(card->value_text, &current) ||
+        !parse_first_float(card->previous_value_text, &previous)) {
+        return HEALTH_UI_TREND_UNKNOWN;
+    }
+
+    diff = current - previous;
+    if (diff > 0.001f) {
+        return HEALTH_UI_TREND_UP;
+    }
+    if (diff < -0.001f) {
+        return HEALTH_UI_TREND_DOWN;
+    }
+    return HEALTH_UI_TREND_UNKNOWN;
+}
+
+/* Returns true when the card structure changed (see LAYOUT_CHANGED). */
+static bool publish_metric_card(health_ui_metric_card_subjects_t *s,
+                                const health_ui_user_detail_metric_card_t *card,
+                                bool *values_changed) {
+    char previous_value[HEALTH_UI_BINDING_TEXT_SIZE] = "--";
+    bool changed = false;
+    bool title_changed;
+
+    if ((NULL != card->previous_value_text) && (NULL != card->previous_unit_text)) {
+        (void)snprintf(previous_value, sizeof(previous_value), "%s %s",
+                       card->previous_value_text, card->previous_unit_text);
+    }
+
+    /* The icon glyph is derived from the title when the card is created. */
+    title_changed = health_ui_text_subject_publish(
+        &s->title, (NULL != card->title_text) ? card->title_text : "Metric");
+    changed |= health_ui_text_subject_publish(
+        &s->time, (NULL != card->time_text) ? card->time_text : "--:--");
+    changed |= health_ui_text_subject_publish(
+        &s->value, (NULL != card->value_text) ? card->value_text : "--");
+    changed |= health_ui_text_subject_publish(&s->unit, card->unit_text);
+    changed |= health_ui_text_subject_publish(
+        &s->status, (NULL != card->status_text) ? card->status_text : "Normal");
+    changed |= health_ui_text_subject_publish(
+        &s->previous_time,
+        (NULL != card->previous_time_text) ? card->previous_time_text : "--");
+    changed |= health_ui_text_subject_publish(&s->previous_value, previous_value);
+    changed |= health_ui_int_subject_publish(&s->status_level,
+                                             (int32_t)card->status_level);
+    changed |= health_ui_int_subject_publish(&s->trend,
+                                             (int32_t)resolve_metric_trend(card));
+
+    s->previous_available = card->previous_available;
+
+    *values_changed = *values_changed || changed || title_changed;
+    return title_changed;
+}
+
+static void publish_bp_summary(health_ui_bp_summary_subjects_t *s,
+                               const health_ui_user_detail_bp_summary_t *bp,
+                               bool *values_changed) {
+    bool changed = false;
+
+    changed |= health_ui_text_subject_publish(
+        &s->time, (NULL != bp->time_text) ? bp->time_text : "--:--");
+    changed |= health_ui_text_subject_publish(
+        &s->sys_value, (NULL != bp->sys_value_text) ? bp->sys_value_text : "--");
+    changed |= health_ui_text_subject_publish(&s->sys_unit, bp->sys_unit_text);
+    changed |= health_ui_text_subject_publish(
+        &s->dia_value, (NULL != bp->dia_value_text) ? bp->dia_value_text : "--");
+    changed |= health_ui_text_subject_publish(&s->dia_unit, bp->dia_unit_text);
+    changed |= health_ui_text_subject_publish(
+        &s->pulse_value,
+        (NULL != bp->pulse_value_text) ? bp->pulse_value_text : "--");
+    changed |= health_ui_text_subject_publish(&s->pulse_unit, bp->pulse_unit_text);
+    changed |= health_ui_text_subject_publish(
+        &s->status, (NULL != bp->status_text) ? bp->status_text : "Normal");
+    changed |= health_ui_int_subject_publish(&s->status_level,
+                                             (int32_t)bp->status_level);
+
+    *values_changed = *values_changed || changed;
+}
+
+/*******************************************************************************
+ * Public API — user detail subjects
+ *******************************************************************************/
+health_ui_user_detail_subjects_t *health_ui_data_get_user_detail_subjects(void) {
+    if (!s_user_detail_subjects_ready) {
+        init_user_detail_subjects();
+    }
+    return &s_user_detail_subjects;
+}
+
+uint32_t health_ui_data_publish_user_detail(uint32_t member_index) {
+    health_ui_user_detail_subjects_t *subjects =
+        health_ui_data_get_user_detail_subjects();
+    health_ui_user_detail_data_t data;
+    bool values_changed = false;
+    bool titles_changed = false;
+    uint32_t layout_sig;
+    uint32_t result = 0U;
+
+    /* Strings point into the fmt_alloc pool; publish copies them right away. */
+    health_ui_data_build_user_detail(member_index, &data);
+
+    publish_bp_summary(&subjects->bp, &data.bp, &values_changed);
+    titles_changed |= publish_metric_card(&subjects->glucose, &data.glucose,
+                                          &values_changed);
+    titles_changed |= publish_metric_card(&subjects->body_temp, &data.body_temp,
+                                          &values_changed);
+    titles_changed |= publish_metric_card(&subjects->spo2, &data.spo2,
+                                          &values_changed);
+    titles_changed |= publish_metric_card(&subjects->weight, &data.weight,
+                                          &values_changed);
+    titles_changed |= publish_metric_card(&subjects->sleep_duration,
+                                          &data.sleep_duration, &values_changed);
+
+    /* The top bit marks the signature valid so the first publish always counts. */
+    layout_sig = 0x80000000U | (data.glucose.previous_available ? 1U : 0U) |
+                 (data.body_temp.previous_available ? 2U : 0U) |
+                 (data.spo2.previous_available ? 4U : 0U) |
+                 (data.weight.previous_available ? 8U : 0U) |
+                 (data.sleep_duration.previous_available ? 16U : 0U);
+
+    if (values_changed) {
+        result |= HEALTH_UI_PUBLISH_VALUES_CHANGED;
+    }
+    if (titles_changed || (layout_sig != s_user_detail_layout_sig)) {
+        result |= HEALTH_UI_PUBLISH_LAYOUT_CHANGED;
+    }
+    s_user_detail_layout_sig = layout_sig;
+
+    return result;
+}
+
+/*******************************************************************************
+ * Daily chart series from the store aggregates
+ *******************************************************************************/
+static const char *weekday_text(uint32_t day_start_sec) {
+    /* 1970-01-01 was a Thursday. */
+    static const char *const names[7] = {"Thu", "Fri", "Sat", "Sun",
+                                         "Mon", "Tue", "Wed"};
+    return names[(day_start_sec / 86400U) % 7U];
+}
+
+/* Daily aggregates for the last HDP_MAX_HISTORY_POINTS days; days without
+ * readings are skipped. Returns 0 (caller falls back to recent readings)
+ * unless at least two days have data. */
+static uint32_t build_daily_series(uint8_t member_index,
+                                   hdp_measurement_type_t type,
+                                   uint32_t max_points,
+                                   hdp_aggregate_t *out_points,
+                                   const char **out_labels) {
+    hdp_aggregate_t days[HDP_MAX_HISTORY_POINTS];
+    uint32_t now = hdp_get_current_epoch();
+    uint32_t count = 0U;
+    uint32_t i;
+
+    if ((0U == now) ||
+        (hdp_get_daily_aggregates(member_index, type, now,
+                                  HDP_MAX_HISTORY_POINTS, days) < 2U)) {
+        return 0U;
+    }
+
+    for (i = 0U; (i < HDP_MAX_HISTORY_POINTS) && (count < max_points); i++) {
+        if (0U == days[i].count) {
+            continue;
+        }
+        out_points[count] = days[i];
+        out_labels[count] = weekday_text(days[i].start_sec);
+        count++;
+    }
+    return count;
+}
+
 /*******************************************************************************
  * Public API — BP metric detail (chart)
  *******************************************************************************/
 void health_ui_data_build_bp_metric_detail(
     uint32_t member_index, health_ui_bp_metric_detail_data_t *out_data) {
     hdp_measurement_t history[HEALTH_UI_BP_DETAIL_MAX_POINTS];
+    hdp_aggregate_t days[HEALTH_UI_BP_DETAIL_MAX_POINTS];
     uint32_t count, i;
 
     /* Start with sim data */
     health_ui_sim_data_build_bp_metric_detail(member_index, out_data);
 
+    s_fmt_idx = 0U;
+    count = build_daily_series((uint8_t)member_index, HDP_MEAS_BLOOD_PRESSURE,
+                               HEALTH_UI_BP_DETAIL_MAX_POINTS, days,
+                               out_data->x_labels);
+    if (count > 0U) {
+        out_data->period_text = fmt_alloc("Daily average, last %u days",
+                                          (unsigned)HDP_MAX_HISTORY_POINTS);
+        out_data->point_count = count;
+        for (i = 0U; i < count; i++) {
+            out_data->sys_values[i] = days[i].mean[0];
+            out_data->dia_values[i] = days[i].mean[1];
+            out_data->pulse_values[i] = days[i].mean[2];
+        }
+        fill_bp_summary_real((uint8_t)member_index, &out_data->summary);
+        return;
+    }
+
     count = hdp_get_history((uint8_t)member_index, HDP_MEAS_BLOOD_PRESSURE,
                             history, HEALTH_UI_BP_DETAIL_MAX_POINTS);
     if (0U == count) {
@@ -272,6 +525,7 @@ void health_ui_data_build_single_metric_detail(
     health_ui_single_metric_detail_data_t *out_data) {
     hdp_measurement_type_t hdp_type;
     hdp_measurement_t history[HEALTH_UI_SINGLE_METRIC_MAX_POINTS];
+    hdp_aggregate_t days[HEALTH_UI_SINGLE_METRIC_MAX_POINTS];
     uint32_t count, i;
 
     /* Start with sim data */
@@ -285,34 +539,45 @@ void health_ui_data_build_single_metric_detail(
         default: return; /* weight — no BLE sensor, keep sim */
     }
 
-    count = hdp_get_history((uint8_t)member_index, hdp_type, history,
-                            HEALTH_UI_SINGLE_METRIC_MAX_POINTS);
-    if (0U == count) {
-        return; /* keep sim data */
-    }
-
     s_fmt_idx = 0U;
-    out_data->period_text = "Recent readings";
-    out_data->point_count = count;
-
-    for (i = 0U; i < count; i++) {
-        uint32_t ri = count - 1U - i;
-        switch (hdp_type) {
-            case HDP_MEAS_GLUCOSE:
-                out_data->values[i] = hdp_get_glucose_mgdl(history[ri].raw_value);
-                break;
-            case HDP_MEAS_TEMPERATURE:
-                out_data->values[i] = hdp_get_temp_x10(history[ri].raw_value);
-                break;
-            case HDP_MEAS_SPO2_HR: {
-                hdp_spo2_hr_values_t v;
-                hdp_unpack_spo2_hr(history[ri].raw_value, &v);
-                out_data->values[i] = (int16_t)v.spo2_pct;
-                break;
+    count = build_daily_series((uint8_t)member_index, hdp_type,
+                               HEALTH_UI_SINGLE_METRIC_MAX_POINTS, days,
+                               out_data->x_labels);
+    if (count > 0U) {
+        /* Channel 0 is the charted value for glucose, temperature and SpO2. */
+        out_data->period_text = fmt_alloc("Daily average, last %u days",
+                                          (unsigned)HDP_MAX_HISTORY_POINTS);
+        out_data->point_count = count;
+        for (i = 0U; i < count; i++) {
+            out_data->values[i] = days[i].mean[0];
+        }
+    } else {
+        count = hdp_get_history((uint8_t)member_index, hdp_type, history,
+                                HEALTH_UI_SINGLE_METRIC_MAX_POINTS);
+        if (0U == count) {
+            return; /* keep sim data */
+        }
+        out_data->period_text = "Recent readings";
+        out_data->point_count = count;
+        for (i = 0U; i < count; i++) {
+            uint32_t ri = count - 1U - i;
+            switch (hdp_type) {
+                case HDP_MEAS_GLUCOSE:
+                    out_data->values[i] = hdp_get_glucose_mgdl(history[ri].raw_value);
+                    break;
+                case HDP_MEAS_TEMPERATURE:
+                    out_data->values[i] = hdp_get_temp_x10(history[ri].raw_value);
+                    break;
+                case HDP_MEAS_SPO2_HR: {
+                    hdp_spo2_hr_values_t v;
+                    hdp_unpack_spo2_hr(history[ri].raw_value, &v);
+                    out_data->values[i] = (int16_t)v.spo2_pct;
+                    break;
+                }
+                default: break;
             }
-            default: break;
+            out_data->x_labels[i] = fmt_alloc("#%u", (unsigned)(i + 1U));
         }
-        out_data->x_labels[i] = fmt_alloc("#%u", (unsigned)(i + 1U));
     }
 
     /* Update summary from latest */
@@ -361,11 +626,114 @@ void health_ui_data_build_member_card(uint32_t member_index,
     health_ui_sim_data_build_member_card(member_index, out_card_data);
 }
 
+typedef struct {
+    uint8_t device_type;
+    const char *type_text;
+    const char *avatar_text;
+    uint32_t avatar_bg_color_hex;
+} device_style_t;
+
+static const device_style_t s_device_styles[] = {
+    {(uint8_t)HDP_MEAS_BLOOD_PRESSURE, "Blood Pressure Monitor", "BP", 0xE7EAF0},
+    {(uint8_t)HDP_MEAS_GLUCOSE,        "Blood Glucose Meter",    "BG", 0xECE8F8},
+    {(uint8_t)HDP_MEAS_TEMPERATURE,    "Thermometer",            "TH", 0xE3EEF9},
+    {(uint8_t)HDP_MEAS_SPO2_HR,        "Pulse Oximeter",         "SP", 0xF1E8EE},
+    {(uint8_t)HDP_DEVICE_WEIGHT_SCALE, "Weight Scale",           "WT", 0xE8ECEF},
+};
+
 void health_ui_data_build_device_card(uint32_t device_index,
                                       comp_device_card_data_t *out_card_data) {
-    health_ui_sim_data_build_device_card(device_index, out_card_data);
+    hdp_device_info_t info;
+    uint32_t i;
+
+    if (NULL == out_card_data) {
+        return;
+    }
+
+    out_card_data->name = "Unknown Device";
+    out_card_data->type_text = "Health Device";
+    out_card_data->avatar_text = "--";
+    out_card_data->avatar_bg_color_hex = 0xE7EAF0;
+    if (!hdp_get_device_info(device_index, &info)) {
+        return;
+    }
+
+    if ('\0' != info.name[0]) {
+        out_card_data->name = fmt_alloc("%s", info.name);
+    }
+    for (i = 0U; i < (sizeof(s_device_styles) / sizeof(s_device_styles[0])); i++) {
+        if (s_device_styles[i].device_type == info.device_type) {
+            out_card_data->type_text = s_device_styles[i].type_text;
+            out_card_data->avatar_text = s_device_styles[i].avatar_text;
+            out_card_data->avatar_bg_color_hex = s_device_styles[i].avatar_bg_color_hex;
+            break;
+        }
+    }
 }
 
 uint32_t health_ui_data_get_device_count(void) {
-    return health_ui_sim_data_get_device_count();
+    return hdp_get_device_count();
+}
+
+/*******************************************************************************
+ * Dashboard subjects (member and device counts, change-detected)
+ *******************************************************************************/
+static health_ui_dashboard_subjects_t s_dashboard_subjects;
+static bool s_dashboard_subjects_ready = false;
+
+health_ui_dashboard_subjects_t *health_ui_data_get_dashboard_subjects(void) {
+    if (!s_dashboard_subjects_ready) {
+        lv_subject_init_int(&s_dashboard_subjects.member_count, 0);
+        lv_subject_init_int(&s_dashboard_subjects.device_count,
+                            (int32_t)health_ui_data_get_device_count());
+        lv_subject_init_int(&s_dashboard_subjects.device_generation,
+                            (int32_t)hdp_get_device_generation());
+        s_dashboard_subjects_ready = true;
+    }
+    return &s_dashboard_subjects;
+}
+
+bool health_ui_data_publish_dashboard(uint32_t member_count) {
+    health_ui_dashboard_subjects_t *subjects =
+        health_ui_data_get_dashboard_subjects();
+    bool changed;
+
+    changed = health_ui_int_subject_publish(&subjects->member_count,
+                                            (int32_t)member_count);
+    changed |= health_ui_int_subject_publish(
+        &subjects->device_count, (int32_t)health_ui_data_get_device_count());
+    changed |= health_ui_int_subject_publish(
+        &subjects->device_generation, (int32_t)hdp_get_device_generation());
+    return changed;
+}
+
+/*******************************************************************************
+ * Storage subject (persisted history flash use, change-detected)
+ *******************************************************************************/
+static health_ui_text_subject_t s_storage_subject;
+static bool s_storage_subject_ready = false;
+
+health_ui_text_subject_t *health_ui_data_get_storage_subject(void) {
+    if (!s_storage_subject_ready) {
+        health_ui_text_subject_init(&s_storage_subject, "History: --");
+        s_storage_subject_ready = true;
+    }
+    return &s_storage_subject;
+}
+
+bool health_ui_data_publish_storage(void) {
+    char text[HEALTH_UI_BINDING_TEXT_SIZE];
+#if HDP_PERSIST_ENABLE
+    nor_log_stats_t st;
+
+    hdp_get_persist_stats(&st);
+    /* Bytes programmed and sectors erased this session. */
+    (void)snprintf(text, sizeof(text), "History: %lu KB, %lu erases",
+                   (unsigned long)(st.flash_bytes / 1024U),
+                   (unsigned long)st.erases);
+#else
+    (void)snprintf(text, sizeof(text), "History: RAM only");
+#endif
+    return health_ui_text_subject_publish(health_ui_data_get_storage_subject(),
+                                          text);
 }
@@ -15,11 +15,75 @@
 #include "components/content/comp_user_card.h"
 #include "components/content/comp_device_card.h"
 #include "health_ui_root.h"
+#include "health_ui_binding.h"
+
+typedef enum {
+    HEALTH_UI_TREND_UNKNOWN = 0,
+    HEALTH_UI_TREND_UP,
+    HEALTH_UI_TREND_DOWN
+} health_ui_trend_t;
+
+/** Published state of one user detail metric card. */
+typedef struct {
+    health_ui_text_subject_t title;
+    health_ui_text_subject_t time;
+    health_ui_text_subject_t value;
+    health_ui_text_subject_t unit;
+    health_ui_text_subject_t status;
+    health_ui_text_subject_t previous_time;
+    health_ui_text_subject_t previous_value; /* "value unit" */
+    lv_subject_t status_level;               /* comp_user_status_level_t */
+    lv_subject_t trend;                      /* health_ui_trend_t */
+    bool previous_available;                 /* structural, not a subject */
+} health_ui_metric_card_subjects_t;
+
+/** Published state of the user detail BP summary card. */
+typedef struct {
+    health_ui_text_subject_t time;
+    health_ui_text_subject_t sys_value;
+    health_ui_text_subject_t sys_unit;
+    health_ui_text_subject_t dia_value;
+    health_ui_text_subject_t dia_unit;
+    health_ui_text_subject_t pulse_value;
+    health_ui_text_subject_t pulse_unit;
+    health_ui_text_subject_t status;
+    lv_subject_t status_level;
+} health_ui_bp_summary_subjects_t;
+
+typedef struct {
+    health_ui_bp_summary_subjects_t bp;
+    health_ui_metric_card_subjects_t glucose;
+    health_ui_metric_card_subjects_t body_temp;
+    health_ui_metric_card_subjects_t spo2;
+    health_ui_metric_card_subjects_t weight;
+    health_ui_metric_card_subjects_t sleep_duration;
+} health_ui_user_detail_subjects_t;
+
+/** Published state of the dashboard (member and device carousels). */
+typedef struct {
+    lv_subject_t member_count;
+    lv_subject_t device_count;
+    lv_subject_t device_generation;          /* hdp_get_device_generation() */
+} health_ui_dashboard_subjects_t;
+
+/* health_ui_data_publish_user_detail() result bits. */
+#define HEALTH_UI_PUBLISH_VALUES_CHANGED (1U << 0)
+/* Card structure differs (previous reading appeared/vanished, title changed):
+ * bound widgets cannot express this, the page has to rebuild. */
+#define HEALTH_UI_PUBLISH_LAYOUT_CHANGED (1U << 1)
 
 /** Build user detail page data. Uses real data if available for the member. */
 void health_ui_data_build_user_detail(uint32_t member_index,
                                       health_ui_user_detail_data_t *out_data);
 
+/** Subjects the user detail page binds to. Initialized on first use. */
+health_ui_user_detail_subjects_t *health_ui_data_get_user_detail_subjects(void);
+
+/** Build user detail data and publish it into the subjects. Only values that
+ *  differ from the last publish notify their observers.
+ *  Returns HEALTH_UI_PUBLISH_* bits. */
+uint32_t health_ui_data_publish_user_detail(uint32_t member_index);
+
 /** Build BP metric detail page data. */
 void health_ui_data_build_bp_metric_detail(
     uint32_t member_index, health_ui_bp_metric_detail_data_t *out_data);
@@ -37,11 +101,27 @@ void health_ui_data_build_sleep_metric_detail(
 void health_ui_data_build_member_card(uint32_t member_index,
                                       comp_user_card_data_t *out_card_data);
 
-/** Build device card for dashboard. */
+/** Build device card for dashboard from the health_data_provider device
+ *  record. The name stays valid until the next adapter call. */
 void health_ui_data_build_device_card(uint32_t device_index,
                                       comp_device_card_data_t *out_card_data);
 
-/** Get device count (real + sim). */
+/** Paired devices in health_data_provider (sim devices are registered
+ *  there when the BLE bridge is off). */
 uint32_t health_ui_data_get_device_count(void);
 
+/** Subjects the dashboard binds to. Initialized on first use. */
+health_ui_dashboard_subjects_t *health_ui_data_get_dashboard_subjects(void);
+
+/** Publish the household member count, the device count and the device
+ *  list generation. Returns true when any of them changed. */
+bool health_ui_data_publish_dashboard(uint32_t member_count);
+
+/** History storage line for the settings page ("History: 12 KB, 3 erases",
+ *  or "History: RAM only" without persistence). Initialized on first use. */
+health_ui_text_subject_t *health_ui_data_get_storage_subject(void);
+
+/** Publish hdp_get_persist_stats(). Returns true when the text changed. */
+bool health_ui_data_publish_storage(void);
+
 #endif /* HEALTH_UI_DATA_ADAPTER_H */
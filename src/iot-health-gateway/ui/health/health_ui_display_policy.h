@@ -1,6 +1,7 @@
 #ifndef HEALTH_UI_DISPLAY_POLICY_H
 #define HEALTH_UI_DISPLAY_POLICY_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "lv_port_disp.h"
@@ -9,8 +10,38 @@
 #error "Health UI is landscape-only. Rotation/portrait is not supported."
 #endif
 
+/*******************************************************************************
+ * Viewport selection
+ *
+ * The build targets MY_DISP_HOR_RES x MY_DISP_VER_RES (lv_port_disp.h).
+ * With HEALTH_UI_VIEWPORT_HOT_SWITCH=1 one binary carries the token tables
+ * of every supported viewport; hl_viewport_select() picks one at runtime
+ * (before the UI is built) for multi-panel testing.
+ ******************************************************************************/
+#ifndef HEALTH_UI_VIEWPORT_HOT_SWITCH
+#define HEALTH_UI_VIEWPORT_HOT_SWITCH (0)
+#endif
+
+#include "layout/layout_token_tables.h"
+
+#if HEALTH_UI_VIEWPORT_HOT_SWITCH
+extern uint32_t hl_viewport_index;
+#define HL_VIEWPORT_SEL (hl_viewport_index)
+#define HEALTH_UI_VIEWPORT_WIDTH ((uint32_t)hl_viewports[HL_VIEWPORT_SEL].width)
+#define HEALTH_UI_VIEWPORT_HEIGHT ((uint32_t)hl_viewports[HL_VIEWPORT_SEL].height)
+#else
+#define HL_VIEWPORT_SEL (HL_VIEWPORT_BUILD)
 #define HEALTH_UI_VIEWPORT_WIDTH ((uint32_t)MY_DISP_HOR_RES)
 #define HEALTH_UI_VIEWPORT_HEIGHT ((uint32_t)MY_DISP_VER_RES)
+#endif
+
+/* Select the viewport tables by size. Returns false (and keeps the current
+ * ones) if no table exists; without hot switch only the build size is. */
+bool hl_viewport_select(uint32_t width, uint32_t height);
+
+/* Size classes for step changes (fonts, items per row). */
+#define HL_VIEWPORT_IS_WIDE (HEALTH_UI_VIEWPORT_WIDTH >= 1024U)
+#define HL_VIEWPORT_IS_TALL (HEALTH_UI_VIEWPORT_HEIGHT >= 600U)
 
 /*******************************************************************************
  * Viewport-proportional scaling
@@ -21,13 +52,21 @@
  *
  *   7"  (600px): HL_SCALE_V(320) = 320
  *   4.3" (480px): HL_SCALE_V(320) = 256  (×0.8)
+ *
+ * px must be a literal: it names a slot in the generated token table
+ * (tools/gen_layout_tokens.py), so every use is a load from a constant
+ * table (folded to a literal when the viewport is fixed). After adding a
+ * new value, rerun the generator. HL_SCALE_*_EXPR() takes any expression.
  ******************************************************************************/
 #define HL_REF_HEIGHT (600U)
 #define HL_REF_WIDTH  (1024U)
 
-#define HL_SCALE_V(px) \
+#define HL_SCALE_V(px) ((int32_t)hl_v_tokens[HL_VIEWPORT_SEL][HL_VSLOT_##px])
+#define HL_SCALE_H(px) ((int32_t)hl_h_tokens[HL_VIEWPORT_SEL][HL_HSLOT_##px])
+
+#define HL_SCALE_V_EXPR(px) \
     ((int32_t)((int32_t)(px) * (int32_t)HEALTH_UI_VIEWPORT_HEIGHT / (int32_t)HL_REF_HEIGHT))
-#define HL_SCALE_H(px) \
+#define HL_SCALE_H_EXPR(px) \
     ((int32_t)((int32_t)(px) * (int32_t)HEALTH_UI_VIEWPORT_WIDTH / (int32_t)HL_REF_WIDTH))
 
 #endif
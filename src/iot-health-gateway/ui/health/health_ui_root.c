@@ -4,6 +4,7 @@
 #include "components/global/comp_system_status_bar.h"
 #include "components/header/comp_tab_menu.h"
 #include "components/overlay/comp_add_device_flow_modal.h"
+#include "health_ui_data_adapter.h"
 #include "health_ui_display_policy.h"
 #include "metric_detail_catalog.h"
 #include "layout/layout_scaffold.h"
@@ -21,6 +22,7 @@
 #include "lvgl.h"
 
 #include <stdio.h>
+#include <string.h>
 
 static health_layout_scaffold_t s_scaffold;
 #define HEALTH_UI_SELECTED_USER_BUF_SIZE (64U)
@@ -29,8 +31,31 @@ static health_layout_scaffold_t s_scaffold;
 #define HEALTH_UI_ENABLE_SIM_DATA (1U)
 /* Disable overlay debug card in normal layout review. */
 #define HEALTH_UI_ENABLE_OVERLAY_DEBUG (0U)
+/* Build each page the first time it is shown instead of all at init.
+ * Set to 0 to build every page up front (old behavior, for comparison). */
+#ifndef HEALTH_UI_LAZY_PAGES
+#define HEALTH_UI_LAZY_PAGES (1U)
+#endif
+/* LVGL heap allowed for built metric detail pages; the least recently
+ * shown ones are torn down above it (the active page is always kept). */
+#ifndef HEALTH_UI_DETAIL_PAGE_BUDGET_BYTES
+#define HEALTH_UI_DETAIL_PAGE_BUDGET_BYTES (64U * 1024U)
+#endif
+
+typedef struct {
+  lv_obj_t *tab;
+  bool built;
+  uint32_t last_used;
+  size_t heap_bytes; /* LVGL heap taken when the page was built */
+} page_slot_t;
+
+static page_slot_t s_pages[HEALTH_UI_PAGE_COUNT];
+static uint32_t s_page_use_clock = 0U;
+static size_t s_detail_page_budget = HEALTH_UI_DETAIL_PAGE_BUDGET_BYTES;
+static bool s_evict_pending = false;
 static char s_selected_user_name[HEALTH_UI_SELECTED_USER_BUF_SIZE] = "Member";
 static uint32_t s_selected_member_index = 0U;
+static uint32_t s_household_member_count = 0U;
 static uint32_t s_selected_user_age_years = 0U;
 static uint32_t s_selected_user_avatar_bg_color_hex =
     COMP_TAB_MENU_AVATAR_BG_COLOR_HEX;
@@ -39,63 +64,180 @@ static void sync_selected_user_views(void) {
   page_user_detail_layout_set_member_index(s_selected_member_index);
   page_metric_detail_layout_set_member_index(s_selected_member_index);
   page_user_detail_layout_set_user_name(s_selected_user_name);
-  comp_tab_menu_set_user_detail_profile(
+  comp_tab_menu_publish_user_detail_profile(
       s_selected_user_name, s_selected_user_age_years,
       s_selected_user_avatar_bg_color_hex);
 }
 
+static size_t heap_used_bytes(void) {
+  lv_mem_monitor_t mon;
+
+  lv_mem_monitor(&mon);
+  return mon.total_size - mon.free_size;
+}
+
+static health_ui_metric_detail_t page_to_metric_detail(health_ui_page_t page) {
+  return (health_ui_metric_detail_t)((uint32_t)page -
+                                     (uint32_t)HEALTH_UI_PAGE_METRIC_BP_DETAIL);
+}
+
+/* Tabs are cheap empty containers and always exist, so tab indices match
+ * health_ui_page_t; only their content is built on demand. */
+static void ensure_page_built(health_ui_page_t page) {
+  page_slot_t *slot = &s_pages[(uint32_t)page];
+  size_t heap_before;
+
+  if (slot->built || (NULL == slot->tab)) {
+    return;
+  }
+
+  heap_before = heap_used_bytes();
+  switch (page) {
+  case HEALTH_UI_PAGE_PRE_AUTH:
+    page_pre_auth_overview_build(slot->tab);
+    break;
+  case HEALTH_UI_PAGE_HEALTH:
+    page_dashboard_main_build(slot->tab);
+    break;
+  case HEALTH_UI_PAGE_HOME:
+    page_home_main_build(slot->tab);
+    break;
+  case HEALTH_UI_PAGE_SETTING:
+    page_settings_layout_build(slot->tab);
+    break;
+  case HEALTH_UI_PAGE_USER_DETAIL:
+    page_user_detail_layout_build(slot->tab);
+    break;
+  default:
+    page_metric_detail_layout_build(slot->tab, page_to_metric_detail(page));
+    break;
+  }
+
+  slot->built = true;
+  slot->heap_bytes = heap_used_bytes() - heap_before;
+}
+
+static void release_detail_page(health_ui_page_t page) {
+  page_slot_t *slot = &s_pages[(uint32_t)page];
+
+  if (!slot->built) {
+    return;
+  }
+
+  page_metric_detail_layout_release(page_to_metric_detail(page));
+  lv_obj_clean(slot->tab);
+  slot->built = false;
+  slot->heap_bytes = 0U;
+}
+
+/* Drop least recently used detail pages until the rest fit the budget.
+ * Runs from lv_async_call: navigation starts from click handlers inside
+ * the pages, which must not be deleted while their event is running. */
+static void evict_detail_pages_async(void *user_data) {
+  health_ui_page_t active =
+      (health_ui_page_t)lv_tabview_get_tab_active(s_scaffold.tabview);
+  size_t total = 0U;
+  uint32_t i;
+
+  (void)user_data;
+  s_evict_pending = false;
+
+  for (i = (uint32_t)HEALTH_UI_PAGE_METRIC_BP_DETAIL;
+       i < (uint32_t)HEALTH_UI_PAGE_COUNT; i++) {
+    if (s_pages[i].built) {
+      total += s_pages[i].heap_bytes;
+    }
+  }
+
+  while (total > s_detail_page_budget) {
+    uint32_t oldest = (uint32_t)HEALTH_UI_PAGE_COUNT;
+
+    for (i = (uint32_t)HEALTH_UI_PAGE_METRIC_BP_DETAIL;
+         i < (uint32_t)HEALTH_UI_PAGE_COUNT; i++) {
+      if (!s_pages[i].built || (i == (uint32_t)active)) {
+        continue;
+      }
+      if ((oldest == (uint32_t)HEALTH_UI_PAGE_COUNT) ||
+          (s_pages[i].last_used < s_pages[oldest].last_used)) {
+        oldest = i;
+      }
+    }
+
+    if (oldest == (uint32_t)HEALTH_UI_PAGE_COUNT) {
+      break; /* only the active page is left */
+    }
+
+    total -= s_pages[oldest].heap_bytes;
+    release_detail_page((health_ui_page_t)oldest);
+  }
+}
+
+static void schedule_detail_eviction(void) {
+  if (s_evict_pending) {
+    return;
+  }
+  if (LV_RESULT_OK == lv_async_call(evict_detail_pages_async, NULL)) {
+    s_evict_pending = true;
+  }
+}
+
 void health_ui_root_init(void) {
-  uint32_t metric_idx;
-  lv_obj_t *pre_auth_tab;
-  lv_obj_t *health_tab;
-  lv_obj_t *home_tab;
-  lv_obj_t *setting_tab;
-  lv_obj_t *user_tab;
-  lv_obj_t *metric_detail_tabs[HEALTH_UI_METRIC_DETAIL_COUNT] = {0};
+  uint32_t page_idx;
 
+  /* A second init builds a fresh scaffold: forget the pages built on the
+   * previous one, or their new tabs would never be filled. */
+  (void)memset(s_pages, 0, sizeof(s_pages));
   health_layout_scaffold_create(&s_scaffold);
   comp_system_status_bar_create();
 
-  pre_auth_tab = health_layout_scaffold_add_tab(&s_scaffold, "Pre-Auth");
-  health_tab = health_layout_scaffold_add_tab(&s_scaffold, "Health");
-  home_tab = health_layout_scaffold_add_tab(&s_scaffold, "Home");
-  setting_tab = health_layout_scaffold_add_tab(&s_scaffold, "Setting");
-  user_tab = health_layout_scaffold_add_tab(&s_scaffold, "User Detail");
-  for (metric_idx = 0U; metric_idx < (uint32_t)HEALTH_UI_METRIC_DETAIL_COUNT;
-       metric_idx++) {
-    health_ui_metric_detail_t metric = (health_ui_metric_detail_t)metric_idx;
-    metric_detail_tabs[metric_idx] = health_layout_scaffold_add_tab(
+  s_pages[HEALTH_UI_PAGE_PRE_AUTH].tab =
+      health_layout_scaffold_add_tab(&s_scaffold, "Pre-Auth");
+  s_pages[HEALTH_UI_PAGE_HEALTH].tab =
+      health_layout_scaffold_add_tab(&s_scaffold, "Health");
+  s_pages[HEALTH_UI_PAGE_HOME].tab =
+      health_layout_scaffold_add_tab(&s_scaffold, "Home");
+  s_pages[HEALTH_UI_PAGE_SETTING].tab =
+      health_layout_scaffold_add_tab(&s_scaffold, "Setting");
+  s_pages[HEALTH_UI_PAGE_USER_DETAIL].tab =
+      health_layout_scaffold_add_tab(&s_scaffold, "User Detail");
+  for (page_idx = (uint32_t)HEALTH_UI_PAGE_METRIC_BP_DETAIL;
+       page_idx < (uint32_t)HEALTH_UI_PAGE_COUNT; page_idx++) {
+    health_ui_metric_detail_t metric =
+        page_to_metric_detail((health_ui_page_t)page_idx);
+    s_pages[page_idx].tab = health_layout_scaffold_add_tab(
         &s_scaffold, health_ui_metric_detail_get_tab_title(metric));
   }
 
-  page_pre_auth_overview_build(pre_auth_tab);
-  page_dashboard_main_build(health_tab);
-  page_home_main_build(home_tab);
-  page_settings_layout_build(setting_tab);
-  page_user_detail_layout_build(user_tab);
-  for (metric_idx = 0U; metric_idx < (uint32_t)HEALTH_UI_METRIC_DETAIL_COUNT;
-       metric_idx++) {
-    health_ui_metric_detail_t metric = (health_ui_metric_detail_t)metric_idx;
-    page_metric_detail_layout_build(metric_detail_tabs[metric_idx], metric);
+#if (HEALTH_UI_LAZY_PAGES == 0U)
+  for (page_idx = 0U; page_idx < (uint32_t)HEALTH_UI_PAGE_COUNT; page_idx++) {
+    ensure_page_built((health_ui_page_t)page_idx);
   }
+#endif
   sync_selected_user_views();
 
 #if (HEALTH_UI_ENABLE_OVERLAY_DEBUG != 0U)
   comp_overlay_manager_create(s_scaffold.screen);
 #endif
-  lv_tabview_set_active(s_scaffold.tabview, HEALTH_UI_DEBUG_START_TAB_IDX,
-                        LV_ANIM_OFF);
+  health_ui_root_set_active_page((health_ui_page_t)HEALTH_UI_DEBUG_START_TAB_IDX,
+                                 false);
 #if (HEALTH_UI_ENABLE_SIM_DATA != 0U)
   health_ui_sim_data_init();
 #endif
 #if defined(ENABLE_BLE_DATA_BRIDGE) && (ENABLE_BLE_DATA_BRIDGE != 0)
   health_data_bridge_init();
+#elif (HEALTH_UI_ENABLE_SIM_DATA != 0U)
+  /* No bridge to pair real devices: the sim catalog fills the device list. */
+  health_ui_sim_data_register_devices();
 #endif
   health_ui_root_set_household_summary("Zac's Family", 10U);
   lv_scr_load(s_scaffold.screen);
 }
 
-void health_ui_root_poll(void) {}
+void health_ui_root_poll(void) {
+  /* New store data: bound widgets redraw only where a value changed. */
+  (void)health_ui_data_publish_dashboard(s_household_member_count);
+  page_user_detail_layout_refresh();
+}
 
 void health_ui_root_on_alive_tick(unsigned long alive_sec) {
 #if (HEALTH_UI_ENABLE_SIM_DATA != 0U)
@@ -110,6 +252,10 @@ void health_ui_root_on_alive_tick(unsigned long alive_sec) {
 #else
   comp_system_status_bar_set_alive(alive_sec);
 #endif
+  /* Cheap when nothing changed: bound widgets only redraw on a new value. */
+  (void)health_ui_data_publish_dashboard(s_household_member_count);
+  (void)health_ui_data_publish_storage();
+  page_user_detail_layout_refresh();
 }
 
 void health_ui_root_set_active_page(health_ui_page_t page, bool animate) {
@@ -118,14 +264,27 @@ void health_ui_root_set_active_page(health_ui_page_t page, bool animate) {
     return;
   }
 
+  ensure_page_built(page);
+  s_pages[(uint32_t)page].last_used = ++s_page_use_clock;
+
   lv_tabview_set_active(s_scaffold.tabview, (uint32_t)page,
                         animate ? LV_ANIM_ON : LV_ANIM_OFF);
+
+  schedule_detail_eviction();
+}
+
+void health_ui_root_set_detail_page_budget(size_t budget_bytes) {
+  s_detail_page_budget = budget_bytes;
+  if (NULL != s_scaffold.tabview) {
+    schedule_detail_eviction();
+  }
 }
 
 void health_ui_root_set_household_summary(const char *family_name,
                                           uint32_t member_count) {
-  comp_tab_menu_set_family_summary(family_name, member_count);
-  page_dashboard_main_set_member_count(member_count);
+  s_household_member_count = member_count;
+  comp_tab_menu_publish_family_summary(family_name, member_count);
+  (void)health_ui_data_publish_dashboard(member_count);
 }
 
 void health_ui_root_set_selected_member_index(uint32_t member_index) {
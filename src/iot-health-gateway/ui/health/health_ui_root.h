@@ -2,6 +2,7 @@
 #define HEALTH_UI_ROOT_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 typedef enum {
@@ -52,5 +53,9 @@ void health_ui_root_set_selected_user_profile(const char *user_name,
 void health_ui_root_update_system_status(
     const health_ui_system_status_t *status);
 void health_ui_root_open_metric_detail(health_ui_metric_detail_t metric);
+/* Pages are built when first shown; metric detail pages beyond this LVGL
+ * heap budget are torn down least-recently-used first and rebuilt on the
+ * next visit. Default HEALTH_UI_DETAIL_PAGE_BUDGET_BYTES. */
+void health_ui_root_set_detail_page_budget(size_t budget_bytes);
 
 #endif
@@ -21,26 +21,17 @@
  *   Icon SM       montserrat_20    montserrat_16
  ******************************************************************************/
 
-#if (MY_DISP_VER_RES >= 600)
-/* 7" display (1024×600) */
-#define HL_FONT_HERO     (&lv_font_montserrat_36)
-#define HL_FONT_TITLE    (&lv_font_montserrat_24)
-#define HL_FONT_HEADING  (&lv_font_montserrat_20)
-#define HL_FONT_BODY     (&lv_font_montserrat_16)
-#define HL_FONT_CAPTION  (&lv_font_montserrat_14)
-#define HL_FONT_SMALL    (&lv_font_montserrat_12)
-#define HL_FONT_ICON_LG  (&lv_font_montserrat_24)
-#define HL_FONT_ICON_SM  (&lv_font_montserrat_20)
-#else
-/* 4.3" display (832×480) */
-#define HL_FONT_HERO     (&lv_font_montserrat_28)
-#define HL_FONT_TITLE    (&lv_font_montserrat_20)
-#define HL_FONT_HEADING  (&lv_font_montserrat_16)
-#define HL_FONT_BODY     (&lv_font_montserrat_14)
+/* Left: 7" display (1024×600), right: 4.3" display (832×480). Constant
+ * unless HEALTH_UI_VIEWPORT_HOT_SWITCH is set. */
+#define HL_FONT_STEP(tall, compact) (HL_VIEWPORT_IS_TALL ? (tall) : (compact))
+
+#define HL_FONT_HERO     HL_FONT_STEP(&lv_font_montserrat_36, &lv_font_montserrat_28)
+#define HL_FONT_TITLE    HL_FONT_STEP(&lv_font_montserrat_24, &lv_font_montserrat_20)
+#define HL_FONT_HEADING  HL_FONT_STEP(&lv_font_montserrat_20, &lv_font_montserrat_16)
+#define HL_FONT_BODY     HL_FONT_STEP(&lv_font_montserrat_16, &lv_font_montserrat_14)
 #define HL_FONT_CAPTION  (&lv_font_montserrat_14)
 #define HL_FONT_SMALL    (&lv_font_montserrat_12)
-#define HL_FONT_ICON_LG  (&lv_font_montserrat_20)
-#define HL_FONT_ICON_SM  (&lv_font_montserrat_16)
-#endif
+#define HL_FONT_ICON_LG  HL_FONT_STEP(&lv_font_montserrat_24, &lv_font_montserrat_20)
+#define HL_FONT_ICON_SM  HL_FONT_STEP(&lv_font_montserrat_20, &lv_font_montserrat_16)
 
 #endif
@@ -0,0 +1,112 @@
+/* GENERATED by tools/gen_layout_tokens.py -- do not edit.
+ * Pre-scaled layout tokens, one row per viewport (reference 1024x600).
+ * Include through health_ui_display_policy.h only. */
+#ifndef HEALTH_LAYOUT_TOKEN_TABLES_H
+#define HEALTH_LAYOUT_TOKEN_TABLES_H
+
+#include <stdint.h>
+
+#define HL_VIEWPORT_COUNT (4U)
+#define HL_VIEWPORT_800X480 (0U)
+#define HL_VIEWPORT_832X480 (1U)
+#define HL_VIEWPORT_1024X600 (2U)
+#define HL_VIEWPORT_1280X800 (3U)
+
+/* Viewport this build targets */
+#if (MY_DISP_HOR_RES == 800U) && (MY_DISP_VER_RES == 480U)
+#define HL_VIEWPORT_BUILD HL_VIEWPORT_800X480
+#elif (MY_DISP_HOR_RES == 832U) && (MY_DISP_VER_RES == 480U)
+#define HL_VIEWPORT_BUILD HL_VIEWPORT_832X480
+#elif (MY_DISP_HOR_RES == 1024U) && (MY_DISP_VER_RES == 600U)
+#define HL_VIEWPORT_BUILD HL_VIEWPORT_1024X600
+#elif (MY_DISP_HOR_RES == 1280U) && (MY_DISP_VER_RES == 800U)
+#define HL_VIEWPORT_BUILD HL_VIEWPORT_1280X800
+#else
+#error "No layout token table for this viewport: add it to tools/gen_layout_tokens.py"
+#endif
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+} hl_viewport_desc_t;
+
+static const hl_viewport_desc_t hl_viewports[HL_VIEWPORT_COUNT] = {
+    {800, 480},
+    {832, 480},
+    {1024, 600},
+    {1280, 800},
+};
+
+/* HL_SCALE_V(px) slots */
+#define HL_VSLOT_0 (0)
+#define HL_VSLOT_1 (1)
+#define HL_VSLOT_2 (2)
+#define HL_VSLOT_4 (3)
+#define HL_VSLOT_6 (4)
+#define HL_VSLOT_8 (5)
+#define HL_VSLOT_10 (6)
+#define HL_VSLOT_12 (7)
+#define HL_VSLOT_16 (8)
+#define HL_VSLOT_20 (9)
+#define HL_VSLOT_24 (10)
+#define HL_VSLOT_26 (11)
+#define HL_VSLOT_32 (12)
+#define HL_VSLOT_34 (13)
+#define HL_VSLOT_36 (14)
+#define HL_VSLOT_38 (15)
+#define HL_VSLOT_42 (16)
+#define HL_VSLOT_44 (17)
+#define HL_VSLOT_52 (18)
+#define HL_VSLOT_56 (19)
+#define HL_VSLOT_60 (20)
+#define HL_VSLOT_64 (21)
+#define HL_VSLOT_66 (22)
+#define HL_VSLOT_76 (23)
+#define HL_VSLOT_88 (24)
+#define HL_VSLOT_96 (25)
+#define HL_VSLOT_114 (26)
+#define HL_VSLOT_130 (27)
+#define HL_VSLOT_148 (28)
+#define HL_VSLOT_180 (29)
+#define HL_VSLOT_190 (30)
+#define HL_VSLOT_236 (31)
+#define HL_VSLOT_250 (32)
+#define HL_VSLOT_290 (33)
+#define HL_VSLOT_320 (34)
+#define HL_VSLOT_COUNT (35)
+
+static const int16_t hl_v_tokens[HL_VIEWPORT_COUNT][HL_VSLOT_COUNT] = {
+    /* 800x480 */
+    {0, 0, 1, 3, 4, 6, 8, 9, 12, 16, 19, 20, 25, 27, 28, 30,
+     33, 35, 41, 44, 48, 51, 52, 60, 70, 76, 91, 104, 118, 144, 152, 188,
+     200, 232, 256},
+    /* 832x480 */
+    {0, 0, 1, 3, 4, 6, 8, 9, 12, 16, 19, 20, 25, 27, 28, 30,
+     33, 35, 41, 44, 48, 51, 52, 60, 70, 76, 91, 104, 118, 144, 152, 188,
+     200, 232, 256},
+    /* 1024x600 */
+    {0, 1, 2, 4, 6, 8, 10, 12, 16, 20, 24, 26, 32, 34, 36, 38,
+     42, 44, 52, 56, 60, 64, 66, 76, 88, 96, 114, 130, 148, 180, 190, 236,
+     250, 290, 320},
+    /* 1280x800 */
+    {0, 1, 2, 5, 8, 10, 13, 16, 21, 26, 32, 34, 42, 45, 48, 50,
+     56, 58, 69, 74, 80, 85, 88, 101, 117, 128, 152, 173, 197, 240, 253, 314,
+     333, 386, 426},
+};
+
+/* HL_SCALE_H(px) slots */
+#define HL_HSLOT_0 (0)
+#define HL_HSLOT_COUNT (1)
+
+static const int16_t hl_h_tokens[HL_VIEWPORT_COUNT][HL_HSLOT_COUNT] = {
+    /* 800x480 */
+    {0},
+    /* 832x480 */
+    {0},
+    /* 1024x600 */
+    {0},
+    /* 1280x800 */
+    {0},
+};
+
+#endif
@@ -0,0 +1,22 @@
+#include "../health_ui_display_policy.h"
+
+#if HEALTH_UI_VIEWPORT_HOT_SWITCH
+uint32_t hl_viewport_index = HL_VIEWPORT_BUILD;
+#endif
+
+bool hl_viewport_select(uint32_t width, uint32_t height) {
+  uint32_t i;
+
+  for (i = 0U; i < HL_VIEWPORT_COUNT; i++) {
+    if ((hl_viewports[i].width != width) || (hl_viewports[i].height != height)) {
+      continue;
+    }
+#if HEALTH_UI_VIEWPORT_HOT_SWITCH
+    hl_viewport_index = i;
+    return true;
+#else
+    return (i == HL_VIEWPORT_BUILD);
+#endif
+  }
+  return false;
+}
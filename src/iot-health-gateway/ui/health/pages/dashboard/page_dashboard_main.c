@@ -3,6 +3,7 @@
 #include "../../components/content/comp_device_card.h"
 #include "../../components/content/comp_pager_dots.h"
 #include "../../components/content/comp_user_card.h"
+#include "../../components/content/comp_virtual_carousel.h"
 #include "../../components/header/comp_tab_menu.h"
 #include "../../components/overlay/comp_add_device_flow_modal.h"
 #include "../../health_ui_root.h"
@@ -12,16 +13,16 @@
 #include "../../health_ui_data_adapter.h"
 #include "../../health_ui_display_policy.h"
 
-#include <limits.h>
 #include <stdio.h>
+#include <string.h>
 
 /* Dashboard layout tuning knobs (override by -D compile flags if needed). */
 #ifndef DASH_MEMBER_PER_PAGE
-#if (MY_DISP_HOR_RES >= 1024)
-#define DASH_MEMBER_PER_PAGE (4U)
-#else
-#define DASH_MEMBER_PER_PAGE (3U)
+#define DASH_MEMBER_PER_PAGE (HL_VIEWPORT_IS_WIDE ? 4U : 3U)
 #endif
+/* Card slots per carousel page: the largest DASH_MEMBER_PER_PAGE. */
+#ifndef DASH_MEMBER_PER_PAGE_MAX
+#define DASH_MEMBER_PER_PAGE_MAX (4U)
 #endif
 
 #ifndef DASH_MEMBER_SECTION_H_PX
@@ -86,10 +87,6 @@
 #define DASH_DEVICE_TITLE_FONT HL_FONT_HEADING
 #endif
 
-#ifndef DASH_DEVICE_TITLE_BUF_SIZE
-#define DASH_DEVICE_TITLE_BUF_SIZE (32U)
-#endif
-
 #ifndef DASH_DEVICE_ADD_BTN_SIZE_PX
 #define DASH_DEVICE_ADD_BTN_SIZE_PX (40)
 #endif
@@ -111,6 +108,7 @@
 #endif
 
 static lv_obj_t *s_member_carousel = NULL;
+static comp_virtual_carousel_t s_member_vc;
 static lv_obj_t *s_member_dots = NULL;
 static uint32_t s_member_count = 6U;
 static uint32_t s_member_page_count = 0U;
@@ -118,13 +116,14 @@ static uint32_t s_member_dot_count = 0U;
 static uint32_t s_member_active_page = 0U;
 static lv_obj_t *s_device_title_label = NULL;
 static lv_obj_t *s_device_carousel = NULL;
+static comp_virtual_carousel_t s_device_vc;
 static lv_obj_t *s_device_dots = NULL;
-/* Runtime count driving both header title and card generation; sourced from sim in layout phase. */
+/* Counts follow the adapter's dashboard subjects (see bind_dashboard_counts);
+ * the device count is hdp_get_device_count(). */
 static uint32_t s_device_count = DASH_DEVICE_DEFAULT_COUNT;
 static uint32_t s_device_page_count = 0U;
 static uint32_t s_device_dot_count = 0U;
 static uint32_t s_device_active_page = 0U;
-static char s_device_title_text[DASH_DEVICE_TITLE_BUF_SIZE] = "Devices: 0";
 
 typedef struct {
   char user_name[DASH_MEMBER_NAME_BUF_SIZE];
@@ -134,6 +133,20 @@ typedef struct {
   uint32_t avatar_bg_color_hex;
 } member_card_ctx_t;
 
+/* Card instances owned by one carousel slot; rebound as the slot is recycled. */
+typedef struct {
+  lv_obj_t *cards[DASH_MEMBER_PER_PAGE_MAX];
+  member_card_ctx_t ctx[DASH_MEMBER_PER_PAGE_MAX];
+} member_slot_t;
+
+typedef struct {
+  lv_obj_t *cards[DASH_DEVICE_PER_PAGE];
+  lv_coord_t card_width_px;
+} device_slot_t;
+
+static member_slot_t s_member_slots[COMP_VIRTUAL_CAROUSEL_SLOT_COUNT];
+static device_slot_t s_device_slots[COMP_VIRTUAL_CAROUSEL_SLOT_COUNT];
+
 static void copy_member_profile_to_ctx(member_card_ctx_t *ctx,
                                        uint32_t member_index,
                                        const comp_user_card_data_t *member_data) {
@@ -199,7 +212,7 @@ static lv_obj_t *create_carousel_page(lv_obj_t *carousel, lv_coord_t col_gap,
   return page;
 }
 
-static void setup_horizontal_carousel(lv_obj_t *carousel, lv_event_cb_t on_scrolled) {
+static void setup_horizontal_carousel(lv_obj_t *carousel) {
   if (NULL == carousel) {
     return;
   }
@@ -216,8 +229,6 @@ static void setup_horizontal_carousel(lv_obj_t *carousel, lv_event_cb_t on_scrol
   lv_obj_set_scroll_snap_y(carousel, LV_SCROLL_SNAP_NONE);
   lv_obj_set_scrollbar_mode(carousel, LV_SCROLLBAR_MODE_OFF);
   lv_obj_add_flag(carousel, LV_OBJ_FLAG_SCROLL_ONE);
-  lv_obj_add_event_cb(carousel, on_scrolled, LV_EVENT_SCROLL, NULL);
-  lv_obj_add_event_cb(carousel, on_scrolled, LV_EVENT_SCROLL_END, NULL);
 }
 
 static lv_coord_t calc_full_page_card_width(lv_obj_t *page, uint32_t per_page,
@@ -262,13 +273,6 @@ static void add_event_bubble_recursive(lv_obj_t *obj) {
   }
 }
 
-static void on_member_card_deleted(lv_event_t *e) {
-  member_card_ctx_t *ctx = (member_card_ctx_t *)lv_event_get_user_data(e);
-  if (NULL != ctx) {
-    lv_free(ctx);
-  }
-}
-
 static void on_member_card_clicked(lv_event_t *e) {
   member_card_ctx_t *ctx = (member_card_ctx_t *)lv_event_get_user_data(e);
   const char *user_name = "Member";
@@ -321,198 +325,195 @@ static void sync_dots(lv_obj_t *dots, uint32_t page_count, uint32_t active_page,
   }
 }
 
-static uint32_t get_active_page_from_scroll(lv_obj_t *carousel,
-                                            uint32_t page_count) {
-  uint32_t i;
-  uint32_t nearest_idx = 0U;
-  lv_area_t carousel_coords;
-  int32_t viewport_center_x;
-  int32_t nearest_distance = INT_MAX;
+static void sync_member_dots(uint32_t active_page) {
+  sync_dots(s_member_dots, s_member_page_count, active_page, &s_member_dot_count,
+            &s_member_active_page);
+}
 
-  if ((NULL == carousel) || (0U == page_count)) {
-    return 0U;
-  }
+static void sync_device_dots(uint32_t active_page) {
+  sync_dots(s_device_dots, s_device_page_count, active_page, &s_device_dot_count,
+            &s_device_active_page);
+}
+
+static lv_obj_t *create_member_slot(lv_obj_t *carousel, uint32_t slot_id,
+                                    void *user_data) {
+  (void)user_data;
+  (void)memset(&s_member_slots[slot_id], 0, sizeof(s_member_slots[slot_id]));
+  return create_carousel_page(carousel, 0, LV_FLEX_ALIGN_SPACE_EVENLY,
+                              LV_FLEX_ALIGN_START);
+}
 
-  lv_obj_get_coords(carousel, &carousel_coords);
-  viewport_center_x =
-      carousel_coords.x1 + ((carousel_coords.x2 - carousel_coords.x1) / 2);
+static void bind_member_slot(lv_obj_t *page, uint32_t slot_id, uint32_t page_idx,
+                             void *user_data) {
+  member_slot_t *slot = &s_member_slots[slot_id];
+  uint32_t i;
 
-  for (i = 0U; i < page_count; i++) {
-    lv_obj_t *page = lv_obj_get_child(carousel, (int32_t)i);
-    lv_area_t page_coords;
-    int32_t page_center_x;
-    int32_t distance;
-    int64_t diff;
+  (void)user_data;
+  for (i = 0U; i < DASH_MEMBER_PER_PAGE; i++) {
+    uint32_t member_idx = (page_idx * DASH_MEMBER_PER_PAGE) + i;
+    comp_user_card_data_t member_data;
 
-    if (NULL == page) {
+    if (member_idx >= s_member_count) {
+      if (NULL != slot->cards[i]) {
+        lv_obj_add_flag(slot->cards[i], LV_OBJ_FLAG_HIDDEN);
+      }
       continue;
     }
 
-    lv_obj_get_coords(page, &page_coords);
-    page_center_x = page_coords.x1 + ((page_coords.x2 - page_coords.x1) / 2);
-    diff = (int64_t)page_center_x - (int64_t)viewport_center_x;
-    if (diff < 0) {
-      diff = -diff;
-    }
+    /* Layout phase: feed deterministic mock data until IPC binding is enabled. */
+    health_ui_data_build_member_card(member_idx, &member_data);
+    copy_member_profile_to_ctx(&slot->ctx[i], member_idx, &member_data);
 
-    if (diff > (int64_t)INT_MAX) {
-      distance = INT_MAX;
+    if (NULL == slot->cards[i]) {
+      slot->cards[i] = comp_user_card_create(page, &member_data);
+      if (NULL == slot->cards[i]) {
+        continue;
+      }
+      add_event_bubble_recursive(slot->cards[i]);
+      lv_obj_add_event_cb(slot->cards[i], on_member_card_clicked, LV_EVENT_CLICKED,
+                          &slot->ctx[i]);
     } else {
-      distance = (int32_t)diff;
-    }
-
-    if (distance < nearest_distance) {
-      nearest_distance = distance;
-      nearest_idx = i;
+      comp_user_card_bind(slot->cards[i], &member_data);
+      lv_obj_clear_flag(slot->cards[i], LV_OBJ_FLAG_HIDDEN);
     }
   }
-
-  return nearest_idx;
 }
 
-static void sync_member_dots(uint32_t active_page) {
-  sync_dots(s_member_dots, s_member_page_count, active_page, &s_member_dot_count,
-            &s_member_active_page);
-}
-
-static void sync_device_dots(uint32_t active_page) {
-  sync_dots(s_device_dots, s_device_page_count, active_page, &s_device_dot_count,
-            &s_device_active_page);
-}
-
-static void update_device_title(void) {
-  if (NULL == s_device_title_label) {
-    return;
-  }
-
-  (void)snprintf(s_device_title_text, sizeof(s_device_title_text), "Devices: %lu",
-                 (unsigned long)s_device_count);
-  lv_label_set_text(s_device_title_label, s_device_title_text);
+static void on_member_page_changed(uint32_t active_page, void *user_data) {
+  (void)user_data;
+  sync_member_dots(active_page);
 }
 
 static void rebuild_member_carousel(void) {
-  uint32_t page_idx;
-  uint32_t member_idx;
-
   if ((NULL == s_member_carousel) || (NULL == s_member_dots)) {
     return;
   }
 
   s_member_page_count = calc_page_count(s_member_count, DASH_MEMBER_PER_PAGE);
 
-  /* Rebuild pages from scratch so member-count changes are deterministic. */
-  lv_obj_clean(s_member_carousel);
-  for (page_idx = 0U; page_idx < s_member_page_count; page_idx++) {
-    uint32_t start_idx = page_idx * DASH_MEMBER_PER_PAGE;
-    uint32_t end_idx = start_idx + DASH_MEMBER_PER_PAGE;
-    lv_obj_t *page = create_carousel_page(
-        s_member_carousel, 0, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_START);
+  /* Only the visible page and its neighbours are materialized; existing
+   * cards are rebound, so member-count changes never rebuild the cards. */
+  s_member_dot_count = 0U;
+  comp_virtual_carousel_set_page_count(&s_member_vc, s_member_page_count);
+}
 
-    if (end_idx > s_member_count) {
-      end_idx = s_member_count;
-    }
-    if (NULL == page) {
-      continue;
-    }
+static lv_obj_t *create_device_slot(lv_obj_t *carousel, uint32_t slot_id,
+                                    void *user_data) {
+  device_slot_t *slot = &s_device_slots[slot_id];
+  lv_obj_t *page;
 
-    for (member_idx = start_idx; member_idx < end_idx; member_idx++) {
-      comp_user_card_data_t member_data;
-      lv_obj_t *card;
-      member_card_ctx_t *ctx;
-      /* Layout phase: feed deterministic mock data until IPC binding is enabled. */
-      health_ui_data_build_member_card(member_idx, &member_data);
+  (void)user_data;
+  (void)memset(slot, 0, sizeof(*slot));
+  page = create_carousel_page(carousel, DASH_DEVICE_PAGE_CARD_GAP_PX,
+                              LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER);
 
-      card = comp_user_card_create(page, &member_data);
-      if (NULL == card) {
-        continue;
-      }
+  /* Runtime width keeps 4 cards balanced across supported display profiles. */
+  slot->card_width_px = calc_full_page_card_width(page, DASH_DEVICE_PER_PAGE,
+                                                  DASH_DEVICE_PAGE_CARD_GAP_PX);
+  return page;
+}
 
-      add_event_bubble_recursive(card);
+static void bind_device_slot(lv_obj_t *page, uint32_t slot_id, uint32_t page_idx,
+                             void *user_data) {
+  device_slot_t *slot = &s_device_slots[slot_id];
+  uint32_t i;
 
-      ctx = (member_card_ctx_t *)lv_malloc(sizeof(*ctx));
-      if (NULL == ctx) {
-        continue;
+  (void)user_data;
+  for (i = 0U; i < DASH_DEVICE_PER_PAGE; i++) {
+    uint32_t device_idx = (page_idx * DASH_DEVICE_PER_PAGE) + i;
+    comp_device_card_data_t device_data;
+
+    if (device_idx >= s_device_count) {
+      if (NULL != slot->cards[i]) {
+        lv_obj_add_flag(slot->cards[i], LV_OBJ_FLAG_HIDDEN);
       }
+      continue;
+    }
 
-      copy_member_profile_to_ctx(ctx, member_idx, &member_data);
-      lv_obj_add_event_cb(card, on_member_card_clicked, LV_EVENT_CLICKED, ctx);
-      lv_obj_add_event_cb(card, on_member_card_deleted, LV_EVENT_DELETE, ctx);
+    health_ui_data_build_device_card(device_idx, &device_data);
+    if (NULL == slot->cards[i]) {
+      slot->cards[i] = comp_device_card_create(page, &device_data);
+      if ((NULL != slot->cards[i]) && (slot->card_width_px > 0)) {
+        lv_obj_set_width(slot->cards[i], slot->card_width_px);
+      }
+    } else {
+      comp_device_card_bind(slot->cards[i], &device_data);
+      lv_obj_clear_flag(slot->cards[i], LV_OBJ_FLAG_HIDDEN);
     }
   }
-
-  lv_obj_scroll_to_x(s_member_carousel, 0, LV_ANIM_OFF);
-  s_member_dot_count = 0U;
-  sync_member_dots(0U);
 }
 
-static void on_member_carousel_scrolled(lv_event_t *e) {
-  uint32_t active_page;
-  lv_obj_t *carousel = lv_event_get_current_target(e);
-
-  if ((NULL == carousel) || (0U == s_member_page_count)) {
-    return;
-  }
-
-  active_page = get_active_page_from_scroll(carousel, s_member_page_count);
-  sync_member_dots(active_page);
+static void on_device_page_changed(uint32_t active_page, void *user_data) {
+  (void)user_data;
+  sync_device_dots(active_page);
 }
 
 static void rebuild_device_carousel(void) {
-  uint32_t page_idx;
-  uint32_t device_idx;
+  uint32_t page_count;
+  uint32_t active_page;
 
   if ((NULL == s_device_carousel) || (NULL == s_device_dots)) {
     return;
   }
 
-  s_device_page_count = calc_page_count(s_device_count, DASH_DEVICE_PER_PAGE);
-
-  lv_obj_clean(s_device_carousel);
-  for (page_idx = 0U; page_idx < s_device_page_count; page_idx++) {
-    uint32_t start_idx = page_idx * DASH_DEVICE_PER_PAGE;
-    uint32_t end_idx = start_idx + DASH_DEVICE_PER_PAGE;
-    lv_coord_t card_width_px;
-    lv_obj_t *page = create_carousel_page(
-        s_device_carousel, DASH_DEVICE_PAGE_CARD_GAP_PX, LV_FLEX_ALIGN_START,
-        LV_FLEX_ALIGN_CENTER);
-
-    if (end_idx > s_device_count) {
-      end_idx = s_device_count;
-    }
-    if (NULL == page) {
-      continue;
-    }
-
-    /* Runtime width keeps 4 cards balanced across supported display profiles. */
-    card_width_px = calc_full_page_card_width(page, DASH_DEVICE_PER_PAGE,
-                                              DASH_DEVICE_PAGE_CARD_GAP_PX);
-
-    for (device_idx = start_idx; device_idx < end_idx; device_idx++) {
-      comp_device_card_data_t device_data;
-      lv_obj_t *card;
-      health_ui_data_build_device_card(device_idx, &device_data);
-      card = comp_device_card_create(page, &device_data);
-      if ((NULL != card) && (card_width_px > 0)) {
-        lv_obj_set_width(card, card_width_px);
-      }
-    }
+  /* A device joining the last page only needs a rebind; otherwise keep the
+   * page the user was on (clamped) instead of jumping back to page 0. */
+  page_count = calc_page_count(s_device_count, DASH_DEVICE_PER_PAGE);
+  if ((page_count == s_device_vc.page_count) && (page_count > 0U)) {
+    comp_virtual_carousel_refresh(&s_device_vc);
+    return;
   }
 
-  lv_obj_scroll_to_x(s_device_carousel, 0, LV_ANIM_OFF);
+  active_page = s_device_vc.active_page;
+  s_device_page_count = page_count;
   s_device_dot_count = 0U;
-  sync_device_dots(0U);
+  comp_virtual_carousel_set_page_count(&s_device_vc, s_device_page_count);
+  if ((active_page > 0U) && (s_device_page_count > 0U)) {
+    comp_virtual_carousel_show_page(&s_device_vc, active_page);
+  }
 }
 
-static void on_device_carousel_scrolled(lv_event_t *e) {
-  uint32_t active_page;
-  lv_obj_t *carousel = lv_event_get_current_target(e);
+static void on_member_count_changed(lv_observer_t *observer,
+                                    lv_subject_t *subject) {
+  (void)observer;
+  s_member_count = (uint32_t)lv_subject_get_int(subject);
+  rebuild_member_carousel();
+}
 
-  if ((NULL == carousel) || (0U == s_device_page_count)) {
-    return;
+static void on_device_count_changed(lv_observer_t *observer,
+                                    lv_subject_t *subject) {
+  (void)observer;
+  s_device_count = (uint32_t)lv_subject_get_int(subject);
+  rebuild_device_carousel();
+}
+
+/* A device was added or renamed without the count changing pages: rebind the
+ * visible cards from the provider's device records. */
+static void on_device_generation_changed(lv_observer_t *observer,
+                                         lv_subject_t *subject) {
+  (void)observer;
+  (void)subject;
+  if (s_device_vc.page_count > 0U) {
+    comp_virtual_carousel_refresh(&s_device_vc);
   }
+}
 
-  active_page = get_active_page_from_scroll(carousel, s_device_page_count);
-  sync_device_dots(active_page);
+/* Observers are tied to the carousels and run once right away, which does
+ * the first build; later publishes rebuild only when a count changed. */
+static void bind_dashboard_counts(void) {
+  health_ui_dashboard_subjects_t *subjects = health_ui_data_get_dashboard_subjects();
+
+  (void)lv_label_bind_text(s_device_title_label, &subjects->device_count,
+                           "Devices: %d");
+  (void)lv_subject_add_observer_obj(&subjects->member_count,
+                                    on_member_count_changed, s_member_carousel,
+                                    NULL);
+  (void)lv_subject_add_observer_obj(&subjects->device_count,
+                                    on_device_count_changed, s_device_carousel,
+                                    NULL);
+  (void)lv_subject_add_observer_obj(&subjects->device_generation,
+                                    on_device_generation_changed,
+                                    s_device_carousel, NULL);
 }
 
 static void build_device_section(lv_obj_t *parent) {
@@ -522,9 +523,6 @@ static void build_device_section(lv_obj_t *parent) {
   lv_obj_t *add_label;
   lv_obj_t *panel;
 
-  /* In layout/sim mode, device section is rendered from sim inventory source. */
-  s_device_count = health_ui_data_get_device_count();
-
   device_section = lv_obj_create(parent);
   lv_obj_set_size(device_section, lv_pct(100), DASH_DEVICE_SECTION_H_PX);
   style_transparent_container(device_section);
@@ -550,7 +548,6 @@ static void build_device_section(lv_obj_t *parent) {
   lv_obj_clear_flag(header_row, LV_OBJ_FLAG_SCROLLABLE);
 
   s_device_title_label = lv_label_create(header_row);
-  lv_label_set_text(s_device_title_label, s_device_title_text);
   lv_obj_set_style_text_color(s_device_title_label,
                               lv_color_hex(DASH_DEVICE_TITLE_TEXT_COLOR_HEX),
                               LV_PART_MAIN);
@@ -589,11 +586,11 @@ static void build_device_section(lv_obj_t *parent) {
 
   s_device_carousel = lv_obj_create(panel);
   lv_obj_set_size(s_device_carousel, lv_pct(100), lv_pct(100));
-  setup_horizontal_carousel(s_device_carousel, on_device_carousel_scrolled);
+  setup_horizontal_carousel(s_device_carousel);
+  comp_virtual_carousel_init(&s_device_vc, s_device_carousel, create_device_slot,
+                             bind_device_slot, on_device_page_changed, NULL);
 
   s_device_dots = comp_pager_dots_create(device_section);
-  update_device_title();
-  rebuild_device_carousel();
 }
 
 void page_dashboard_main_build(lv_obj_t *tab) {
@@ -637,22 +634,12 @@ void page_dashboard_main_build(lv_obj_t *tab) {
 
   s_member_carousel = lv_obj_create(member_section);
   lv_obj_set_size(s_member_carousel, lv_pct(100), DASH_MEMBER_CAROUSEL_H_PX);
-  setup_horizontal_carousel(s_member_carousel, on_member_carousel_scrolled);
+  setup_horizontal_carousel(s_member_carousel);
+  comp_virtual_carousel_init(&s_member_vc, s_member_carousel, create_member_slot,
+                             bind_member_slot, on_member_page_changed, NULL);
 
   s_member_dots = comp_pager_dots_create(member_section);
 
-  rebuild_member_carousel();
   build_device_section(page);
-}
-
-void page_dashboard_main_set_member_count(uint32_t member_count) {
-  s_member_count = member_count;
-  rebuild_member_carousel();
-}
-
-void page_dashboard_main_set_device_count(uint32_t device_count) {
-  uint32_t available_count = health_ui_data_get_device_count();
-  s_device_count = (device_count < available_count) ? device_count : available_count;
-  update_device_title();
-  rebuild_device_carousel();
+  bind_dashboard_counts();
 }
@@ -4,10 +4,8 @@
 #include "lvgl.h"
 #include <stdint.h>
 
+/* Member/device counts come from the adapter's dashboard subjects
+ * (health_ui_data_publish_dashboard); the page rebuilds on a change. */
 void page_dashboard_main_build(lv_obj_t *tab);
-/* Updates simulated/runtime household member count and rebuilds member carousel. */
-void page_dashboard_main_set_member_count(uint32_t member_count);
-/* Updates simulated/runtime device count and rebuilds device section title/carousel. */
-void page_dashboard_main_set_device_count(uint32_t device_count);
 
 #endif
@@ -67,6 +67,14 @@ void page_metric_detail_layout_set_member_index(uint32_t member_index) {
   }
 }
 
+void page_metric_detail_layout_release(health_ui_metric_detail_t metric) {
+  if (!health_ui_metric_detail_is_valid(metric)) {
+    return;
+  }
+
+  s_metric_pages[(uint32_t)metric].content_root = NULL;
+}
+
 void page_metric_detail_layout_build(lv_obj_t *tab,
                                      health_ui_metric_detail_t metric) {
   lv_obj_t *page;
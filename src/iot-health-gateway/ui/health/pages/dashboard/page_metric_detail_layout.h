@@ -8,5 +8,7 @@
 void page_metric_detail_layout_build(lv_obj_t *tab,
                                      health_ui_metric_detail_t metric);
 void page_metric_detail_layout_set_member_index(uint32_t member_index);
+/* Forget the page's objects before its tab is cleaned (page eviction). */
+void page_metric_detail_layout_release(health_ui_metric_detail_t metric);
 
 #endif
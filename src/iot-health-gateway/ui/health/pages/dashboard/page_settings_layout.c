@@ -1,9 +1,12 @@
 #include "page_settings_layout.h"
 
 #include "../../components/header/comp_tab_menu.h"
+#include "../../health_ui_binding.h"
+#include "../../health_ui_data_adapter.h"
 #include "../../health_ui_root.h"
 #include "../../layout/layout_fonts.h"
 #include "../../layout/layout_scaffold.h"
+#include "../../layout/layout_tokens.h"
 
 static void on_back_clicked(lv_event_t *e) {
   (void)e;
@@ -13,6 +16,7 @@ static void on_back_clicked(lv_event_t *e) {
 void page_settings_layout_build(lv_obj_t *tab) {
   lv_obj_t *page;
   lv_obj_t *placeholder;
+  lv_obj_t *storage_label;
   comp_tab_menu_refs_t menu_refs;
 
   if (NULL == tab) {
@@ -35,4 +39,12 @@ void page_settings_layout_build(lv_obj_t *tab) {
   lv_obj_set_style_text_color(placeholder, lv_color_hex(0x6B7280), LV_PART_MAIN);
   lv_obj_set_style_text_font(placeholder, HL_FONT_HEADING, LV_PART_MAIN);
   lv_obj_align(placeholder, LV_ALIGN_CENTER, 0, 0);
+
+  /* Refreshed by the alive tick (health_ui_data_publish_storage). */
+  storage_label = lv_label_create(page);
+  lv_obj_set_style_text_color(storage_label, lv_color_hex(0x6B7280), LV_PART_MAIN);
+  lv_obj_set_style_text_font(storage_label, HL_FONT_BODY, LV_PART_MAIN);
+  lv_obj_align_to(storage_label, placeholder, LV_ALIGN_OUT_BOTTOM_MID, 0, HL_SPACE_SM);
+  (void)health_ui_data_publish_storage();
+  (void)health_ui_bind_label(storage_label, health_ui_data_get_storage_subject());
 }
@@ -7,7 +7,6 @@
 
 #include <stdbool.h>
 #include <stdio.h>
-#include <stdlib.h>
 #include <string.h>
 
 #define USER_DETAIL_TITLE_TEXT_COLOR_HEX (0x002329)
@@ -32,12 +31,6 @@ static bool s_loading_icon_visible =
     ((USER_DETAIL_LOADING_ICON_DEFAULT_VISIBLE) != 0);
 static char s_user_name_text[96] = "Member";
 
-typedef enum {
-  USER_DETAIL_TREND_UNKNOWN = 0,
-  USER_DETAIL_TREND_UP,
-  USER_DETAIL_TREND_DOWN
-} user_detail_trend_t;
-
 typedef struct {
   health_ui_metric_detail_t metric;
 } metric_nav_ctx_t;
@@ -173,6 +166,46 @@ static void apply_loading_icon_visibility(void) {
   }
 }
 
+static void on_card_status_level(lv_observer_t *observer, lv_subject_t *subject) {
+  lv_obj_t *card = lv_observer_get_target_obj(observer);
+  comp_user_status_level_t level =
+      (comp_user_status_level_t)lv_subject_get_int(subject);
+
+  lv_obj_set_style_bg_color(card, get_card_bg_by_status(level), LV_PART_MAIN);
+  lv_obj_set_style_border_color(card, get_card_border_by_status(level),
+                                LV_PART_MAIN);
+  lv_obj_set_style_border_width(card, get_card_border_width_by_status(level),
+                                LV_PART_MAIN);
+}
+
+static void on_chip_status_level(lv_observer_t *observer, lv_subject_t *subject) {
+  lv_obj_t *chip = lv_observer_get_target_obj(observer);
+  lv_obj_t *label = lv_obj_get_child(chip, 0);
+  comp_user_status_level_t level =
+      (comp_user_status_level_t)lv_subject_get_int(subject);
+
+  lv_obj_set_style_bg_color(chip, get_status_chip_bg_color(level), LV_PART_MAIN);
+  if (NULL != label) {
+    lv_obj_set_style_text_color(label, get_status_text_color(level),
+                                LV_PART_MAIN);
+  }
+}
+
+/* Trend column children: 0 = up arrow, 1 = down arrow. */
+static void on_trend_changed(lv_observer_t *observer, lv_subject_t *subject) {
+  lv_obj_t *trend_col = lv_observer_get_target_obj(observer);
+  health_ui_trend_t trend = (health_ui_trend_t)lv_subject_get_int(subject);
+  lv_color_t active_color = lv_color_hex(USER_DETAIL_TREND_ACTIVE_COLOR_HEX);
+  lv_color_t muted_color = lv_color_hex(USER_DETAIL_TREND_MUTED_COLOR_HEX);
+
+  lv_obj_set_style_text_color(
+      lv_obj_get_child(trend_col, 0),
+      (HEALTH_UI_TREND_UP == trend) ? active_color : muted_color, LV_PART_MAIN);
+  lv_obj_set_style_text_color(
+      lv_obj_get_child(trend_col, 1),
+      (HEALTH_UI_TREND_DOWN == trend) ? active_color : muted_color, LV_PART_MAIN);
+}
+
 static lv_obj_t *create_transparent_row(lv_obj_t *parent, lv_coord_t col_gap,
                                         lv_flex_align_t main_align) {
   lv_obj_t *row = lv_obj_create(parent);
@@ -189,16 +222,11 @@ static lv_obj_t *create_transparent_row(lv_obj_t *parent, lv_coord_t col_gap,
   return row;
 }
 
-static lv_obj_t *create_card_shell(lv_obj_t *parent, lv_color_t bg_color,
-                                   lv_color_t border_color,
-                                   lv_coord_t border_width) {
+static lv_obj_t *create_card_shell(lv_obj_t *parent, lv_subject_t *level) {
   lv_obj_t *card = lv_obj_create(parent);
   lv_obj_set_height(card, lv_pct(100));
-  lv_obj_set_style_bg_color(card, bg_color, LV_PART_MAIN);
   lv_obj_set_style_bg_opa(card, LV_OPA_COVER, LV_PART_MAIN);
   lv_obj_set_style_radius(card, USER_DETAIL_CARD_RADIUS_PX, LV_PART_MAIN);
-  lv_obj_set_style_border_width(card, border_width, LV_PART_MAIN);
-  lv_obj_set_style_border_color(card, border_color, LV_PART_MAIN);
   lv_obj_set_style_shadow_width(card, 0, LV_PART_MAIN);
   lv_obj_set_style_pad_left(card, 14, LV_PART_MAIN);
   lv_obj_set_style_pad_right(card, 14, LV_PART_MAIN);
@@ -210,6 +238,8 @@ static lv_obj_t *create_card_shell(lv_obj_t *parent, lv_color_t bg_color,
   lv_obj_set_flex_align(card, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START,
                         LV_FLEX_ALIGN_START);
   lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+  /* Paints the status colours now and again whenever the level changes. */
+  (void)lv_subject_add_observer_obj(level, on_card_status_level, card, NULL);
   return card;
 }
 
@@ -236,60 +266,12 @@ static const char *metric_icon_from_title(const char *title_text) {
   return "M";
 }
 
-static bool parse_first_float(const char *text, float *out_value) {
-  char *end_ptr = NULL;
-  float parsed = 0.0f;
-
-  if ((NULL == text) || (NULL == out_value)) {
-    return false;
-  }
-
-  parsed = strtof(text, &end_ptr);
-  if (end_ptr == text) {
-    return false;
-  }
-
-  *out_value = parsed;
-  return true;
-}
-
-static user_detail_trend_t resolve_metric_trend(
-    const health_ui_user_detail_metric_card_t *metric) {
-  float current = 0.0f;
-  float previous = 0.0f;
-  float diff = 0.0f;
-
-  if ((NULL == metric) || (!metric->previous_available)) {
-    return USER_DETAIL_TREND_UNKNOWN;
-  }
-
-  if (!parse_first_float(metric->value_text, &current) ||
-      !parse_first_float(metric->previous_value_text, &previous)) {
-    return USER_DETAIL_TREND_UNKNOWN;
-  }
-
-  diff = current - previous;
-  if (diff > 0.001f) {
-    return USER_DETAIL_TREND_UP;
-  }
-  if (diff < -0.001f) {
-    return USER_DETAIL_TREND_DOWN;
-  }
-
-  return USER_DETAIL_TREND_UNKNOWN;
-}
-
-static lv_obj_t *create_trend_indicator(lv_obj_t *parent,
-                                        user_detail_trend_t trend) {
+/* trend == NULL leaves both arrows muted (BP columns have no trend). */
+static lv_obj_t *create_trend_indicator(lv_obj_t *parent, lv_subject_t *trend) {
   lv_obj_t *trend_col;
   lv_obj_t *up_label;
   lv_obj_t *down_label;
-  lv_color_t active_color = lv_color_hex(USER_DETAIL_TREND_ACTIVE_COLOR_HEX);
   lv_color_t muted_color = lv_color_hex(USER_DETAIL_TREND_MUTED_COLOR_HEX);
-  lv_color_t up_color =
-      (USER_DETAIL_TREND_UP == trend) ? active_color : muted_color;
-  lv_color_t down_color =
-      (USER_DETAIL_TREND_DOWN == trend) ? active_color : muted_color;
 
   trend_col = lv_obj_create(parent);
   lv_obj_set_size(trend_col, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
@@ -305,24 +287,28 @@ static lv_obj_t *create_trend_indicator(lv_obj_t *parent,
 
   up_label = lv_label_create(trend_col);
   lv_label_set_text(up_label, LV_SYMBOL_UP);
-  lv_obj_set_style_text_color(up_label, up_color, LV_PART_MAIN);
+  lv_obj_set_style_text_color(up_label, muted_color, LV_PART_MAIN);
   lv_obj_set_style_text_font(up_label, USER_DETAIL_FONT_TREND, LV_PART_MAIN);
 
   down_label = lv_label_create(trend_col);
   lv_label_set_text(down_label, LV_SYMBOL_DOWN);
-  lv_obj_set_style_text_color(down_label, down_color, LV_PART_MAIN);
+  lv_obj_set_style_text_color(down_label, muted_color, LV_PART_MAIN);
   lv_obj_set_style_text_font(down_label, USER_DETAIL_FONT_TREND, LV_PART_MAIN);
 
+  if (NULL != trend) {
+    (void)lv_subject_add_observer_obj(trend, on_trend_changed, trend_col, NULL);
+  }
+
   return trend_col;
 }
 
-static void create_status_chip(lv_obj_t *parent, const char *status_text,
-                               comp_user_status_level_t level) {
+static void create_status_chip(lv_obj_t *parent,
+                               health_ui_text_subject_t *status_text,
+                               lv_subject_t *level) {
   lv_obj_t *chip = lv_obj_create(parent);
   lv_obj_t *label;
 
   lv_obj_set_size(chip, lv_pct(100), HL_SCALE_V(26));
-  lv_obj_set_style_bg_color(chip, get_status_chip_bg_color(level), LV_PART_MAIN);
   lv_obj_set_style_bg_opa(chip, LV_OPA_COVER, LV_PART_MAIN);
   lv_obj_set_style_radius(chip, 14, LV_PART_MAIN);
   lv_obj_set_style_border_width(chip, 0, LV_PART_MAIN);
@@ -330,16 +316,18 @@ static void create_status_chip(lv_obj_t *parent, const char *status_text,
   lv_obj_clear_flag(chip, LV_OBJ_FLAG_SCROLLABLE);
 
   label = lv_label_create(chip);
-  lv_label_set_text(label, (NULL != status_text) ? status_text : "Normal");
-  lv_obj_set_style_text_color(label, get_status_text_color(level), LV_PART_MAIN);
+  (void)health_ui_bind_label(label, status_text);
   lv_obj_set_style_text_font(label, USER_DETAIL_FONT_STATUS, LV_PART_MAIN);
   lv_obj_center(label);
+
+  (void)lv_subject_add_observer_obj(level, on_chip_status_level, chip, NULL);
 }
 
-static void create_bp_value_column(lv_obj_t *parent, const char *value_text,
-                                   const char *name_text, const char *unit_text,
-                                   const char *status_text,
-                                   comp_user_status_level_t status_level) {
+static void create_bp_value_column(lv_obj_t *parent,
+                                   health_ui_text_subject_t *value_text,
+                                   const char *name_text,
+                                   health_ui_text_subject_t *unit_text,
+                                   health_ui_bp_summary_subjects_t *bp) {
   lv_obj_t *col;
   lv_obj_t *value_row;
   lv_obj_t *value_group;
@@ -363,7 +351,7 @@ static void create_bp_value_column(lv_obj_t *parent, const char *value_text,
   lv_obj_clear_flag(col, LV_OBJ_FLAG_SCROLLABLE);
 
   value_row = create_transparent_row(col, 8, LV_FLEX_ALIGN_SPACE_BETWEEN);
-  (void)create_trend_indicator(value_row, USER_DETAIL_TREND_UNKNOWN);
+  (void)create_trend_indicator(value_row, NULL);
 
   value_group = lv_obj_create(value_row);
   lv_obj_set_size(value_group, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
@@ -378,7 +366,7 @@ static void create_bp_value_column(lv_obj_t *parent, const char *value_text,
   lv_obj_clear_flag(value_group, LV_OBJ_FLAG_SCROLLABLE);
 
   value_label = lv_label_create(value_group);
-  lv_label_set_text(value_label, (NULL != value_text) ? value_text : "--");
+  (void)health_ui_bind_label(value_label, value_text);
   lv_obj_set_style_text_color(value_label, lv_color_hex(0x101828), LV_PART_MAIN);
   lv_obj_set_style_text_font(value_label, USER_DETAIL_FONT_VALUE, LV_PART_MAIN);
 
@@ -388,14 +376,14 @@ static void create_bp_value_column(lv_obj_t *parent, const char *value_text,
   lv_obj_set_style_text_font(name_label, USER_DETAIL_FONT_VALUE_META, LV_PART_MAIN);
 
   unit_label = lv_label_create(col);
-  lv_label_set_text(unit_label, (NULL != unit_text) ? unit_text : "");
+  (void)health_ui_bind_label(unit_label, unit_text);
   lv_obj_set_width(unit_label, lv_pct(100));
   lv_obj_set_style_text_align(unit_label, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN);
   lv_obj_set_style_text_color(unit_label, lv_color_hex(USER_DETAIL_MUTED_TEXT_COLOR_HEX),
                               LV_PART_MAIN);
   lv_obj_set_style_text_font(unit_label, USER_DETAIL_FONT_UNIT, LV_PART_MAIN);
 
-  create_status_chip(col, status_text, status_level);
+  create_status_chip(col, &bp->status, &bp->status_level);
 
   prev1 = lv_label_create(col);
   lv_label_set_text(prev1, "No Previous");
@@ -410,7 +398,7 @@ static void create_bp_value_column(lv_obj_t *parent, const char *value_text,
 }
 
 static void create_bp_summary_card(lv_obj_t *parent,
-                                   const health_ui_user_detail_bp_summary_t *bp) {
+                                   health_ui_bp_summary_subjects_t *bp) {
   lv_obj_t *card;
   lv_obj_t *header_row;
   lv_obj_t *left_group;
@@ -420,9 +408,7 @@ static void create_bp_summary_card(lv_obj_t *parent,
   lv_obj_t *time_label;
   lv_obj_t *value_row;
 
-  card = create_card_shell(parent, get_card_bg_by_status(bp->status_level),
-                           get_card_border_by_status(bp->status_level),
-                           get_card_border_width_by_status(bp->status_level));
+  card = create_card_shell(parent, &bp->status_level);
   lv_obj_set_size(card, 0, lv_pct(100));
   lv_obj_set_flex_grow(card, USER_DETAIL_BP_CARD_GROW);
 
@@ -456,7 +442,7 @@ static void create_bp_summary_card(lv_obj_t *parent,
   lv_obj_set_style_text_font(title, USER_DETAIL_FONT_CARD_TITLE, LV_PART_MAIN);
 
   time_label = lv_label_create(header_row);
-  lv_label_set_text(time_label, (NULL != bp->time_text) ? bp->time_text : "--:--");
+  (void)health_ui_bind_label(time_label, &bp->time);
   lv_label_set_long_mode(time_label, LV_LABEL_LONG_CLIP);
   lv_obj_set_width(time_label, USER_DETAIL_TIME_MIN_WIDTH_PX);
   lv_obj_set_style_text_align(time_label, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN);
@@ -466,18 +452,16 @@ static void create_bp_summary_card(lv_obj_t *parent,
   lv_obj_set_style_text_font(time_label, USER_DETAIL_FONT_TIME, LV_PART_MAIN);
 
   value_row = create_transparent_row(card, 10, LV_FLEX_ALIGN_START);
-  create_bp_value_column(value_row, bp->sys_value_text, "SYS", bp->sys_unit_text,
-                         bp->status_text, bp->status_level);
-  create_bp_value_column(value_row, bp->dia_value_text, "DIA", bp->dia_unit_text,
-                         bp->status_text, bp->status_level);
-  create_bp_value_column(value_row, bp->pulse_value_text, "PULSE",
-                         bp->pulse_unit_text, bp->status_text, bp->status_level);
+  create_bp_value_column(value_row, &bp->sys_value, "SYS", &bp->sys_unit, bp);
+  create_bp_value_column(value_row, &bp->dia_value, "DIA", &bp->dia_unit, bp);
+  create_bp_value_column(value_row, &bp->pulse_value, "PULSE", &bp->pulse_unit,
+                         bp);
 
   attach_metric_navigation(card, HEALTH_UI_METRIC_DETAIL_BP);
 }
 
 static void create_metric_card(lv_obj_t *parent,
-                               const health_ui_user_detail_metric_card_t *metric,
+                               health_ui_metric_card_subjects_t *metric,
                                lv_coord_t grow_units,
                                health_ui_metric_detail_t metric_id) {
   lv_obj_t *card;
@@ -493,11 +477,8 @@ static void create_metric_card(lv_obj_t *parent,
   lv_obj_t *unit_label;
   lv_obj_t *prev_line_1;
   lv_obj_t *prev_line_2;
-  user_detail_trend_t trend;
 
-  card = create_card_shell(parent, get_card_bg_by_status(metric->status_level),
-                           get_card_border_by_status(metric->status_level),
-                           get_card_border_width_by_status(metric->status_level));
+  card = create_card_shell(parent, &metric->status_level);
   lv_obj_set_size(card, 0, lv_pct(100));
   lv_obj_set_flex_grow(card, grow_units);
 
@@ -517,13 +498,14 @@ static void create_metric_card(lv_obj_t *parent,
   lv_obj_clear_flag(icon_bg, LV_OBJ_FLAG_SCROLLABLE);
 
   icon_label = lv_label_create(icon_bg);
-  lv_label_set_text(icon_label, metric_icon_from_title(metric->title_text));
+  lv_label_set_text(icon_label,
+                    metric_icon_from_title(lv_subject_get_string(&metric->title.subject)));
   lv_obj_set_style_text_color(icon_label, lv_color_hex(0x667085), LV_PART_MAIN);
   lv_obj_set_style_text_font(icon_label, USER_DETAIL_FONT_ICON, LV_PART_MAIN);
   lv_obj_center(icon_label);
 
   title = lv_label_create(left_group);
-  lv_label_set_text(title, (NULL != metric->title_text) ? metric->title_text : "Metric");
+  (void)health_ui_bind_label(title, &metric->title);
   lv_label_set_long_mode(title, LV_LABEL_LONG_DOT);
   lv_obj_set_width(title, USER_DETAIL_TITLE_MAX_WIDTH_PX);
   lv_obj_set_style_text_color(title, lv_color_hex(USER_DETAIL_TITLE_TEXT_COLOR_HEX),
@@ -531,8 +513,7 @@ static void create_metric_card(lv_obj_t *parent,
   lv_obj_set_style_text_font(title, USER_DETAIL_FONT_CARD_TITLE, LV_PART_MAIN);
 
   time_label = lv_label_create(header_row);
-  lv_label_set_text(time_label,
-                    (NULL != metric->time_text) ? metric->time_text : "--:--");
+  (void)health_ui_bind_label(time_label, &metric->time);
   lv_label_set_long_mode(time_label, LV_LABEL_LONG_CLIP);
   lv_obj_set_width(time_label, USER_DETAIL_TIME_MIN_WIDTH_PX);
   lv_obj_set_style_text_align(time_label, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN);
@@ -541,9 +522,8 @@ static void create_metric_card(lv_obj_t *parent,
                               LV_PART_MAIN);
   lv_obj_set_style_text_font(time_label, USER_DETAIL_FONT_TIME, LV_PART_MAIN);
 
-  trend = resolve_metric_trend(metric);
   value_row = create_transparent_row(card, 8, LV_FLEX_ALIGN_SPACE_BETWEEN);
-  (void)create_trend_indicator(value_row, trend);
+  (void)create_trend_indicator(value_row, &metric->trend);
 
   value_group = lv_obj_create(value_row);
   lv_obj_set_size(value_group, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
@@ -558,36 +538,29 @@ static void create_metric_card(lv_obj_t *parent,
   lv_obj_clear_flag(value_group, LV_OBJ_FLAG_SCROLLABLE);
 
   value_label = lv_label_create(value_group);
-  lv_label_set_text(value_label, (NULL != metric->value_text) ? metric->value_text : "--");
+  (void)health_ui_bind_label(value_label, &metric->value);
   lv_obj_set_style_text_color(value_label, lv_color_hex(0x101828), LV_PART_MAIN);
   lv_obj_set_style_text_font(value_label, USER_DETAIL_FONT_VALUE, LV_PART_MAIN);
 
   unit_label = lv_label_create(value_group);
-  lv_label_set_text(unit_label, (NULL != metric->unit_text) ? metric->unit_text : "");
+  (void)health_ui_bind_label(unit_label, &metric->unit);
   lv_obj_set_style_text_color(unit_label,
                               lv_color_hex(USER_DETAIL_MUTED_TEXT_COLOR_HEX),
                               LV_PART_MAIN);
   lv_obj_set_style_text_font(unit_label, USER_DETAIL_FONT_UNIT, LV_PART_MAIN);
 
-  create_status_chip(card, metric->status_text, metric->status_level);
+  create_status_chip(card, &metric->status, &metric->status_level);
 
   if (metric->previous_available) {
     prev_line_1 = lv_label_create(card);
-    lv_label_set_text(prev_line_1,
-                      (NULL != metric->previous_time_text) ? metric->previous_time_text
-                                                           : "--");
+    (void)health_ui_bind_label(prev_line_1, &metric->previous_time);
     lv_obj_set_style_text_color(prev_line_1,
                                 lv_color_hex(USER_DETAIL_MUTED_TEXT_COLOR_HEX),
                                 LV_PART_MAIN);
     lv_obj_set_style_text_font(prev_line_1, USER_DETAIL_FONT_PREV_TIME, LV_PART_MAIN);
 
     prev_line_2 = lv_label_create(card);
-    if ((NULL != metric->previous_value_text) && (NULL != metric->previous_unit_text)) {
-      lv_label_set_text_fmt(prev_line_2, "%s %s", metric->previous_value_text,
-                            metric->previous_unit_text);
-    } else {
-      lv_label_set_text(prev_line_2, "--");
-    }
+    (void)health_ui_bind_label(prev_line_2, &metric->previous_value);
     lv_obj_set_style_text_color(prev_line_2, lv_color_hex(0x101828), LV_PART_MAIN);
     lv_obj_set_style_text_font(prev_line_2, USER_DETAIL_FONT_PREV_VALUE, LV_PART_MAIN);
   } else {
@@ -607,20 +580,28 @@ static void create_metric_card(lv_obj_t *parent,
   attach_metric_navigation(card, metric_id);
 }
 
+static bool content_root_is_valid(void) {
+  if ((NULL == s_content_root) || (!lv_obj_is_valid(s_content_root))) {
+    s_content_root = NULL;
+    return false;
+  }
+  return true;
+}
+
+/* Widgets bind to the published subjects; call after a publish. */
 static void rebuild_detail_content(void) {
   lv_obj_t *section_header_row;
   lv_obj_t *section_title;
   lv_obj_t *top_row;
   lv_obj_t *bottom_row;
-  health_ui_user_detail_data_t detail_data;
+  health_ui_user_detail_subjects_t *subjects;
 
-  if ((NULL == s_content_root) || (!lv_obj_is_valid(s_content_root))) {
-    s_content_root = NULL;
+  if (!content_root_is_valid()) {
     return;
   }
 
   lv_obj_clean(s_content_root);
-  health_ui_data_build_user_detail(s_selected_member_index, &detail_data);
+  subjects = health_ui_data_get_user_detail_subjects();
 
   section_header_row =
       create_transparent_row(s_content_root, USER_DETAIL_CARD_GAP_PX, LV_FLEX_ALIGN_START);
@@ -654,8 +635,8 @@ static void rebuild_detail_content(void) {
                         LV_FLEX_ALIGN_START);
   lv_obj_clear_flag(top_row, LV_OBJ_FLAG_SCROLLABLE);
 
-  create_bp_summary_card(top_row, &detail_data.bp);
-  create_metric_card(top_row, &detail_data.glucose, USER_DETAIL_GLUCOSE_CARD_GROW,
+  create_bp_summary_card(top_row, &subjects->bp);
+  create_metric_card(top_row, &subjects->glucose, USER_DETAIL_GLUCOSE_CARD_GROW,
                      HEALTH_UI_METRIC_DETAIL_GLUCOSE);
 
   bottom_row = lv_obj_create(s_content_root);
@@ -670,13 +651,13 @@ static void rebuild_detail_content(void) {
                         LV_FLEX_ALIGN_START);
   lv_obj_clear_flag(bottom_row, LV_OBJ_FLAG_SCROLLABLE);
 
-  create_metric_card(bottom_row, &detail_data.body_temp, 1,
+  create_metric_card(bottom_row, &subjects->body_temp, 1,
                      HEALTH_UI_METRIC_DETAIL_BODY_TEMP);
-  create_metric_card(bottom_row, &detail_data.spo2, 1,
+  create_metric_card(bottom_row, &subjects->spo2, 1,
                      HEALTH_UI_METRIC_DETAIL_SPO2);
-  create_metric_card(bottom_row, &detail_data.weight, 1,
+  create_metric_card(bottom_row, &subjects->weight, 1,
                      HEALTH_UI_METRIC_DETAIL_WEIGHT);
-  create_metric_card(bottom_row, &detail_data.sleep_duration, 1,
+  create_metric_card(bottom_row, &subjects->sleep_duration, 1,
                      HEALTH_UI_METRIC_DETAIL_SLEEP);
 }
 
@@ -692,7 +673,22 @@ void page_user_detail_layout_set_user_name(const char *user_name) {
 
 void page_user_detail_layout_set_member_index(uint32_t member_index) {
   s_selected_member_index = member_index;
-  rebuild_detail_content();
+  page_user_detail_layout_refresh();
+}
+
+void page_user_detail_layout_refresh(void) {
+  uint32_t result;
+
+  if (!content_root_is_valid()) {
+    return;
+  }
+
+  /* Unchanged values notify nobody; changed ones update their bound widgets
+   * in place. Only a structural change recreates the cards. */
+  result = health_ui_data_publish_user_detail(s_selected_member_index);
+  if (0U != (result & HEALTH_UI_PUBLISH_LAYOUT_CHANGED)) {
+    rebuild_detail_content();
+  }
 }
 
 void page_user_detail_layout_set_health_loading_icon(bool visible) {
@@ -736,5 +732,6 @@ void page_user_detail_layout_build(lv_obj_t *tab) {
                         LV_FLEX_ALIGN_START);
   lv_obj_clear_flag(s_content_root, LV_OBJ_FLAG_SCROLLABLE);
 
+  (void)health_ui_data_publish_user_detail(s_selected_member_index);
   rebuild_detail_content();
 }
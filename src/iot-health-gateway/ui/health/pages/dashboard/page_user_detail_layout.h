@@ -103,6 +103,8 @@
 void page_user_detail_layout_build(lv_obj_t *tab);
 void page_user_detail_layout_set_user_name(const char *user_name);
 void page_user_detail_layout_set_member_index(uint32_t member_index);
+/* Re-publish the selected member's readings; widgets redraw only on change. */
+void page_user_detail_layout_refresh(void);
 void page_user_detail_layout_set_health_loading_icon(bool visible);
 
 #endif
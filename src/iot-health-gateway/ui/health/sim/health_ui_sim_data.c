@@ -1,5 +1,7 @@
 #include "health_ui_sim_data.h"
 
+#include "health_data_provider.h"
+
 #include <stdbool.h>
 #include <stdio.h>
 
@@ -33,10 +35,8 @@ typedef struct {
 
 typedef struct {
   uint32_t device_id;
+  uint8_t device_type; /* hdp_device_info_t.device_type */
   const char *name;
-  const char *type_text;
-  const char *avatar_text;
-  uint32_t avatar_bg_color_hex;
   const sim_pair_step_entry_t *pairing_steps;
   uint32_t pairing_step_count;
   const char *pairing_guide_text;
@@ -130,49 +130,40 @@ static const sim_pair_step_entry_t s_pair_steps_xiaomi[] = {
      .visual_bg_color_hex = 0xE8ECEF},
 };
 
-/* Single source of truth for simulated devices shown on dashboard. */
+/* Simulated paired devices. health_ui_sim_data_register_devices() adds them
+ * to health_data_provider, which the dashboard reads. */
 static const sim_device_entry_t s_device_entries[] = {
     {.device_id = 1001U,
+     .device_type = (uint8_t)HDP_MEAS_BLOOD_PRESSURE,
      .name = "Omron HEM-7130",
-     .type_text = "Blood Pressure Monitor",
-     .avatar_text = "BP",
-     .avatar_bg_color_hex = 0xE7EAF0,
      .pairing_steps = s_pair_steps_omron,
      .pairing_step_count = SIM_ARRAY_SIZE(s_pair_steps_omron),
      .pairing_guide_text = "Please press START on the monitor and keep it near gateway.",
      .pairing_success = true},
     {.device_id = 1002U,
+     .device_type = (uint8_t)HDP_MEAS_GLUCOSE,
      .name = "Accu-Chek Instant",
-     .type_text = "Blood Glucose Meter",
-     .avatar_text = "BG",
-     .avatar_bg_color_hex = 0xECE8F8,
      .pairing_steps = s_pair_steps_accuchek,
      .pairing_step_count = SIM_ARRAY_SIZE(s_pair_steps_accuchek),
      .pairing_guide_text = "Turn on the glucose meter and wait for Bluetooth icon.",
      .pairing_success = false},
     {.device_id = 1003U,
+     .device_type = (uint8_t)HDP_MEAS_TEMPERATURE,
      .name = "TaiDoc TD-1241",
-     .type_text = "Thermometer",
-     .avatar_text = "TH",
-     .avatar_bg_color_hex = 0xE3EEF9,
      .pairing_steps = s_pair_steps_taidoc,
      .pairing_step_count = SIM_ARRAY_SIZE(s_pair_steps_taidoc),
      .pairing_guide_text = "Power on the thermometer and hold for 3 seconds.",
      .pairing_success = true},
     {.device_id = 1004U,
+     .device_type = (uint8_t)HDP_MEAS_SPO2_HR,
      .name = "FORA TD-8255B",
-     .type_text = "Pulse Oximeter",
-     .avatar_text = "SP",
-     .avatar_bg_color_hex = 0xF1E8EE,
      .pairing_steps = s_pair_steps_fora,
      .pairing_step_count = SIM_ARRAY_SIZE(s_pair_steps_fora),
      .pairing_guide_text = "Turn on the oximeter and keep finger inserted while pairing.",
      .pairing_success = false},
     {.device_id = 1005U,
+     .device_type = (uint8_t)HDP_DEVICE_WEIGHT_SCALE,
      .name = "Xiaomi | Mi Smart Scale 2",
-     .type_text = "Weight Scale",
-     .avatar_text = "WT",
-     .avatar_bg_color_hex = 0xE8ECEF,
      .pairing_steps = s_pair_steps_xiaomi,
      .pairing_step_count = SIM_ARRAY_SIZE(s_pair_steps_xiaomi),
      .pairing_guide_text = "Stand on the device to turn it on and wait for it to connect.",
@@ -474,7 +465,7 @@ static char s_time_text[8];
 static char s_date_text[16];
 
 static const sim_device_entry_t *get_device_entry(uint32_t device_index) {
-  uint32_t count = health_ui_sim_data_get_device_count();
+  uint32_t count = SIM_ARRAY_SIZE(s_device_entries);
   uint32_t idx;
 
   if (0U == count) {
@@ -649,31 +640,18 @@ void health_ui_sim_data_build_member_card(uint32_t member_index,
   }
 }
 
-uint32_t health_ui_sim_data_get_device_count(void) {
-  return SIM_ARRAY_SIZE(s_device_entries);
-}
-
-void health_ui_sim_data_build_device_card(
-    uint32_t device_index, comp_device_card_data_t *out_card_data) {
-  const sim_device_entry_t *entry;
+void health_ui_sim_data_register_devices(void) {
+  uint32_t i;
 
-  if (NULL == out_card_data) {
-    return;
-  }
+  for (i = 0U; i < SIM_ARRAY_SIZE(s_device_entries); i++) {
+    const sim_device_entry_t *entry = &s_device_entries[i];
+    /* Stable locally administered address derived from the device id. */
+    const uint8_t addr[6] = {0x02U, 0x51U, 0x4DU, 0x00U,
+                             (uint8_t)(entry->device_id >> 8),
+                             (uint8_t)entry->device_id};
 
-  entry = get_device_entry(device_index);
-  if (NULL == entry) {
-    out_card_data->name = "Unknown Device";
-    out_card_data->type_text = "Unknown Type";
-    out_card_data->avatar_bg_color_hex = 0xE7EAF0;
-    out_card_data->avatar_text = "--";
-    return;
+    (void)hdp_add_device(entry->device_type, addr, entry->name);
   }
-
-  out_card_data->name = entry->name;
-  out_card_data->type_text = entry->type_text;
-  out_card_data->avatar_bg_color_hex = entry->avatar_bg_color_hex;
-  out_card_data->avatar_text = entry->avatar_text;
 }
 
 uint32_t health_ui_sim_data_get_pairable_device_id(uint32_t device_index) {
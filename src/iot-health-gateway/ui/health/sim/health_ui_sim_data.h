@@ -135,11 +135,9 @@ void health_ui_sim_data_build_system_status(
 /* Fills dashboard/user-detail profile fields (name/age/avatar) and metric preview. */
 void health_ui_sim_data_build_member_card(uint32_t member_index,
                                           comp_user_card_data_t *out_card_data);
-/* Returns current simulated device inventory count (source of truth for Devices: N). */
-uint32_t health_ui_sim_data_get_device_count(void);
-/* Fills one dashboard device-card preview from simulated inventory by index. */
-void health_ui_sim_data_build_device_card(
-    uint32_t device_index, comp_device_card_data_t *out_card_data);
+/* Adds the simulated paired devices to health_data_provider (the device list
+ * the dashboard and add-device modals read). */
+void health_ui_sim_data_register_devices(void);
 /* Returns stable simulated device id for selected pairable-device index. */
 uint32_t health_ui_sim_data_get_pairable_device_id(uint32_t device_index);
 /* Returns number of pairing steps for selected pairable-device index. */
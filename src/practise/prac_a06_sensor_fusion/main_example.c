@@ -15,6 +15,7 @@
 #include "sensor_bus.h"
 
 #include "bmi270/bmi270_reader.h"
+#include "bmi270/bmi270_config.h"
 #include "bmm350/bmm350_reader.h"
 
 #include <string.h>
@@ -22,7 +23,7 @@
 #include <math.h>
 
 #define REFRESH_MS      50
-#define ALPHA           0.96f   /* complementary filter weight */
+#define FILTER_TAU_S    1.2f    /* complementary filter time constant (weight 0.96 at 50 ms) */
 #define DEG2RAD         0.017453f
 #define RAD2DEG         57.29578f
 #define COMPASS_R       70
@@ -60,29 +61,28 @@ typedef struct {
     orientation_t  orient;
     bmi270_sample_t last_bmi;
     bmm350_sample_t last_bmm;
+    bmi270_sample_t imu_fifo[BMI270_FIFO_DEPTH];
 } app_ctx_t;
 
 static app_ctx_t g_ctx;
 
-static void update_orientation(app_ctx_t *ctx)
+/* One complementary filter step per IMU sample, dt = 1 / ODR */
+static void update_orientation(app_ctx_t *ctx, const bmi270_sample_t *imu, float dt)
 {
-    float ax_g = ctx->last_bmi.acc_g_x;
-    float ay_g = ctx->last_bmi.acc_g_y;
-    float az_g = ctx->last_bmi.acc_g_z;
-    float gx_dps = ctx->last_bmi.gyr_dps_x;
-    float gy_dps = ctx->last_bmi.gyr_dps_y;
+    float ax_g = imu->acc_g_x;
+    float ay_g = imu->acc_g_y;
+    float az_g = imu->acc_g_z;
+    float gx_dps = imu->gyr_dps_x;
+    float gy_dps = imu->gyr_dps_y;
 
     /* Accel-based angles */
     float accel_roll  = atan2f(ay_g, az_g) * RAD2DEG;
     float accel_pitch = atan2f(-ax_g, sqrtf(ay_g * ay_g + az_g * az_g)) * RAD2DEG;
 
-    /* Complementary filter */
-    float dt = (float)REFRESH_MS / 1000.0f;
-    ctx->orient.roll  = ALPHA * (ctx->orient.roll  + gx_dps * dt) + (1.0f - ALPHA) * accel_roll;
-    ctx->orient.pitch = ALPHA * (ctx->orient.pitch + gy_dps * dt) + (1.0f - ALPHA) * accel_pitch;
-
-    ctx->orient.heading = ctx->last_bmm.heading_deg;
-    ctx->orient.yaw = ctx->orient.heading;
+    /* Complementary filter, weight scaled to the sample period */
+    float alpha = FILTER_TAU_S / (FILTER_TAU_S + dt);
+    ctx->orient.roll  = alpha * (ctx->orient.roll  + gx_dps * dt) + (1.0f - alpha) * accel_roll;
+    ctx->orient.pitch = alpha * (ctx->orient.pitch + gy_dps * dt) + (1.0f - alpha) * accel_pitch;
 }
 
 static void update_compass(app_ctx_t *ctx)
@@ -125,11 +125,18 @@ static void timer_cb(lv_timer_t *t)
 {
     app_ctx_t *ctx = (app_ctx_t *)lv_timer_get_user_data(t);
 
-    /* Poll sensors directly */
-    bmi270_reader_poll(&ctx->last_bmi);
-    bmm350_reader_poll(&ctx->last_bmm);
+    /* Integrate every IMU sample queued since the last frame, not just
+     * the one that happens to be current when the UI timer fires */
+    size_t n = bmi270_reader_read_fifo(ctx->imu_fifo, BMI270_FIFO_DEPTH);
+    float dt = 1.0f / (float)bmi270_reader_get_fifo_odr_hz();
+    for (size_t i = 0; i < n; i++) {
+        update_orientation(ctx, &ctx->imu_fifo[i], dt);
+    }
+    if (n > 0) ctx->last_bmi = ctx->imu_fifo[n - 1];
 
-    update_orientation(ctx);
+    bmm350_reader_poll(&ctx->last_bmm);
+    ctx->orient.heading = ctx->last_bmm.heading_deg;
+    ctx->orient.yaw = ctx->orient.heading;
     update_compass(ctx);
     update_horizon(ctx);
 
@@ -8,6 +8,7 @@
  * 20ms tick timer for smooth 50fps physics.
  * Touch: tap Action button or tap arena to flap.
  * Game Boy 4-tone palette with CRT scanline overlay.
+ * Pipes and bird are sprites on one game_common sprite layer.
  *
  * Entry point: void example_main(lv_obj_t *parent)
  *
@@ -34,8 +35,8 @@
  * Pipe Structure
  *******************************************************************************/
 typedef struct {
-    lv_obj_t *top;
-    lv_obj_t *bottom;
+    game_sprite_id_t top;
+    game_sprite_id_t bottom;
     int32_t x;
     int32_t gap_y;
     bool passed;
@@ -49,10 +50,8 @@ typedef struct {
     lv_obj_t *arena;
     lv_obj_t *score_label;
     lv_obj_t *status_label;
-    lv_obj_t *bird;
-    lv_obj_t *bird_wing;
-    lv_obj_t *bird_eye;
-    lv_obj_t *bird_beak;
+    lv_obj_t *sprites;
+    game_sprite_id_t bird;
     lv_timer_t *timer;
 
     flap_pipe_t pipes[FLAP_PIPE_COUNT];
@@ -67,6 +66,29 @@ typedef struct {
 static flappy_state_t s_flap;
 static uint32_t s_flap_best;
 
+/*******************************************************************************
+ * Sprite Styles
+ *******************************************************************************/
+static const game_sprite_style_t s_pipe_style = {GB_DARK, GB_DARKEST, 2, 0};
+static const game_sprite_style_t s_bird_style = {GB_DARKEST, GB_LIGHTEST, 2, FLAP_BIRD_SIZE / 2};
+static const game_sprite_style_t s_wing_style = {GB_DARK, GB_LIGHTEST, 1, 3};
+static const game_sprite_style_t s_eye_style  = {GB_LIGHTEST, GB_LIGHTEST, 0, 2};
+static const game_sprite_style_t s_beak_style = {GB_LIGHTEST, GB_DARKEST, 1, 1};
+
+/* Bird details, one set per wing phase: wing, eye, beak */
+static const game_sprite_part_t s_bird_parts[2][3] = {
+    {
+        {3, 10, 10, 7, &s_wing_style},
+        {FLAP_BIRD_SIZE - 8, 6, 4, 4, &s_eye_style},
+        {FLAP_BIRD_SIZE - 1, 10, 6, 4, &s_beak_style},
+    },
+    {
+        {2, 7, 12, 8, &s_wing_style},
+        {FLAP_BIRD_SIZE - 8, 6, 4, 4, &s_eye_style},
+        {FLAP_BIRD_SIZE - 1, 10, 6, 4, &s_beak_style},
+    },
+};
+
 /*******************************************************************************
  * Forward Declarations
  *******************************************************************************/
@@ -130,10 +152,12 @@ static void flappy_render_pipe(uint32_t i)
     if (gap_top < 20) gap_top = 20;
     if (gap_bottom > FLAP_ARENA_H - 20) gap_bottom = FLAP_ARENA_H - 20;
 
-    lv_obj_set_size(s_flap.pipes[i].top, FLAP_PIPE_W, gap_top);
-    lv_obj_set_pos(s_flap.pipes[i].top, s_flap.pipes[i].x, 0);
-    lv_obj_set_size(s_flap.pipes[i].bottom, FLAP_PIPE_W, FLAP_ARENA_H - gap_bottom);
-    lv_obj_set_pos(s_flap.pipes[i].bottom, s_flap.pipes[i].x, gap_bottom);
+    game_sprite_set_size(s_flap.sprites, s_flap.pipes[i].top, FLAP_PIPE_W, gap_top);
+    game_sprite_set_pos(s_flap.sprites, s_flap.pipes[i].top, s_flap.pipes[i].x, 0);
+    game_sprite_set_size(s_flap.sprites, s_flap.pipes[i].bottom,
+                         FLAP_PIPE_W, FLAP_ARENA_H - gap_bottom);
+    game_sprite_set_pos(s_flap.sprites, s_flap.pipes[i].bottom,
+                        s_flap.pipes[i].x, gap_bottom);
 }
 
 static bool flappy_hit_pipe(uint32_t i, int32_t bird_x, int32_t bird_y)
@@ -193,17 +217,13 @@ static void flappy_step(void)
     }
 
     bird_draw_y = (int32_t)(s_flap.bird_y - (float)(FLAP_BIRD_SIZE / 2));
-    lv_obj_set_pos(s_flap.bird, FLAP_BIRD_X - FLAP_BIRD_SIZE / 2, bird_draw_y);
+    game_sprite_set_pos(s_flap.sprites, s_flap.bird,
+                        FLAP_BIRD_X - FLAP_BIRD_SIZE / 2, bird_draw_y);
 
     /* Wing animation */
     s_flap.wing_phase++;
-    if ((s_flap.wing_phase & 1U) == 0U) {
-        lv_obj_set_pos(s_flap.bird_wing, 3, 10);
-        lv_obj_set_size(s_flap.bird_wing, 10, 7);
-    } else {
-        lv_obj_set_pos(s_flap.bird_wing, 2, 7);
-        lv_obj_set_size(s_flap.bird_wing, 12, 8);
-    }
+    game_sprite_set_parts(s_flap.sprites, s_flap.bird,
+                          s_bird_parts[s_flap.wing_phase & 1U], 3);
 
     /* Move pipes and check collision */
     for (i = 0; i < FLAP_PIPE_COUNT; i++) {
@@ -247,11 +267,10 @@ static void flappy_start(void)
         flappy_render_pipe(i);
     }
 
-    lv_obj_set_pos(s_flap.bird,
-                   FLAP_BIRD_X - FLAP_BIRD_SIZE / 2,
-                   (int32_t)s_flap.bird_y - FLAP_BIRD_SIZE / 2);
-    lv_obj_set_pos(s_flap.bird_wing, 3, 10);
-    lv_obj_set_size(s_flap.bird_wing, 10, 7);
+    game_sprite_set_pos(s_flap.sprites, s_flap.bird,
+                        FLAP_BIRD_X - FLAP_BIRD_SIZE / 2,
+                        (int32_t)s_flap.bird_y - FLAP_BIRD_SIZE / 2);
+    game_sprite_set_parts(s_flap.sprites, s_flap.bird, s_bird_parts[0], 3);
 
     lv_label_set_text(s_flap.status_label, "Tap A or Arena to flap. Avoid pipes!");
     flappy_update_hud();
@@ -351,61 +370,25 @@ void example_main(lv_obj_t *parent)
     /* CRT scanlines */
     game_add_lcd_scanlines(arena, FLAP_ARENA_W, FLAP_ARENA_H);
 
-    /* Pipes (pre-allocated) */
+    /* Sprite layer: pipes, then the bird on top */
+    s_flap.sprites = game_sprite_layer_create(arena, FLAP_ARENA_W, FLAP_ARENA_H,
+                                              FLAP_PIPE_COUNT * 2 + 1);
+
+    /* Pipes (pre-allocated, sized by flappy_render_pipe) */
     for (i = 0; i < FLAP_PIPE_COUNT; i++) {
-        s_flap.pipes[i].top = lv_obj_create(arena);
-        s_flap.pipes[i].bottom = lv_obj_create(arena);
-
-        lv_obj_set_style_bg_color(s_flap.pipes[i].top, gb_color(GB_DARK), 0);
-        lv_obj_set_style_border_color(s_flap.pipes[i].top, gb_color(GB_DARKEST), 0);
-        lv_obj_set_style_border_width(s_flap.pipes[i].top, 2, 0);
-        lv_obj_set_style_radius(s_flap.pipes[i].top, 0, 0);
-        lv_obj_clear_flag(s_flap.pipes[i].top, LV_OBJ_FLAG_SCROLLABLE);
-
-        lv_obj_set_style_bg_color(s_flap.pipes[i].bottom, gb_color(GB_DARK), 0);
-        lv_obj_set_style_border_color(s_flap.pipes[i].bottom, gb_color(GB_DARKEST), 0);
-        lv_obj_set_style_border_width(s_flap.pipes[i].bottom, 2, 0);
-        lv_obj_set_style_radius(s_flap.pipes[i].bottom, 0, 0);
-        lv_obj_clear_flag(s_flap.pipes[i].bottom, LV_OBJ_FLAG_SCROLLABLE);
+        s_flap.pipes[i].top = game_sprite_add(s_flap.sprites, FLAP_PIPE_W, 1,
+                                              &s_pipe_style);
+        s_flap.pipes[i].bottom = game_sprite_add(s_flap.sprites, FLAP_PIPE_W, 1,
+                                                 &s_pipe_style);
+        game_sprite_set_visible(s_flap.sprites, s_flap.pipes[i].top, true);
+        game_sprite_set_visible(s_flap.sprites, s_flap.pipes[i].bottom, true);
     }
 
-    /* Bird body */
-    s_flap.bird = lv_obj_create(arena);
-    lv_obj_set_size(s_flap.bird, FLAP_BIRD_SIZE, FLAP_BIRD_SIZE);
-    lv_obj_set_style_radius(s_flap.bird, FLAP_BIRD_SIZE / 2, 0);
-    lv_obj_set_style_bg_color(s_flap.bird, gb_color(GB_DARKEST), 0);
-    lv_obj_set_style_border_color(s_flap.bird, gb_color(GB_LIGHTEST), 0);
-    lv_obj_set_style_border_width(s_flap.bird, 2, 0);
-    lv_obj_clear_flag(s_flap.bird, LV_OBJ_FLAG_SCROLLABLE);
-
-    /* Wing */
-    s_flap.bird_wing = lv_obj_create(s_flap.bird);
-    lv_obj_set_size(s_flap.bird_wing, 10, 7);
-    lv_obj_set_pos(s_flap.bird_wing, 3, 10);
-    lv_obj_set_style_bg_color(s_flap.bird_wing, gb_color(GB_DARK), 0);
-    lv_obj_set_style_border_color(s_flap.bird_wing, gb_color(GB_LIGHTEST), 0);
-    lv_obj_set_style_border_width(s_flap.bird_wing, 1, 0);
-    lv_obj_set_style_radius(s_flap.bird_wing, 3, 0);
-    lv_obj_clear_flag(s_flap.bird_wing, LV_OBJ_FLAG_SCROLLABLE);
-
-    /* Eye */
-    s_flap.bird_eye = lv_obj_create(s_flap.bird);
-    lv_obj_set_size(s_flap.bird_eye, 4, 4);
-    lv_obj_set_pos(s_flap.bird_eye, FLAP_BIRD_SIZE - 8, 6);
-    lv_obj_set_style_bg_color(s_flap.bird_eye, gb_color(GB_LIGHTEST), 0);
-    lv_obj_set_style_border_width(s_flap.bird_eye, 0, 0);
-    lv_obj_set_style_radius(s_flap.bird_eye, 2, 0);
-    lv_obj_clear_flag(s_flap.bird_eye, LV_OBJ_FLAG_SCROLLABLE);
-
-    /* Beak */
-    s_flap.bird_beak = lv_obj_create(s_flap.bird);
-    lv_obj_set_size(s_flap.bird_beak, 6, 4);
-    lv_obj_set_pos(s_flap.bird_beak, FLAP_BIRD_SIZE - 1, 10);
-    lv_obj_set_style_bg_color(s_flap.bird_beak, gb_color(GB_LIGHTEST), 0);
-    lv_obj_set_style_border_color(s_flap.bird_beak, gb_color(GB_DARKEST), 0);
-    lv_obj_set_style_border_width(s_flap.bird_beak, 1, 0);
-    lv_obj_set_style_radius(s_flap.bird_beak, 1, 0);
-    lv_obj_clear_flag(s_flap.bird_beak, LV_OBJ_FLAG_SCROLLABLE);
+    /* Bird: body + wing, eye, beak */
+    s_flap.bird = game_sprite_add(s_flap.sprites, FLAP_BIRD_SIZE, FLAP_BIRD_SIZE,
+                                  &s_bird_style);
+    game_sprite_set_parts(s_flap.sprites, s_flap.bird, s_bird_parts[0], 3);
+    game_sprite_set_visible(s_flap.sprites, s_flap.bird, true);
 
     /* Status label (overlaid on arena) */
     s_flap.status_label = lv_label_create(arena);
@@ -4,11 +4,14 @@
  * Production-derived Snake game for Developer Hub.
  * Adapted from page_game_snake.c (TESAIoT Game Console).
  *
- * 30x24 grid, 16px cells, max 140 segments (pre-allocated object pool).
+ * 30x24 grid, 16px cells, max 140 segments (pre-allocated sprite pool).
  * 115ms tick timer drives game logic.
  * Touch D-pad for direction (edge-triggered, prevents 180-degree reversal).
  * Head with eyes + tongue (orientation-based).
  * Game Boy 4-tone palette with CRT scanline overlay.
+ * Food and segments are sprites on one game_common sprite layer.
+ * Segments are also kept in a game_common collision grid (one cell per grid
+ * square), so food placement and self-collision are lookups, not scans.
  *
  * Entry point: void example_main(lv_obj_t *parent)
  *
@@ -38,15 +41,15 @@ typedef struct {
     lv_obj_t *arena;
     lv_obj_t *score_label;
     lv_obj_t *status_label;
-    lv_obj_t *food_obj;
-    lv_obj_t *head_eye_l;
-    lv_obj_t *head_eye_r;
-    lv_obj_t *head_tongue;
-    lv_obj_t *segment_objs[SNAKE_MAX_LEN];
+    lv_obj_t *sprites;
+    game_sprite_id_t food_spr;
+    game_sprite_id_t segment_sprs[SNAKE_MAX_LEN];
+    game_collision_grid_t *grid;
     lv_timer_t *timer;
 
     int16_t snake_x[SNAKE_MAX_LEN];
     int16_t snake_y[SNAKE_MAX_LEN];
+    uint16_t seg_id[SNAKE_MAX_LEN];     /* grid id of each segment */
     uint16_t snake_len;
 
     int8_t dir_x;
@@ -65,6 +68,37 @@ typedef struct {
 static snake_state_t s_snake;
 static uint32_t s_snake_best;
 
+/*******************************************************************************
+ * Sprite Styles
+ *******************************************************************************/
+static const game_sprite_style_t s_head_style   = {GB_DARKEST, GB_LIGHT, 1, 4};
+static const game_sprite_style_t s_body_style   = {GB_DARK, GB_LIGHT, 1, 2};
+static const game_sprite_style_t s_food_style   = {GB_DARKEST, GB_LIGHTEST, 1, 1};
+static const game_sprite_style_t s_eye_style    = {GB_LIGHTEST, GB_LIGHTEST, 0, 1};
+static const game_sprite_style_t s_tongue_style = {GB_LIGHTEST, GB_LIGHTEST, 0, 0};
+
+/* Head details per heading: eyes + tongue (the tongue pokes out of the cell) */
+enum { SNAKE_HEAD_RIGHT, SNAKE_HEAD_LEFT, SNAKE_HEAD_UP, SNAKE_HEAD_DOWN };
+
+static const game_sprite_part_t s_head_parts[4][3] = {
+    [SNAKE_HEAD_RIGHT] = {
+        {10, 4, 3, 3, &s_eye_style}, {10, 10, 3, 3, &s_eye_style},
+        {16, 7, 4, 2, &s_tongue_style},
+    },
+    [SNAKE_HEAD_LEFT] = {
+        {3, 4, 3, 3, &s_eye_style}, {3, 10, 3, 3, &s_eye_style},
+        {-4, 7, 4, 2, &s_tongue_style},
+    },
+    [SNAKE_HEAD_UP] = {
+        {4, 3, 3, 3, &s_eye_style}, {10, 3, 3, 3, &s_eye_style},
+        {7, -4, 2, 4, &s_tongue_style},
+    },
+    [SNAKE_HEAD_DOWN] = {
+        {4, 10, 3, 3, &s_eye_style}, {10, 10, 3, 3, &s_eye_style},
+        {7, 16, 2, 4, &s_tongue_style},
+    },
+};
+
 /*******************************************************************************
  * Forward Declarations
  *******************************************************************************/
@@ -91,13 +125,7 @@ static void snake_update_hud(void)
  *******************************************************************************/
 static bool snake_contains_xy(int16_t x, int16_t y)
 {
-    uint16_t i;
-    for (i = 0; i < s_snake.snake_len; i++) {
-        if (s_snake.snake_x[i] == x && s_snake.snake_y[i] == y) {
-            return true;
-        }
-    }
-    return false;
+    return game_collision_grid_query(s_snake.grid, x, y, 1, 1, NULL, NULL) > 0U;
 }
 
 /*******************************************************************************
@@ -112,15 +140,15 @@ static void snake_spawn_food(void)
         if (!snake_contains_xy(x, y)) {
             s_snake.food_x = x;
             s_snake.food_y = y;
-            lv_obj_set_pos(s_snake.food_obj,
-                           s_snake.food_x * SNAKE_CELL_PX,
-                           s_snake.food_y * SNAKE_CELL_PX);
+            game_sprite_set_pos(s_snake.sprites, s_snake.food_spr,
+                                s_snake.food_x * SNAKE_CELL_PX,
+                                s_snake.food_y * SNAKE_CELL_PX);
             return;
         }
     }
     s_snake.food_x = 0;
     s_snake.food_y = 0;
-    lv_obj_set_pos(s_snake.food_obj, 0, 0);
+    game_sprite_set_pos(s_snake.sprites, s_snake.food_spr, 0, 0);
 }
 
 /*******************************************************************************
@@ -129,62 +157,36 @@ static void snake_spawn_food(void)
 static void snake_render(void)
 {
     uint16_t i;
-    int16_t hx, hy;
-    int16_t ex1, ey1, ex2, ey2;
-    int16_t tx, ty, tw, th;
+    uint32_t heading;
+
+    /* Eyes + tongue orientation based on heading */
+    if (s_snake.dir_x > 0) {
+        heading = SNAKE_HEAD_RIGHT;
+    } else if (s_snake.dir_x < 0) {
+        heading = SNAKE_HEAD_LEFT;
+    } else if (s_snake.dir_y < 0) {
+        heading = SNAKE_HEAD_UP;
+    } else {
+        heading = SNAKE_HEAD_DOWN;
+    }
 
     for (i = 0; i < SNAKE_MAX_LEN; i++) {
+        game_sprite_id_t spr = s_snake.segment_sprs[i];
         if (i < s_snake.snake_len) {
-            lv_obj_clear_flag(s_snake.segment_objs[i], LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_pos(s_snake.segment_objs[i],
-                           s_snake.snake_x[i] * SNAKE_CELL_PX,
-                           s_snake.snake_y[i] * SNAKE_CELL_PX);
-
+            game_sprite_set_pos(s_snake.sprites, spr,
+                                s_snake.snake_x[i] * SNAKE_CELL_PX,
+                                s_snake.snake_y[i] * SNAKE_CELL_PX);
             if (i == 0) {
-                lv_obj_set_style_bg_color(s_snake.segment_objs[i],
-                                           gb_color(GB_DARKEST), 0);
-                lv_obj_set_style_border_color(s_snake.segment_objs[i],
-                                               gb_color(GB_LIGHT), 0);
-                lv_obj_set_style_radius(s_snake.segment_objs[i], 4, 0);
+                game_sprite_set_style(s_snake.sprites, spr, &s_head_style);
+                game_sprite_set_parts(s_snake.sprites, spr, s_head_parts[heading], 3);
             } else {
-                lv_obj_set_style_bg_color(s_snake.segment_objs[i],
-                                           gb_color(GB_DARK), 0);
-                lv_obj_set_style_border_color(s_snake.segment_objs[i],
-                                               gb_color(GB_LIGHT), 0);
-                lv_obj_set_style_radius(s_snake.segment_objs[i], 2, 0);
+                game_sprite_set_style(s_snake.sprites, spr, &s_body_style);
             }
+            game_sprite_set_visible(s_snake.sprites, spr, true);
         } else {
-            lv_obj_add_flag(s_snake.segment_objs[i], LV_OBJ_FLAG_HIDDEN);
+            game_sprite_set_visible(s_snake.sprites, spr, false);
         }
     }
-
-    /* Head position */
-    hx = (int16_t)(s_snake.snake_x[0] * SNAKE_CELL_PX);
-    hy = (int16_t)(s_snake.snake_y[0] * SNAKE_CELL_PX);
-
-    /* Eyes + tongue orientation based on heading */
-    if (s_snake.dir_x > 0) {
-        ex1 = hx + 10; ey1 = hy + 4;
-        ex2 = hx + 10; ey2 = hy + 10;
-        tx = hx + 16; ty = hy + 7; tw = 4; th = 2;
-    } else if (s_snake.dir_x < 0) {
-        ex1 = hx + 3; ey1 = hy + 4;
-        ex2 = hx + 3; ey2 = hy + 10;
-        tx = hx - 4; ty = hy + 7; tw = 4; th = 2;
-    } else if (s_snake.dir_y < 0) {
-        ex1 = hx + 4; ey1 = hy + 3;
-        ex2 = hx + 10; ey2 = hy + 3;
-        tx = hx + 7; ty = hy - 4; tw = 2; th = 4;
-    } else {
-        ex1 = hx + 4; ey1 = hy + 10;
-        ex2 = hx + 10; ey2 = hy + 10;
-        tx = hx + 7; ty = hy + 16; tw = 2; th = 4;
-    }
-
-    lv_obj_set_pos(s_snake.head_eye_l, ex1, ey1);
-    lv_obj_set_pos(s_snake.head_eye_r, ex2, ey2);
-    lv_obj_set_pos(s_snake.head_tongue, tx, ty);
-    lv_obj_set_size(s_snake.head_tongue, tw, th);
 }
 
 /*******************************************************************************
@@ -222,6 +224,7 @@ static void snake_step(void)
 {
     int16_t new_head_x, new_head_y;
     bool ate_food = false;
+    uint16_t head_id;
     int16_t i;
 
     s_snake.dir_x = s_snake.next_dir_x;
@@ -243,10 +246,15 @@ static void snake_step(void)
         return;
     }
 
+    /* Grid ids stay 0..len-1: the head reuses the tail's id, or takes a
+     * new one when the snake grows */
+    head_id = s_snake.seg_id[s_snake.snake_len - 1];
+
     /* Food collision */
     if (new_head_x == s_snake.food_x && new_head_y == s_snake.food_y) {
         ate_food = true;
         if (s_snake.snake_len < SNAKE_MAX_LEN) {
+            head_id = s_snake.snake_len;
             s_snake.snake_len++;
         }
         s_snake.score++;
@@ -259,9 +267,12 @@ static void snake_step(void)
     for (i = (int16_t)s_snake.snake_len - 1; i > 0; i--) {
         s_snake.snake_x[i] = s_snake.snake_x[i - 1];
         s_snake.snake_y[i] = s_snake.snake_y[i - 1];
+        s_snake.seg_id[i] = s_snake.seg_id[i - 1];
     }
     s_snake.snake_x[0] = new_head_x;
     s_snake.snake_y[0] = new_head_y;
+    s_snake.seg_id[0] = head_id;
+    game_collision_grid_set(s_snake.grid, head_id, new_head_x, new_head_y, 1, 1);
 
     if (ate_food) {
         snake_spawn_food();
@@ -288,9 +299,12 @@ static void snake_start(void)
     s_snake.next_dir_x = 1;
     s_snake.next_dir_y = 0;
 
+    game_collision_grid_clear(s_snake.grid);
     for (i = 0; i < s_snake.snake_len; i++) {
         s_snake.snake_x[i] = (int16_t)(10 - i);
         s_snake.snake_y[i] = 10;
+        s_snake.seg_id[i] = i;
+        game_collision_grid_set(s_snake.grid, i, s_snake.snake_x[i], s_snake.snake_y[i], 1, 1);
     }
 
     snake_spawn_food();
@@ -346,6 +360,13 @@ static void snake_tick_cb(lv_timer_t *timer)
 /*******************************************************************************
  * Example Entry Point
  *******************************************************************************/
+static void snake_arena_delete_cb(lv_event_t *e)
+{
+    (void)e;
+    game_collision_grid_delete(s_snake.grid);
+    s_snake.grid = NULL;
+}
+
 void example_main(lv_obj_t *parent)
 {
     lv_obj_t *arena;
@@ -401,48 +422,25 @@ void example_main(lv_obj_t *parent)
     /* CRT scanlines */
     game_add_lcd_scanlines(arena, SNAKE_ARENA_W, SNAKE_ARENA_H);
 
-    /* Snake segment objects (pre-allocated pool, hidden until needed) */
+    /* Segment collision grid in grid squares, freed with the arena */
+    s_snake.grid = game_collision_grid_create(SNAKE_GRID_W, SNAKE_GRID_H, 1, SNAKE_MAX_LEN);
+    lv_obj_add_event_cb(arena, snake_arena_delete_cb, LV_EVENT_DELETE, NULL);
+
+    /* Sprite layer: food first so the head's tongue draws over it */
+    s_snake.sprites = game_sprite_layer_create(arena, SNAKE_ARENA_W, SNAKE_ARENA_H,
+                                               SNAKE_MAX_LEN + 1);
+
+    s_snake.food_spr = game_sprite_add(s_snake.sprites, SNAKE_CELL_PX, SNAKE_CELL_PX,
+                                       &s_food_style);
+    game_sprite_set_visible(s_snake.sprites, s_snake.food_spr, true);
+
+    /* Snake segments (pre-allocated pool, hidden until needed) */
     for (i = 0; i < SNAKE_MAX_LEN; i++) {
-        s_snake.segment_objs[i] = lv_obj_create(s_snake.arena);
-        lv_obj_set_size(s_snake.segment_objs[i], SNAKE_CELL_PX, SNAKE_CELL_PX);
-        lv_obj_set_style_radius(s_snake.segment_objs[i], 1, 0);
-        lv_obj_set_style_border_width(s_snake.segment_objs[i], 1, 0);
-        lv_obj_clear_flag(s_snake.segment_objs[i], LV_OBJ_FLAG_SCROLLABLE);
-        lv_obj_add_flag(s_snake.segment_objs[i], LV_OBJ_FLAG_HIDDEN);
+        s_snake.segment_sprs[i] = game_sprite_add(s_snake.sprites,
+                                                  SNAKE_CELL_PX, SNAKE_CELL_PX,
+                                                  &s_body_style);
     }
 
-    /* Food object */
-    s_snake.food_obj = lv_obj_create(s_snake.arena);
-    lv_obj_set_size(s_snake.food_obj, SNAKE_CELL_PX, SNAKE_CELL_PX);
-    lv_obj_set_style_bg_color(s_snake.food_obj, gb_color(GB_DARKEST), 0);
-    lv_obj_set_style_border_color(s_snake.food_obj, gb_color(GB_LIGHTEST), 0);
-    lv_obj_set_style_border_width(s_snake.food_obj, 1, 0);
-    lv_obj_set_style_radius(s_snake.food_obj, 1, 0);
-    lv_obj_clear_flag(s_snake.food_obj, LV_OBJ_FLAG_SCROLLABLE);
-
-    /* Snake eyes (small dots on head) */
-    s_snake.head_eye_l = lv_obj_create(s_snake.arena);
-    lv_obj_set_size(s_snake.head_eye_l, 3, 3);
-    lv_obj_set_style_bg_color(s_snake.head_eye_l, gb_color(GB_LIGHTEST), 0);
-    lv_obj_set_style_border_width(s_snake.head_eye_l, 0, 0);
-    lv_obj_set_style_radius(s_snake.head_eye_l, 1, 0);
-    lv_obj_clear_flag(s_snake.head_eye_l, LV_OBJ_FLAG_SCROLLABLE);
-
-    s_snake.head_eye_r = lv_obj_create(s_snake.arena);
-    lv_obj_set_size(s_snake.head_eye_r, 3, 3);
-    lv_obj_set_style_bg_color(s_snake.head_eye_r, gb_color(GB_LIGHTEST), 0);
-    lv_obj_set_style_border_width(s_snake.head_eye_r, 0, 0);
-    lv_obj_set_style_radius(s_snake.head_eye_r, 1, 0);
-    lv_obj_clear_flag(s_snake.head_eye_r, LV_OBJ_FLAG_SCROLLABLE);
-
-    /* Tongue */
-    s_snake.head_tongue = lv_obj_create(s_snake.arena);
-    lv_obj_set_size(s_snake.head_tongue, 4, 2);
-    lv_obj_set_style_bg_color(s_snake.head_tongue, gb_color(GB_LIGHTEST), 0);
-    lv_obj_set_style_border_width(s_snake.head_tongue, 0, 0);
-    lv_obj_set_style_radius(s_snake.head_tongue, 0, 0);
-    lv_obj_clear_flag(s_snake.head_tongue, LV_OBJ_FLAG_SCROLLABLE);
-
     /* Status label (overlaid on arena, top-left) */
     s_snake.status_label = lv_label_create(arena);
     lv_obj_set_width(s_snake.status_label, SNAKE_ARENA_W - 100);
@@ -10,7 +10,13 @@
  * 20ms tick timer, ship moves L/R at 7px, bullets at 7px up,
  * enemies 1.8-3.4px down. Spawn cooldown, 3 lives, progressive difficulty.
  * Entity pool pattern: pre-allocated bullets[6] + enemies[8], active flags.
- * AABB collision: bullet-enemy, ship-enemy, enemy-past-bottom.
+ * Ship, bullets and enemies are sprites on one game_common sprite layer.
+ * AABB collision: bullet-enemy, ship-enemy, enemy-past-bottom. Enemies live
+ * in a game_common collision grid, so each bullet only tests nearby enemies.
+ *
+ * SHOOT_STRESS=1 (CMake option GAME_COLLISION_STRESS) grows the pools to
+ * thousands of entities, fires automatically, never ends, and every
+ * SHOOT_STRESS_REPORT_TICKS prints grid vs all-pairs collision time.
  * Touch: D-pad L/R + Action (fire) + Restart.
  *
  * Entry point: void example_main(lv_obj_t *parent)
@@ -21,6 +27,8 @@
 #include "game_common.h"
 #include "usb_hid_joystick.h"
 
+#include <time.h>
+
 /*******************************************************************************
  * Game Constants
  *******************************************************************************/
@@ -29,22 +37,40 @@
 #define SHOOT_SHIP_W           44
 #define SHOOT_SHIP_H           20
 #define SHOOT_SHIP_Y           (SHOOT_ARENA_H - SHOOT_SHIP_H - 16)
+#define SHOOT_BULLET_W         4
+#define SHOOT_BULLET_H         10
+#define SHOOT_ENEMY_W          26
+#define SHOOT_ENEMY_H          16
+#define SHOOT_TICK_MS          20
+#define SHOOT_GRID_CELL        32
+
+#ifndef SHOOT_STRESS
+#define SHOOT_STRESS           0
+#endif
+
+#if SHOOT_STRESS
+#define SHOOT_BULLET_MAX       512
+#define SHOOT_ENEMY_MAX        2048
+#define SHOOT_STRESS_SPAWN_PER_TICK  64
+#define SHOOT_STRESS_FIRE_PER_TICK   10
+#define SHOOT_STRESS_REPORT_TICKS    50
+#else
 #define SHOOT_BULLET_MAX       6
 #define SHOOT_ENEMY_MAX        8
-#define SHOOT_TICK_MS          20
+#endif
 
 /*******************************************************************************
  * Entity Structures
  *******************************************************************************/
 typedef struct {
-    lv_obj_t *obj;
+    game_sprite_id_t spr;
     bool active;
     float x;
     float y;
 } shooter_bullet_t;
 
 typedef struct {
-    lv_obj_t *obj;
+    game_sprite_id_t spr;
     bool active;
     float x;
     float y;
@@ -59,7 +85,9 @@ typedef struct {
     lv_obj_t *arena;
     lv_obj_t *score_label;
     lv_obj_t *status_label;
-    lv_obj_t *ship;
+    lv_obj_t *sprites;
+    game_sprite_id_t ship;
+    game_collision_grid_t *grid;    /* enemies, id = pool index */
     lv_timer_t *timer;
 
     shooter_bullet_t bullets[SHOOT_BULLET_MAX];
@@ -70,11 +98,37 @@ typedef struct {
     uint16_t spawn_cd;
     bool running;
     game_input_state_t prev_input;
+#if SHOOT_STRESS
+    uint32_t ticks;
+#endif
 } shooter_state_t;
 
 static shooter_state_t s_shooter;
 static uint32_t s_shooter_best;
 
+/*******************************************************************************
+ * Sprite Styles
+ *******************************************************************************/
+static const game_sprite_style_t s_ship_style   = {GB_DARKEST, GB_LIGHTEST, 1, 2};
+static const game_sprite_style_t s_wing_style   = {GB_DARK, GB_DARK, 0, 1};
+static const game_sprite_style_t s_cabin_style  = {GB_LIGHTEST, GB_DARKEST, 1, 1};
+static const game_sprite_style_t s_bullet_style = {GB_DARKEST, GB_DARKEST, 0, 1};
+static const game_sprite_style_t s_enemy_style  = {GB_DARK, GB_DARKEST, 1, 2};
+static const game_sprite_style_t s_eye_style    = {GB_LIGHTEST, GB_LIGHTEST, 0, 1};
+
+/* Ship: wings + cabin (44x20 body) */
+static const game_sprite_part_t s_ship_parts[] = {
+    {0,                 10, 8,  8, &s_wing_style},
+    {SHOOT_SHIP_W - 8,  10, 8,  8, &s_wing_style},
+    {16,                0,  12, 8, &s_cabin_style},
+};
+
+/* Enemy: dual eyes (26x16 body) */
+static const game_sprite_part_t s_enemy_parts[] = {
+    {5,  4, 4, 4, &s_eye_style},
+    {17, 4, 4, 4, &s_eye_style},
+};
+
 /*******************************************************************************
  * Forward Declarations
  *******************************************************************************/
@@ -93,6 +147,18 @@ static bool shooter_overlap(float ax, float ay, float aw, float ah,
     return true;
 }
 
+/* Grid boxes are whole pixels: a float box [x, x + w] (integer w) covers
+ * pixels floor(x) .. floor(x) + w, so every float overlap is also a grid
+ * overlap and the callback does the exact test. */
+static bool shooter_grid_query(float x, float y, float w, float h,
+                               game_collision_cb_t cb, void *user_data)
+{
+    return game_collision_grid_query(s_shooter.grid,
+                                     (int32_t)floorf(x), (int32_t)floorf(y),
+                                     (int32_t)w + 1, (int32_t)h + 1,
+                                     cb, user_data) > 0U;
+}
+
 static void shooter_update_hud(void)
 {
     if (s_shooter.score_label == NULL) return;
@@ -109,7 +175,8 @@ static void shooter_set_ship_x(float x)
     if (x > (float)(SHOOT_ARENA_W - SHOOT_SHIP_W))
         x = (float)(SHOOT_ARENA_W - SHOOT_SHIP_W);
     s_shooter.ship_x = x;
-    lv_obj_set_pos(s_shooter.ship, (int32_t)s_shooter.ship_x, SHOOT_SHIP_Y);
+    game_sprite_set_pos(s_shooter.sprites, s_shooter.ship,
+                        (int32_t)s_shooter.ship_x, SHOOT_SHIP_Y);
 }
 
 static void shooter_reset_bullet(uint32_t i)
@@ -117,7 +184,7 @@ static void shooter_reset_bullet(uint32_t i)
     s_shooter.bullets[i].active = false;
     s_shooter.bullets[i].x = -20.0f;
     s_shooter.bullets[i].y = -20.0f;
-    lv_obj_add_flag(s_shooter.bullets[i].obj, LV_OBJ_FLAG_HIDDEN);
+    game_sprite_set_visible(s_shooter.sprites, s_shooter.bullets[i].spr, false);
 }
 
 static void shooter_reset_enemy(uint32_t i)
@@ -125,7 +192,19 @@ static void shooter_reset_enemy(uint32_t i)
     s_shooter.enemies[i].active = false;
     s_shooter.enemies[i].x = -30.0f;
     s_shooter.enemies[i].y = -30.0f;
-    lv_obj_add_flag(s_shooter.enemies[i].obj, LV_OBJ_FLAG_HIDDEN);
+    game_sprite_set_visible(s_shooter.sprites, s_shooter.enemies[i].spr, false);
+    game_collision_grid_remove(s_shooter.grid, (uint16_t)i);
+}
+
+static void shooter_place_enemy(uint32_t i)
+{
+    game_sprite_set_pos(s_shooter.sprites, s_shooter.enemies[i].spr,
+                        (int32_t)s_shooter.enemies[i].x,
+                        (int32_t)s_shooter.enemies[i].y);
+    game_collision_grid_set(s_shooter.grid, (uint16_t)i,
+                            (int32_t)floorf(s_shooter.enemies[i].x),
+                            (int32_t)floorf(s_shooter.enemies[i].y),
+                            SHOOT_ENEMY_W + 1, SHOOT_ENEMY_H + 1);
 }
 
 static void shooter_spawn_enemy(void)
@@ -138,34 +217,127 @@ static void shooter_spawn_enemy(void)
             s_shooter.enemies[i].y = -20.0f;
             /* Random speed 1.8 - 3.4 px/tick */
             s_shooter.enemies[i].vy = ((float)lv_rand(18, 34)) / 10.0f;
-            lv_obj_clear_flag(s_shooter.enemies[i].obj, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_pos(s_shooter.enemies[i].obj,
-                           (int32_t)s_shooter.enemies[i].x,
-                           (int32_t)s_shooter.enemies[i].y);
+            shooter_place_enemy(i);
+            game_sprite_set_visible(s_shooter.sprites, s_shooter.enemies[i].spr, true);
             return;
         }
     }
 }
 
-static void shooter_fire(void)
+static void shooter_fire_at(float x)
 {
     uint32_t i;
-    if (!s_shooter.running) return;
     for (i = 0; i < SHOOT_BULLET_MAX; i++) {
         if (!s_shooter.bullets[i].active) {
             s_shooter.bullets[i].active = true;
-            s_shooter.bullets[i].x = s_shooter.ship_x +
-                                      (SHOOT_SHIP_W / 2.0f) - 2.0f;
+            s_shooter.bullets[i].x = x;
             s_shooter.bullets[i].y = (float)SHOOT_SHIP_Y - 8.0f;
-            lv_obj_clear_flag(s_shooter.bullets[i].obj, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_pos(s_shooter.bullets[i].obj,
-                           (int32_t)s_shooter.bullets[i].x,
-                           (int32_t)s_shooter.bullets[i].y);
+            game_sprite_set_pos(s_shooter.sprites, s_shooter.bullets[i].spr,
+                                (int32_t)s_shooter.bullets[i].x,
+                                (int32_t)s_shooter.bullets[i].y);
+            game_sprite_set_visible(s_shooter.sprites, s_shooter.bullets[i].spr, true);
             return;
         }
     }
 }
 
+static void shooter_fire(void)
+{
+    if (!s_shooter.running) return;
+    shooter_fire_at(s_shooter.ship_x + (SHOOT_SHIP_W / 2.0f) - 2.0f);
+}
+
+/*******************************************************************************
+ * Collision Callbacks
+ *******************************************************************************/
+typedef struct {
+    float x;
+    float y;
+    float w;
+    float h;
+    int32_t enemy;      /* first enemy hit, or -1 */
+} shooter_hit_t;
+
+static bool shooter_hit_cb(uint16_t id, void *user_data)
+{
+    shooter_hit_t *hit = (shooter_hit_t *)user_data;
+    const shooter_enemy_t *e = &s_shooter.enemies[id];
+
+    if (!shooter_overlap(hit->x, hit->y, hit->w, hit->h,
+                         e->x, e->y, (float)SHOOT_ENEMY_W, (float)SHOOT_ENEMY_H)) {
+        return true;
+    }
+    hit->enemy = (int32_t)id;
+    return false;
+}
+
+#if SHOOT_STRESS
+static uint32_t shooter_now_us(void)
+{
+#if defined(_WIN32)
+    return (uint32_t)((uint64_t)clock() * 1000000U / CLOCKS_PER_SEC);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U);
+#endif
+}
+
+static bool shooter_count_cb(uint16_t id, void *user_data)
+{
+    shooter_hit_t *hit = (shooter_hit_t *)user_data;
+    const shooter_enemy_t *e = &s_shooter.enemies[id];
+
+    if (shooter_overlap(hit->x, hit->y, hit->w, hit->h,
+                        e->x, e->y, (float)SHOOT_ENEMY_W, (float)SHOOT_ENEMY_H)) {
+        hit->enemy++;
+    }
+    return true;
+}
+
+/* Count every bullet-enemy overlap twice, through the grid and by testing
+ * all pairs, and print both times. The counts must match. */
+static void shooter_stress_report(void)
+{
+    uint32_t i, j;
+    uint32_t bullets = 0, enemies = 0, brute_hits = 0;
+    shooter_hit_t hit = {0.0f, 0.0f, (float)SHOOT_BULLET_W, (float)SHOOT_BULLET_H, 0};
+
+    for (j = 0; j < SHOOT_ENEMY_MAX; j++) {
+        if (s_shooter.enemies[j].active) enemies++;
+    }
+
+    uint32_t t0 = shooter_now_us();
+    for (i = 0; i < SHOOT_BULLET_MAX; i++) {
+        if (!s_shooter.bullets[i].active) continue;
+        for (j = 0; j < SHOOT_ENEMY_MAX; j++) {
+            if (!s_shooter.enemies[j].active) continue;
+            if (shooter_overlap(s_shooter.bullets[i].x, s_shooter.bullets[i].y,
+                                (float)SHOOT_BULLET_W, (float)SHOOT_BULLET_H,
+                                s_shooter.enemies[j].x, s_shooter.enemies[j].y,
+                                (float)SHOOT_ENEMY_W, (float)SHOOT_ENEMY_H)) {
+                brute_hits++;
+            }
+        }
+    }
+    uint32_t t1 = shooter_now_us();
+    for (i = 0; i < SHOOT_BULLET_MAX; i++) {
+        if (!s_shooter.bullets[i].active) continue;
+        bullets++;
+        hit.x = s_shooter.bullets[i].x;
+        hit.y = s_shooter.bullets[i].y;
+        shooter_grid_query(hit.x, hit.y, hit.w, hit.h, shooter_count_cb, &hit);
+    }
+    uint32_t t2 = shooter_now_us();
+
+    printf("[STRESS] bullets=%lu enemies=%lu hits=%lu/%lu all-pairs=%luus grid=%luus%s\r\n",
+           (unsigned long)bullets, (unsigned long)enemies,
+           (unsigned long)hit.enemy, (unsigned long)brute_hits,
+           (unsigned long)(t1 - t0), (unsigned long)(t2 - t1),
+           ((uint32_t)hit.enemy == brute_hits) ? "" : "  MISMATCH");
+}
+#endif
+
 /*******************************************************************************
  * Game Over / Start
  *******************************************************************************/
@@ -178,6 +350,18 @@ static void shooter_game_over(const char *msg)
     shooter_update_hud();
 }
 
+/* Returns false when the game is over (never in stress mode) */
+static bool shooter_lose_life(const char *msg)
+{
+    if (SHOOT_STRESS) return true;
+    s_shooter.lives--;
+    if (s_shooter.lives <= 0) {
+        shooter_game_over(msg);
+        return false;
+    }
+    return true;
+}
+
 static void shooter_start(void)
 {
     uint32_t i;
@@ -205,7 +389,8 @@ static void shooter_start(void)
  *******************************************************************************/
 static void shooter_step(void)
 {
-    uint32_t i, j;
+    uint32_t i;
+    shooter_hit_t hit;
 
     /* Spawn cooldown timer */
     if (s_shooter.spawn_cd > 0U) {
@@ -215,6 +400,13 @@ static void shooter_step(void)
         s_shooter.spawn_cd = 18U;
     }
 
+#if SHOOT_STRESS
+    for (i = 0; i < SHOOT_STRESS_SPAWN_PER_TICK; i++) shooter_spawn_enemy();
+    for (i = 0; i < SHOOT_STRESS_FIRE_PER_TICK; i++) {
+        shooter_fire_at((float)lv_rand(0, SHOOT_ARENA_W - SHOOT_BULLET_W));
+    }
+#endif
+
     /* Move bullets upward at 7px/tick */
     for (i = 0; i < SHOOT_BULLET_MAX; i++) {
         if (!s_shooter.bullets[i].active) continue;
@@ -223,65 +415,63 @@ static void shooter_step(void)
             shooter_reset_bullet(i);
             continue;
         }
-        lv_obj_set_pos(s_shooter.bullets[i].obj,
-                       (int32_t)s_shooter.bullets[i].x,
-                       (int32_t)s_shooter.bullets[i].y);
+        game_sprite_set_pos(s_shooter.sprites, s_shooter.bullets[i].spr,
+                            (int32_t)s_shooter.bullets[i].x,
+                            (int32_t)s_shooter.bullets[i].y);
     }
 
-    /* Move enemies downward + collision detection */
+    /* Move enemies downward */
     for (i = 0; i < SHOOT_ENEMY_MAX; i++) {
-        bool removed = false;
         if (!s_shooter.enemies[i].active) continue;
 
         s_shooter.enemies[i].y += s_shooter.enemies[i].vy;
-        lv_obj_set_pos(s_shooter.enemies[i].obj,
-                       (int32_t)s_shooter.enemies[i].x,
-                       (int32_t)s_shooter.enemies[i].y);
 
         /* Enemy passed bottom - lose a life */
         if (s_shooter.enemies[i].y > (float)SHOOT_ARENA_H) {
             shooter_reset_enemy(i);
-            s_shooter.lives--;
-            if (s_shooter.lives <= 0) {
-                shooter_game_over("Base destroyed");
-                return;
-            }
+            if (!shooter_lose_life("Base destroyed")) return;
             continue;
         }
+        shooter_place_enemy(i);
+    }
 
-        /* AABB: Bullet-enemy collision */
-        for (j = 0; j < SHOOT_BULLET_MAX; j++) {
-            if (!s_shooter.bullets[j].active) continue;
-            if (shooter_overlap(
-                    s_shooter.bullets[j].x, s_shooter.bullets[j].y,
-                    4.0f, 10.0f,
-                    s_shooter.enemies[i].x, s_shooter.enemies[i].y,
-                    26.0f, 16.0f)) {
-                shooter_reset_bullet(j);
-                shooter_reset_enemy(i);
-                removed = true;
-                s_shooter.score++;
-                if (s_shooter.score > s_shooter_best)
-                    s_shooter_best = s_shooter.score;
-                shooter_spawn_enemy();
-                break;
-            }
+#if SHOOT_STRESS
+    if (++s_shooter.ticks % SHOOT_STRESS_REPORT_TICKS == 0U) shooter_stress_report();
+#endif
+
+    /* AABB: Bullet-enemy collision (grid finds the candidates) */
+    for (i = 0; i < SHOOT_BULLET_MAX; i++) {
+        if (!s_shooter.bullets[i].active) continue;
+        hit.x = s_shooter.bullets[i].x;
+        hit.y = s_shooter.bullets[i].y;
+        hit.w = (float)SHOOT_BULLET_W;
+        hit.h = (float)SHOOT_BULLET_H;
+        hit.enemy = -1;
+        if (!shooter_grid_query(hit.x, hit.y, hit.w, hit.h, shooter_hit_cb, &hit) ||
+            hit.enemy < 0) {
+            continue;
         }
-        if (removed) continue;
-
-        /* AABB: Ship-enemy collision */
-        if (shooter_overlap(
-                s_shooter.ship_x, (float)SHOOT_SHIP_Y,
-                (float)SHOOT_SHIP_W, (float)SHOOT_SHIP_H,
-                s_shooter.enemies[i].x, s_shooter.enemies[i].y,
-                26.0f, 16.0f)) {
-            shooter_reset_enemy(i);
-            s_shooter.lives--;
-            if (s_shooter.lives <= 0) {
-                shooter_game_over("Ship collision");
-                return;
-            }
+        shooter_reset_bullet(i);
+        shooter_reset_enemy((uint32_t)hit.enemy);
+        s_shooter.score++;
+        if (s_shooter.score > s_shooter_best)
+            s_shooter_best = s_shooter.score;
+        shooter_spawn_enemy();
+    }
+
+    /* AABB: Ship-enemy collision */
+    hit.x = s_shooter.ship_x;
+    hit.y = (float)SHOOT_SHIP_Y;
+    hit.w = (float)SHOOT_SHIP_W;
+    hit.h = (float)SHOOT_SHIP_H;
+    for (;;) {
+        hit.enemy = -1;
+        if (!shooter_grid_query(hit.x, hit.y, hit.w, hit.h, shooter_hit_cb, &hit) ||
+            hit.enemy < 0) {
+            break;
         }
+        shooter_reset_enemy((uint32_t)hit.enemy);
+        if (!shooter_lose_life("Ship collision")) return;
     }
 
     shooter_update_hud();
@@ -327,6 +517,13 @@ static void shooter_tick_cb(lv_timer_t *timer)
 /*******************************************************************************
  * Example Entry Point
  *******************************************************************************/
+static void shooter_arena_delete_cb(lv_event_t *e)
+{
+    (void)e;
+    game_collision_grid_delete(s_shooter.grid);
+    s_shooter.grid = NULL;
+}
+
 void example_main(lv_obj_t *parent)
 {
     lv_obj_t *arena;
@@ -383,86 +580,38 @@ void example_main(lv_obj_t *parent)
     /* CRT scanlines */
     game_add_lcd_scanlines(arena, SHOOT_ARENA_W, SHOOT_ARENA_H);
 
-    /* Ship body (44x20 px) */
-    s_shooter.ship = lv_obj_create(arena);
-    lv_obj_set_size(s_shooter.ship, SHOOT_SHIP_W, SHOOT_SHIP_H);
-    lv_obj_set_style_bg_color(s_shooter.ship, gb_color(GB_DARKEST), 0);
-    lv_obj_set_style_border_color(s_shooter.ship, gb_color(GB_LIGHTEST), 0);
-    lv_obj_set_style_border_width(s_shooter.ship, 1, 0);
-    lv_obj_set_style_radius(s_shooter.ship, 2, 0);
-    lv_obj_clear_flag(s_shooter.ship, LV_OBJ_FLAG_SCROLLABLE);
-    {
-        /* Left wing */
-        lv_obj_t *wing_l = lv_obj_create(s_shooter.ship);
-        lv_obj_set_size(wing_l, 8, 8);
-        lv_obj_set_pos(wing_l, 0, 10);
-        lv_obj_set_style_bg_color(wing_l, gb_color(GB_DARK), 0);
-        lv_obj_set_style_border_width(wing_l, 0, 0);
-        lv_obj_set_style_radius(wing_l, 1, 0);
-        lv_obj_clear_flag(wing_l, LV_OBJ_FLAG_SCROLLABLE);
-
-        /* Right wing */
-        lv_obj_t *wing_r = lv_obj_create(s_shooter.ship);
-        lv_obj_set_size(wing_r, 8, 8);
-        lv_obj_set_pos(wing_r, SHOOT_SHIP_W - 8, 10);
-        lv_obj_set_style_bg_color(wing_r, gb_color(GB_DARK), 0);
-        lv_obj_set_style_border_width(wing_r, 0, 0);
-        lv_obj_set_style_radius(wing_r, 1, 0);
-        lv_obj_clear_flag(wing_r, LV_OBJ_FLAG_SCROLLABLE);
-
-        /* Cabin */
-        lv_obj_t *cabin = lv_obj_create(s_shooter.ship);
-        lv_obj_set_size(cabin, 12, 8);
-        lv_obj_set_pos(cabin, 16, 0);
-        lv_obj_set_style_bg_color(cabin, gb_color(GB_LIGHTEST), 0);
-        lv_obj_set_style_border_color(cabin, gb_color(GB_DARKEST), 0);
-        lv_obj_set_style_border_width(cabin, 1, 0);
-        lv_obj_set_style_radius(cabin, 1, 0);
-        lv_obj_clear_flag(cabin, LV_OBJ_FLAG_SCROLLABLE);
-    }
+    /* Sprite layer: ship, bullet pool, enemy pool (drawn in this order) */
+    s_shooter.sprites = game_sprite_layer_create(arena, SHOOT_ARENA_W, SHOOT_ARENA_H,
+                                                 1 + SHOOT_BULLET_MAX + SHOOT_ENEMY_MAX);
+
+    /* Ship body (44x20 px) with wings + cabin */
+    s_shooter.ship = game_sprite_add(s_shooter.sprites, SHOOT_SHIP_W, SHOOT_SHIP_H,
+                                     &s_ship_style);
+    game_sprite_set_parts(s_shooter.sprites, s_shooter.ship, s_ship_parts,
+                          (uint8_t)(sizeof(s_ship_parts) / sizeof(s_ship_parts[0])));
+    game_sprite_set_visible(s_shooter.sprites, s_shooter.ship, true);
 
     /* Bullet pool (pre-allocated, hidden until fired) */
     for (i = 0; i < SHOOT_BULLET_MAX; i++) {
-        s_shooter.bullets[i].obj = lv_obj_create(arena);
-        lv_obj_set_size(s_shooter.bullets[i].obj, 4, 10);
-        lv_obj_set_style_bg_color(s_shooter.bullets[i].obj,
-                                   gb_color(GB_DARKEST), 0);
-        lv_obj_set_style_border_width(s_shooter.bullets[i].obj, 0, 0);
-        lv_obj_set_style_radius(s_shooter.bullets[i].obj, 1, 0);
-        lv_obj_clear_flag(s_shooter.bullets[i].obj, LV_OBJ_FLAG_SCROLLABLE);
+        s_shooter.bullets[i].spr = game_sprite_add(s_shooter.sprites,
+                                                   SHOOT_BULLET_W, SHOOT_BULLET_H,
+                                                   &s_bullet_style);
         shooter_reset_bullet(i);
     }
 
+    /* Enemy collision grid, freed with the arena */
+    s_shooter.grid = game_collision_grid_create(SHOOT_ARENA_W, SHOOT_ARENA_H,
+                                                SHOOT_GRID_CELL, SHOOT_ENEMY_MAX);
+    lv_obj_add_event_cb(arena, shooter_arena_delete_cb, LV_EVENT_DELETE, NULL);
+
     /* Enemy pool (pre-allocated, dual eyes, hidden until spawned) */
     for (i = 0; i < SHOOT_ENEMY_MAX; i++) {
-        s_shooter.enemies[i].obj = lv_obj_create(arena);
-        lv_obj_set_size(s_shooter.enemies[i].obj, 26, 16);
-        lv_obj_set_style_bg_color(s_shooter.enemies[i].obj,
-                                   gb_color(GB_DARK), 0);
-        lv_obj_set_style_border_color(s_shooter.enemies[i].obj,
-                                       gb_color(GB_DARKEST), 0);
-        lv_obj_set_style_border_width(s_shooter.enemies[i].obj, 1, 0);
-        lv_obj_set_style_radius(s_shooter.enemies[i].obj, 2, 0);
-        lv_obj_clear_flag(s_shooter.enemies[i].obj, LV_OBJ_FLAG_SCROLLABLE);
-        {
-            /* Left eye */
-            lv_obj_t *eye1 = lv_obj_create(s_shooter.enemies[i].obj);
-            lv_obj_set_size(eye1, 4, 4);
-            lv_obj_set_pos(eye1, 5, 4);
-            lv_obj_set_style_bg_color(eye1, gb_color(GB_LIGHTEST), 0);
-            lv_obj_set_style_border_width(eye1, 0, 0);
-            lv_obj_set_style_radius(eye1, 1, 0);
-            lv_obj_clear_flag(eye1, LV_OBJ_FLAG_SCROLLABLE);
-
-            /* Right eye */
-            lv_obj_t *eye2 = lv_obj_create(s_shooter.enemies[i].obj);
-            lv_obj_set_size(eye2, 4, 4);
-            lv_obj_set_pos(eye2, 17, 4);
-            lv_obj_set_style_bg_color(eye2, gb_color(GB_LIGHTEST), 0);
-            lv_obj_set_style_border_width(eye2, 0, 0);
-            lv_obj_set_style_radius(eye2, 1, 0);
-            lv_obj_clear_flag(eye2, LV_OBJ_FLAG_SCROLLABLE);
-        }
+        s_shooter.enemies[i].spr = game_sprite_add(s_shooter.sprites,
+                                                   SHOOT_ENEMY_W, SHOOT_ENEMY_H,
+                                                   &s_enemy_style);
+        game_sprite_set_parts(s_shooter.sprites, s_shooter.enemies[i].spr,
+                              s_enemy_parts,
+                              (uint8_t)(sizeof(s_enemy_parts) / sizeof(s_enemy_parts[0])));
         shooter_reset_enemy(i);
     }
 
@@ -4,7 +4,10 @@
  *
  * @description
  *   Industrial dashboard with direct sensor reads from app_sensor,
- *   rolling chart, and system status indicators.
+ *   rolling chart, and system status indicators. The chart keeps ten
+ *   minutes of readings and draws them as a min/max envelope, so no peak
+ *   is dropped; the header shows min/avg/max over the same points from a
+ *   stream_window.
  *   Ported from Developer Hub a20_production_dashboard.
  *
  * @board    KIT_PSE84_AI, TESAIoT_PSE84_AI
@@ -15,6 +18,7 @@
 #include "app_interface.h"
 #include "tesaiot_thai.h"
 #include "sensor_bus.h"
+#include "stream_stats.h"
 
 /* app_sensor direct sensor readers */
 #include "bmi270/bmi270_reader.h"
@@ -28,7 +32,7 @@
 #define CARD_GAP       8
 #define CHART_W      380
 #define CHART_H      140
-#define CHART_PTS     60
+#define CHART_PTS   1200   /* 10 min of 500 ms ticks, drawn decimated */
 #define STATUS_W     380
 #define STATUS_H      36
 
@@ -41,6 +45,13 @@ static lv_obj_t  *s_chart;
 static lv_chart_series_t *s_series;
 static lv_obj_t  *s_status_dots[4];
 static lv_obj_t  *s_lbl_uptime;
+static lv_obj_t  *s_lbl_chart_stats;
+
+/* Accel magnitude over the points on the chart */
+static stream_window_t s_accel_win;
+static float     s_accel_values[CHART_PTS];
+static uint32_t  s_accel_min_q[CHART_PTS];
+static uint32_t  s_accel_max_q[CHART_PTS];
 
 static bool s_bmi270_ok = false;
 static bool s_dps368_ok = false;
@@ -136,8 +147,13 @@ static void dashboard_timer_cb(lv_timer_t *t)
         lv_obj_set_style_bg_color(s_status_dots[2], UI_COLOR_TEXT_DIM, 0);
     }
 
-    /* Chart: add real accel magnitude */
+    /* Chart and its min/avg/max: add real accel magnitude */
     lv_chart_set_next_value(s_chart, s_series, (int32_t)(accel_mag * 100));
+    stream_window_push(&s_accel_win, accel_mag);
+    lv_label_set_text_fmt(s_lbl_chart_stats, "Min %.2f  Avg %.2f  Max %.2f",
+                          (double)stream_window_min(&s_accel_win),
+                          (double)stream_window_mean(&s_accel_win),
+                          (double)stream_window_max(&s_accel_win));
 
     /* SYS status: always green (board running) */
     lv_obj_set_style_bg_color(s_status_dots[3], UI_COLOR_SUCCESS, 0);
@@ -188,11 +204,19 @@ void example_main(lv_obj_t *parent)
     lv_obj_align(chart_card, LV_ALIGN_CENTER, 0, 60);
 
     lv_obj_t *chart_title = lv_label_create(chart_card);
-    lv_label_set_text(chart_title, "Accel Magnitude (g x100)");
+    lv_label_set_text(chart_title, "Accel (g x100)");
     lv_obj_set_style_text_color(chart_title, UI_COLOR_TEXT_DIM, 0);
     lv_obj_set_style_text_font(chart_title, &lv_font_montserrat_14, 0);
     lv_obj_align(chart_title, LV_ALIGN_TOP_LEFT, 0, 0);
 
+    s_lbl_chart_stats = lv_label_create(chart_card);
+    lv_label_set_text(s_lbl_chart_stats, "Min --  Avg --  Max --");
+    lv_obj_set_style_text_color(s_lbl_chart_stats, UI_COLOR_TEXT_DIM, 0);
+    lv_obj_set_style_text_font(s_lbl_chart_stats, &lv_font_montserrat_14, 0);
+    lv_obj_align(s_lbl_chart_stats, LV_ALIGN_TOP_RIGHT, 0, 0);
+    stream_window_init(&s_accel_win, s_accel_values, s_accel_min_q, s_accel_max_q,
+                       CHART_PTS);
+
     s_chart = lv_chart_create(chart_card);
     lv_obj_set_size(s_chart, CHART_W - 24, CHART_H - 10);
     lv_obj_align(s_chart, LV_ALIGN_BOTTOM_MID, 0, 0);
@@ -207,6 +231,7 @@ void example_main(lv_obj_t *parent)
 
     s_series = lv_chart_add_series(s_chart, UI_COLOR_BMI270,
                                     LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_set_series_decimate(s_chart, s_series, true);
 
     /* Pre-fill chart */
     for (int i = 0; i < CHART_PTS; i++) {
@@ -2,7 +2,9 @@
  * I09 - Data Logger (Practise)
  *
  * Logs sensor readings with timestamp into a scrollable list.
- * Configurable sample rate and up to 200 entries before oldest are removed.
+ * Configurable sample rate and up to 100k entries before oldest are removed.
+ * Readings are kept as compact records in a log_list ring; only the rows on
+ * screen exist as objects and are re-filled as the list scrolls.
  *
  * Ported from Developer Hub — uses direct app_sensor drivers instead of IPC.
  * Sensors: BMI270 + DPS368 + SHT4x
@@ -11,14 +13,30 @@
 #include "app_interface.h"
 #include "tesaiot_thai.h"
 #include "sensor_bus.h"
+#include "log_list.h"
 
 #include "bmi270/bmi270_reader.h"
 #include "dps368/dps368_reader.h"
 #include "sht4x/sht4x_reader.h"
 
 #define UPDATE_MS       1000
-#define MAX_ENTRIES     200
+#define MAX_ENTRIES     100000
 #define ENTRY_HEIGHT    36
+#define ENTRY_GAP       2
+
+/* Which readings a record holds */
+#define LOG_HAS_BMI     (1U << 0)
+#define LOG_HAS_DPS     (1U << 1)
+#define LOG_HAS_SHT     (1U << 2)
+
+typedef struct {
+    uint32_t elapsed_s;
+    float    acc_x;
+    float    pressure_hpa;
+    float    temperature_c;
+    float    humidity_rh;
+    uint8_t  has;
+} log_record_t;
 
 typedef struct {
     lv_obj_t *list;
@@ -29,25 +47,72 @@ typedef struct {
     uint32_t  start_tick;
 } logger_ctx_t;
 
-static void add_log_entry(logger_ctx_t *ctx)
+static void row_create_cb(lv_obj_t *row, void *user_data)
 {
-    /* Build timestamp from elapsed ticks */
-    uint32_t elapsed_s = (lv_tick_get() - ctx->start_tick) / 1000;
-    uint32_t mm = elapsed_s / 60;
-    uint32_t ss = elapsed_s % 60;
+    (void)user_data;
+    /* Only the pooled rows are styled, so local styles are cheap here */
+    lv_obj_set_width(row, 746);
+    lv_obj_set_style_bg_color(row, UI_COLOR_CARD_BG, 0);
+    lv_obj_set_style_bg_opa(row, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(row, 4, 0);
+    lv_obj_set_style_border_width(row, 0, 0);
+    lv_obj_set_style_pad_hor(row, 8, 0);
+
+    /* Entry number, then the readings */
+    lv_obj_t *lbl_num = example_label_create(row, "",
+                                             &lv_font_montserrat_14,
+                                             UI_COLOR_PRIMARY);
+    lv_obj_align(lbl_num, LV_ALIGN_LEFT_MID, 0, 0);
+
+    lv_obj_t *lbl_data = example_label_create(row, "",
+                                              &lv_font_montserrat_14,
+                                              UI_COLOR_TEXT);
+    lv_obj_align(lbl_data, LV_ALIGN_LEFT_MID, 60, 0);
+}
+
+static void row_bind_cb(lv_obj_t *row, uint32_t seq, const void *record, void *user_data)
+{
+    const log_record_t *rec = (const log_record_t *)record;
+    (void)user_data;
 
     /* Build entry text */
     char buf[256];
     int len = 0;
     len += snprintf(buf + len, sizeof(buf) - len, "[%02lu:%02lu] ",
-                    (unsigned long)mm, (unsigned long)ss);
+                    (unsigned long)(rec->elapsed_s / 60),
+                    (unsigned long)(rec->elapsed_s % 60));
+    if (rec->has & LOG_HAS_BMI) {
+        len += snprintf(buf + len, sizeof(buf) - len, "aX:%.2f ",
+                        (double)rec->acc_x);
+    }
+    if (rec->has & LOG_HAS_DPS) {
+        len += snprintf(buf + len, sizeof(buf) - len, "P:%.1f ",
+                        (double)rec->pressure_hpa);
+    }
+    if (rec->has & LOG_HAS_SHT) {
+        len += snprintf(buf + len, sizeof(buf) - len, "T:%.1f H:%.0f%% ",
+                        (double)rec->temperature_c,
+                        (double)rec->humidity_rh);
+    }
+
+    lv_label_set_text_fmt(lv_obj_get_child(row, 0), "#%lu", (unsigned long)seq);
+    lv_label_set_text(lv_obj_get_child(row, 1), buf);
+}
+
+static void add_log_entry(logger_ctx_t *ctx)
+{
+    log_record_t rec;
+    memset(&rec, 0, sizeof(rec));
+
+    /* Timestamp from elapsed ticks */
+    rec.elapsed_s = (lv_tick_get() - ctx->start_tick) / 1000;
 
     /* BMI270 */
     {
         bmi270_sample_t bmi_sample;
         if (bmi270_reader_poll(&bmi_sample)) {
-            len += snprintf(buf + len, sizeof(buf) - len, "aX:%.2f ",
-                            (double)bmi_sample.acc_g_x);
+            rec.acc_x = bmi_sample.acc_g_x;
+            rec.has |= LOG_HAS_BMI;
         }
     }
 
@@ -55,8 +120,8 @@ static void add_log_entry(logger_ctx_t *ctx)
     {
         dps368_sample_t dps_sample;
         if (dps368_reader_poll(&dps_sample)) {
-            len += snprintf(buf + len, sizeof(buf) - len, "P:%.1f ",
-                            (double)dps_sample.pressure_hpa);
+            rec.pressure_hpa = dps_sample.pressure_hpa;
+            rec.has |= LOG_HAS_DPS;
         }
     }
 
@@ -64,47 +129,17 @@ static void add_log_entry(logger_ctx_t *ctx)
     {
         sht4x_sample_t sht_sample;
         if (sht4x_reader_poll(&sht_sample)) {
-            len += snprintf(buf + len, sizeof(buf) - len, "T:%.1f H:%.0f%% ",
-                            (double)sht_sample.temperature_c,
-                            (double)sht_sample.humidity_rh);
+            rec.temperature_c = sht_sample.temperature_c;
+            rec.humidity_rh = sht_sample.humidity_rh;
+            rec.has |= LOG_HAS_SHT;
         }
     }
 
-    /* Remove oldest if at capacity */
-    uint32_t child_count = lv_obj_get_child_count(ctx->list);
-    if (child_count >= MAX_ENTRIES) {
-        lv_obj_t *oldest = lv_obj_get_child(ctx->list, 0);
-        if (oldest) lv_obj_del(oldest);
-    }
-
-    /* Create new entry row */
-    lv_obj_t *row = lv_obj_create(ctx->list);
-    lv_obj_set_size(row, 746, ENTRY_HEIGHT);
-    lv_obj_set_style_bg_color(row, UI_COLOR_CARD_BG, 0);
-    lv_obj_set_style_bg_opa(row, LV_OPA_COVER, 0);
-    lv_obj_set_style_radius(row, 4, 0);
-    lv_obj_set_style_border_width(row, 0, 0);
-    lv_obj_set_style_pad_hor(row, 8, 0);
-    lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
-
-    /* Entry number */
-    char num_buf[8];
-    snprintf(num_buf, sizeof(num_buf), "#%lu", (unsigned long)ctx->entry_count);
-    lv_obj_t *lbl_num = example_label_create(row, num_buf,
-                                             &lv_font_montserrat_14,
-                                             UI_COLOR_PRIMARY);
-    lv_obj_align(lbl_num, LV_ALIGN_LEFT_MID, 0, 0);
-
-    lv_obj_t *lbl_data = example_label_create(row, buf,
-                                              &lv_font_montserrat_14,
-                                              UI_COLOR_TEXT);
-    lv_obj_align(lbl_data, LV_ALIGN_LEFT_MID, 50, 0);
-
+    /* Oldest record drops out of the ring at capacity; the list follows
+     * the newest entry while it is scrolled to the bottom */
+    log_list_append(ctx->list, &rec);
     ctx->entry_count++;
 
-    /* Auto-scroll to bottom */
-    lv_obj_scroll_to_y(ctx->list, LV_COORD_MAX, LV_ANIM_ON);
-
     lv_label_set_text_fmt(ctx->lbl_count, "Entries: %lu",
                           (unsigned long)ctx->entry_count);
 }
@@ -135,7 +170,7 @@ static void btn_toggle_cb(lv_event_t *e)
 static void btn_clear_cb(lv_event_t *e)
 {
     logger_ctx_t *ctx = (logger_ctx_t *)lv_event_get_user_data(e);
-    lv_obj_clean(ctx->list);
+    log_list_clear(ctx->list);
     ctx->entry_count = 0;
     lv_label_set_text(ctx->lbl_count, "Entries: 0");
 }
@@ -221,18 +256,22 @@ void example_main(lv_obj_t *parent)
                                         &lv_font_montserrat_14,
                                         UI_COLOR_TEXT_DIM);
 
-    /* Scrollable log list */
-    ctx.list = lv_obj_create(parent);
+    /* Scrollable log list (virtual: rows are recycled) */
+    ctx.list = log_list_create(parent, sizeof(log_record_t), MAX_ENTRIES);
+    if (ctx.list == NULL) {
+        example_label_create(parent, "Not enough memory for the log",
+                             &lv_font_montserrat_14, UI_COLOR_ERROR);
+        return;
+    }
     lv_obj_set_size(ctx.list, 770, 340);
-    lv_obj_set_flex_flow(ctx.list, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_style_pad_all(ctx.list, 4, 0);
-    lv_obj_set_style_pad_row(ctx.list, 2, 0);
     lv_obj_set_style_bg_color(ctx.list, lv_color_hex(0x0A1628), 0);
     lv_obj_set_style_bg_opa(ctx.list, LV_OPA_COVER, 0);
     lv_obj_set_style_border_color(ctx.list, UI_COLOR_TEXT_DIM, 0);
     lv_obj_set_style_border_width(ctx.list, 1, 0);
     lv_obj_set_style_radius(ctx.list, 8, 0);
-    lv_obj_set_scroll_dir(ctx.list, LV_DIR_VER);
+    log_list_set_rows(ctx.list, ENTRY_HEIGHT, ENTRY_GAP,
+                      row_create_cb, row_bind_cb, NULL);
 
     lv_timer_create(timer_cb, UPDATE_MS, &ctx);
 }
@@ -4,6 +4,12 @@
  * Shows min/max/avg statistics for BMI270 acceleration data with a
  * line chart and live statistical readouts.
  *
+ * Every FIFO sample goes into a stream_window (sliding min/max/mean/std and
+ * a histogram for the 95th percentile) and an EWMA, so the readouts cost
+ * the same per sample however long the window is. The chart plots every
+ * sample too; its series are decimated, so drawing 2400 points costs about
+ * as much as drawing one per pixel column.
+ *
  * Ported from Developer Hub — uses direct app_sensor driver instead of IPC.
  */
 #include "pse84_common.h"
@@ -11,59 +17,67 @@
 #include "tesaiot_thai.h"
 
 #include "bmi270/bmi270_reader.h"
+#include "bmi270/bmi270_config.h"
 #include "sensor_bus.h"
+#include "stream_stats.h"
 
 #include <math.h>
 
 #define UPDATE_MS      100
-#define CHART_POINTS   120
-#define STATS_WINDOW   120   /* same as chart */
+#define CHART_SECONDS  12
+/* One chart point per FIFO sample */
+#define CHART_POINTS   (CHART_SECONDS * BMI270_FIFO_ODR_HZ)
+/* Statistics over the same samples as the chart */
+#define STATS_WINDOW   CHART_POINTS
+#define HIST_BINS      200   /* 0.02 g per bin over +-2 g */
+#define EWMA_TAU_S     0.5f
 
 typedef struct {
     lv_obj_t          *chart;
     lv_chart_series_t *ser_ax;
+    lv_chart_series_t *ser_ewma;
     lv_obj_t          *lbl_cur, *lbl_min, *lbl_max, *lbl_avg;
     lv_obj_t          *lbl_samples;
-    float              history[STATS_WINDOW];
-    int                idx;
-    int                count;
+    stream_window_t    win;
+    stream_ewma_t      ewma;
+    float              win_values[STATS_WINDOW];
+    uint32_t           win_min_q[STATS_WINDOW];
+    uint32_t           win_max_q[STATS_WINDOW];
+    uint32_t           win_hist[HIST_BINS];
+    bmi270_sample_t    fifo[BMI270_FIFO_DEPTH];
 } stats_ctx_t;
 
 static void update_stats(stats_ctx_t *ctx)
 {
-    if (ctx->count == 0) return;
-
-    int n = (ctx->count < STATS_WINDOW) ? ctx->count : STATS_WINDOW;
-    float mn = 999.0f, mx = -999.0f, sum = 0.0f;
-    for (int i = 0; i < n; i++) {
-        float v = ctx->history[i];
-        if (v < mn) mn = v;
-        if (v > mx) mx = v;
-        sum += v;
-    }
-    float avg = sum / n;
-
-    lv_label_set_text_fmt(ctx->lbl_min, "Min: %.3f g", (double)mn);
-    lv_label_set_text_fmt(ctx->lbl_max, "Max: %.3f g", (double)mx);
-    lv_label_set_text_fmt(ctx->lbl_avg, "Avg: %.3f g", (double)avg);
-    lv_label_set_text_fmt(ctx->lbl_samples, "Samples: %d", n);
+    const stream_window_t *w = &ctx->win;
+    if (stream_window_count(w) == 0) return;
+
+    lv_label_set_text_fmt(ctx->lbl_min, "Min: %.3f g", (double)stream_window_min(w));
+    lv_label_set_text_fmt(ctx->lbl_max, "Max: %.3f g", (double)stream_window_max(w));
+    lv_label_set_text_fmt(ctx->lbl_avg, "Avg: %.3f g", (double)stream_window_mean(w));
+    lv_label_set_text_fmt(ctx->lbl_samples, "Samples: %u  |  Std: %.3f g  |  P95: %.3f g",
+                          (unsigned)stream_window_count(w),
+                          (double)stream_window_stddev(w),
+                          (double)stream_window_percentile(w, 95.0f));
 }
 
 static void timer_cb(lv_timer_t *t)
 {
     stats_ctx_t *ctx = (stats_ctx_t *)lv_timer_get_user_data(t);
-    bmi270_sample_t bmi_sample;
-    if (!bmi270_reader_poll(&bmi_sample)) return;
 
-    float ax = bmi_sample.acc_g_x;
-
-    /* Store in ring buffer */
-    ctx->history[ctx->idx] = ax;
-    ctx->idx = (ctx->idx + 1) % STATS_WINDOW;
-    if (ctx->count < STATS_WINDOW) ctx->count++;
-
-    /* Update chart */
-    lv_chart_set_next_value(ctx->chart, ctx->ser_ax, (int32_t)(ax * 1000));
+    /* Every sample since the last tick: peaks between ticks are not lost */
+    size_t n = bmi270_reader_read_fifo(ctx->fifo, BMI270_FIFO_DEPTH);
+    if (n == 0) return;
+
+    /* The chart gets the same samples as the labels */
+    for (size_t i = 0; i < n; i++) {
+        float v = ctx->fifo[i].acc_g_x;
+        stream_window_push(&ctx->win, v);
+        stream_ewma_push(&ctx->ewma, v);
+        lv_chart_set_next_value(ctx->chart, ctx->ser_ax, (int32_t)(v * 1000));
+        lv_chart_set_next_value(ctx->chart, ctx->ser_ewma, (int32_t)(ctx->ewma.value * 1000));
+    }
+    float ax = ctx->fifo[n - 1].acc_g_x;
 
     /* Update labels */
     lv_label_set_text_fmt(ctx->lbl_cur, "Current: %.3f g", (double)ax);
@@ -73,9 +87,8 @@ static void timer_cb(lv_timer_t *t)
 static void btn_reset_cb(lv_event_t *e)
 {
     stats_ctx_t *ctx = (stats_ctx_t *)lv_event_get_user_data(e);
-    ctx->count = 0;
-    ctx->idx = 0;
-    memset(ctx->history, 0, sizeof(ctx->history));
+    stream_window_reset(&ctx->win);
+    stream_ewma_init(&ctx->ewma, stream_ewma_alpha(1.0f / BMI270_FIFO_ODR_HZ, EWMA_TAU_S));
     lv_label_set_text(ctx->lbl_min, "Min: --");
     lv_label_set_text(ctx->lbl_max, "Max: --");
     lv_label_set_text(ctx->lbl_avg, "Avg: --");
@@ -86,6 +99,10 @@ void example_main(lv_obj_t *parent)
 {
     static stats_ctx_t ctx;
     memset(&ctx, 0, sizeof(ctx));
+    stream_window_init(&ctx.win, ctx.win_values, ctx.win_min_q, ctx.win_max_q,
+                       STATS_WINDOW);
+    stream_window_set_hist(&ctx.win, ctx.win_hist, HIST_BINS, -2.0f, 2.0f);
+    stream_ewma_init(&ctx.ewma, stream_ewma_alpha(1.0f / BMI270_FIFO_ODR_HZ, EWMA_TAU_S));
 
     tesaiot_add_thai_support_badge();
 
@@ -140,6 +157,11 @@ void example_main(lv_obj_t *parent)
     ctx.ser_ax = lv_chart_add_series(ctx.chart,
                                      UI_COLOR_ERROR,
                                      LV_CHART_AXIS_PRIMARY_Y);
+    ctx.ser_ewma = lv_chart_add_series(ctx.chart,
+                                       UI_COLOR_WARNING,
+                                       LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_set_series_decimate(ctx.chart, ctx.ser_ax, true);
+    lv_chart_set_series_decimate(ctx.chart, ctx.ser_ewma, true);
 
     /* Statistics panel */
     lv_obj_t *stats = example_card_create(parent, 776, 130,
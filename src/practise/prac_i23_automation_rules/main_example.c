@@ -4,6 +4,11 @@
  * Rule engine UI: configure IF sensor > threshold THEN change indicator color.
  * Supports 4 configurable rules with real-time evaluation.
  *
+ * Rules compare a filtered value (stream_stats): acceleration as the peak
+ * over the last second, so a shake between samples still counts, and the
+ * slow environmental readings as an EWMA, so noise around the threshold
+ * does not make the indicator flicker.
+ *
  * Ported from Developer Hub — uses direct app_sensor drivers instead of IPC.
  * Sensors: BMI270 + DPS368 + SHT4x
  */
@@ -11,6 +16,7 @@
 #include "app_interface.h"
 #include "tesaiot_thai.h"
 #include "sensor_bus.h"
+#include "stream_stats.h"
 
 #include "bmi270/bmi270_reader.h"
 #include "dps368/dps368_reader.h"
@@ -20,6 +26,8 @@
 
 #define UPDATE_MS     200
 #define MAX_RULES     4
+#define PEAK_WINDOW   (1000 / UPDATE_MS)   /* samples in one second */
+#define EWMA_TAU_S    2.0f
 
 typedef enum {
     SOURCE_ACCEL_MAG = 0,
@@ -48,6 +56,11 @@ typedef struct {
 
 typedef struct {
     rule_t    rules[MAX_RULES];
+    stream_window_t peak[MAX_RULES];
+    stream_ewma_t   ewma[MAX_RULES];
+    float     peak_values[MAX_RULES][PEAK_WINDOW];
+    uint32_t  peak_min_q[MAX_RULES][PEAK_WINDOW];
+    uint32_t  peak_max_q[MAX_RULES][PEAK_WINDOW];
     lv_obj_t *lbl_status[MAX_RULES];
     lv_obj_t *indicator[MAX_RULES];
     lv_obj_t *lbl_value[MAX_RULES];
@@ -95,6 +108,15 @@ static float get_source_value(rule_source_t src)
     }
 }
 
+static float filter_value(auto_ctx_t *ctx, int i, float raw)
+{
+    if (ctx->rules[i].source == SOURCE_ACCEL_MAG) {
+        stream_window_push(&ctx->peak[i], raw);
+        return stream_window_max(&ctx->peak[i]);
+    }
+    return stream_ewma_push(&ctx->ewma[i], raw);
+}
+
 static bool evaluate_rule(rule_t *r, float value)
 {
     if (!r->active) return false;
@@ -123,7 +145,7 @@ static void timer_cb(lv_timer_t *t)
             continue;
         }
 
-        float val = get_source_value(r->source);
+        float val = filter_value(ctx, i, get_source_value(r->source));
         bool fired = evaluate_rule(r, val);
         r->triggered = fired;
 
@@ -236,6 +258,12 @@ void example_main(lv_obj_t *parent)
     /* Rule 4: Pressure < 990 hPa (low pressure/storm) */
     ctx.rules[3] = (rule_t){SOURCE_PRESSURE, OP_LESS, 990.0f, true, false};
 
+    for (int i = 0; i < MAX_RULES; i++) {
+        stream_window_init(&ctx.peak[i], ctx.peak_values[i], ctx.peak_min_q[i],
+                           ctx.peak_max_q[i], PEAK_WINDOW);
+        stream_ewma_init(&ctx.ewma[i], stream_ewma_alpha(UPDATE_MS / 1000.0f, EWMA_TAU_S));
+    }
+
     lv_obj_set_style_bg_color(parent, lv_color_hex(0x0D1B2A), 0);
     lv_obj_set_style_bg_opa(parent, LV_OPA_COVER, 0);
     lv_obj_set_flex_flow(parent, LV_FLEX_FLOW_COLUMN);
@@ -8,6 +8,10 @@
  *   buffer. Provides a reusable console_print() API for embedding in any
  *   project as a visual debug output.
  *
+ *   Output goes to a console_view widget: each line is added once with its
+ *   colored runs (level tag, timestamp, message) and only new lines are
+ *   redrawn, so logging hundreds of lines per second does not stall the UI.
+ *
  *   Log levels and colors:
  *     [I] INFO   - green   (0x4CAF50)
  *     [W] WARN   - orange  (0xFF9800)
@@ -21,11 +25,13 @@
 #include "pse84_common.h"
 #include "app_interface.h"
 #include "tesaiot_thai.h"
+#include "console_view.h"
 
 /* ── Configuration ─────────────────────────────────────────────────── */
 #define CONSOLE_MAX_LINES    50
 #define CONSOLE_LINE_LEN     80
 #define DEMO_INTERVAL_MS     500
+#define DEMO_LINES_PER_TICK  1     /* e.g. 50 for a 100 lines/s stress */
 
 /* ── Colors ────────────────────────────────────────────────────────── */
 #define COLOR_BG             lv_color_hex(0x0D1B2A)
@@ -35,6 +41,7 @@
 #define COLOR_WARN           lv_color_hex(0xFF9800)
 #define COLOR_ERROR          lv_color_hex(0xF44336)
 #define COLOR_DEBUG          lv_color_hex(0x808080)
+#define COLOR_TIME           lv_color_hex(0x6C7A89)
 
 /* ── Log level enum ────────────────────────────────────────────────── */
 typedef enum {
@@ -46,62 +53,19 @@ typedef enum {
 
 static const char *s_level_prefix[] = { "[I]", "[W]", "[E]", "[D]" };
 
-/* ── Ring buffer ───────────────────────────────────────────────────── */
-static char       s_lines[CONSOLE_MAX_LINES][CONSOLE_LINE_LEN];
-static log_level_t s_levels[CONSOLE_MAX_LINES];
-static uint16_t   s_head;        /* next write index           */
-static uint16_t   s_count;       /* lines currently stored     */
-
 /* ── UI handles ────────────────────────────────────────────────────── */
-static lv_obj_t  *s_console_ta;
+static lv_obj_t  *s_console;     /* console_view, owns the line ring */
 static lv_obj_t  *s_stats_label;
 static uint32_t   s_total_lines;
 
-/* ── Ring buffer helpers ───────────────────────────────────────────── */
-static void ring_push(log_level_t level, const char *text)
-{
-    strncpy(s_lines[s_head], text, CONSOLE_LINE_LEN - 1);
-    s_lines[s_head][CONSOLE_LINE_LEN - 1] = '\0';
-    s_levels[s_head] = level;
-    s_head = (s_head + 1) % CONSOLE_MAX_LINES;
-    if (s_count < CONSOLE_MAX_LINES) s_count++;
-    s_total_lines++;
-}
-
-/* ── Rebuild console display text ──────────────────────────────────── */
-static void rebuild_console_text(void)
+static lv_color_t level_color(log_level_t level)
 {
-    /* Build a single string from ring buffer for the textarea.
-     * Color is not per-character in lv_textarea, so we use level prefixes
-     * to indicate severity visually. */
-    static char buf[CONSOLE_MAX_LINES * CONSOLE_LINE_LEN];
-    buf[0] = '\0';
-
-    uint16_t start;
-    if (s_count < CONSOLE_MAX_LINES) {
-        start = 0;
-    } else {
-        start = s_head;  /* oldest entry */
-    }
-
-    for (uint16_t i = 0; i < s_count; i++) {
-        uint16_t idx = (start + i) % CONSOLE_MAX_LINES;
-        size_t cur_len = strlen(buf);
-        size_t remaining = sizeof(buf) - cur_len - 1;
-        if (remaining < CONSOLE_LINE_LEN + 2) break;
-
-        if (i > 0) {
-            buf[cur_len] = '\n';
-            cur_len++;
-            buf[cur_len] = '\0';
-        }
-        snprintf(buf + cur_len, remaining, "%s", s_lines[idx]);
+    switch (level) {
+    case LOG_WARN:  return COLOR_WARN;
+    case LOG_ERROR: return COLOR_ERROR;
+    case LOG_DEBUG: return COLOR_DEBUG;
+    default:        return COLOR_INFO;
     }
-
-    lv_textarea_set_text(s_console_ta, buf);
-
-    /* Auto-scroll to bottom */
-    lv_textarea_set_cursor_pos(s_console_ta, LV_TEXTAREA_CURSOR_LAST);
 }
 
 /* ── Public API: console_print ─────────────────────────────────────── */
@@ -124,21 +88,26 @@ static void console_print(log_level_t level, const char *fmt, ...)
     vsnprintf(line + prefix_len, sizeof(line) - prefix_len, fmt, args);
     va_end(args);
 
-    ring_push(level, line);
-    rebuild_console_text();
+    /* Runs: level tag, timestamp, message */
+    const console_view_run_t runs[] = {
+        { 3,                          level_color(level) },
+        { (uint16_t)(prefix_len - 3), COLOR_TIME },
+        { 0,                          COLOR_TEXT },
+    };
+    console_view_add_line(s_console, line, runs, 3);
+    s_total_lines++;
 
     /* Update stats */
     lv_label_set_text_fmt(s_stats_label, "Lines: %u / %u  |  Total: %u",
-                          (unsigned)s_count, CONSOLE_MAX_LINES,
-                          (unsigned)s_total_lines);
+                          (unsigned)console_view_get_line_count(s_console),
+                          CONSOLE_MAX_LINES, (unsigned)s_total_lines);
 }
 
 /* ── Demo timer: generate sample log messages ──────────────────────── */
 static uint32_t s_demo_tick;
 
-static void demo_timer_cb(lv_timer_t *timer)
+static void demo_print_one(void)
 {
-    (void)timer;
     s_demo_tick++;
 
     /* Cycle through different message types */
@@ -189,17 +158,20 @@ static void demo_timer_cb(lv_timer_t *timer)
     }
 }
 
+static void demo_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+    for (uint32_t i = 0; i < DEMO_LINES_PER_TICK; i++) demo_print_one();
+}
+
 /* ── Entry point ───────────────────────────────────────────────────── */
 void example_main(lv_obj_t *parent)
 {
     tesaiot_add_thai_support_badge();
 
     /* Reset state */
-    s_head        = 0;
-    s_count       = 0;
     s_total_lines = 0;
     s_demo_tick   = 0;
-    memset(s_lines, 0, sizeof(s_lines));
 
     lv_obj_set_style_bg_color(parent, COLOR_BG, 0);
 
@@ -223,21 +195,20 @@ void example_main(lv_obj_t *parent)
     lv_obj_set_style_text_color(legend, lv_color_hex(0x808080), 0);
     lv_obj_align(legend, LV_ALIGN_TOP_MID, 0, 32);
 
-    /* ── Console textarea ──────────────────────────────────────────── */
+    /* ── Console view ──────────────────────────────────────────────── */
     lv_obj_t *console_card = example_card_create(parent, 460, 320, COLOR_CARD);
     lv_obj_align(console_card, LV_ALIGN_TOP_MID, 0, 54);
     lv_obj_set_style_pad_all(console_card, 4, 0);
 
-    s_console_ta = lv_textarea_create(console_card);
-    lv_obj_set_size(s_console_ta, 448, 308);
-    lv_obj_center(s_console_ta);
-    lv_textarea_set_text(s_console_ta, "");
-    lv_obj_set_style_bg_color(s_console_ta, lv_color_hex(0x0A1628), 0);
-    lv_obj_set_style_text_color(s_console_ta, COLOR_TEXT, 0);
-    lv_obj_set_style_text_font(s_console_ta, &lv_font_montserrat_14, 0);
-    lv_obj_set_style_border_width(s_console_ta, 0, 0);
-    lv_obj_set_style_radius(s_console_ta, 4, 0);
-    lv_obj_remove_flag(s_console_ta, LV_OBJ_FLAG_CLICK_FOCUSABLE);
+    s_console = console_view_create(console_card, CONSOLE_MAX_LINES, CONSOLE_LINE_LEN);
+    lv_obj_set_size(s_console, 448, 308);
+    lv_obj_center(s_console);
+    lv_obj_set_style_bg_color(s_console, lv_color_hex(0x0A1628), 0);
+    lv_obj_set_style_text_color(s_console, COLOR_TEXT, 0);
+    lv_obj_set_style_text_font(s_console, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_border_width(s_console, 0, 0);
+    lv_obj_set_style_radius(s_console, 4, 0);
+    lv_obj_set_style_pad_all(s_console, 8, 0);
 
     /* ── Stats bar ─────────────────────────────────────────────────── */
     s_stats_label = lv_label_create(parent);
@@ -0,0 +1,369 @@
+/*******************************************************************************
+ * @file    sim_bench.c
+ * @brief   Headless benchmark runner — off-screen display, virtual lv_tick,
+ *          per-frame render/flush timing and a JSON report
+ ******************************************************************************/
+#include "sim_bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Per-frame timing state, filled by the display event hooks below */
+typedef struct
+{
+    uint64_t refr_start_ns;
+    uint64_t flush_ns;          /* flush time accumulated in this frame */
+    uint64_t flushed_px;        /* pixels copied in this frame */
+    bool     rendered;          /* LV_EVENT_RENDER_START seen in this frame */
+
+    double  *render_ms;         /* [capacity] */
+    double  *flush_ms;          /* [capacity] */
+    uint32_t count;
+    uint32_t capacity;
+    uint64_t total_flushed_px;
+} bench_stats_t;
+
+typedef struct
+{
+    double avg;
+    double p50;
+    double p95;
+    double p99;
+    double max;
+} bench_summary_t;
+
+static uint32_t       s_virtual_ms = 0;
+static bench_stats_t  s_stats;
+static uint8_t       *s_draw_mem = NULL;
+static uint8_t       *s_scanout = NULL;     /* stand-in for the window texture */
+static uint32_t       s_scanout_stride = 0;
+static FILE          *s_report_out = NULL;  /* original stdout */
+static uint64_t       s_ui_begin_ns = 0;    /* sim_bench_ui_begin() */
+static uint64_t       s_first_frame_ns = 0; /* end of the first rendered frame */
+static size_t         s_first_frame_heap = 0;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t virtual_tick_cb(void)
+{
+    return s_virtual_ms;
+}
+
+/* ── Off-screen display ───────────────────────────────── */
+
+static void bench_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    uint64_t t0 = now_ns();
+
+    /* DIRECT mode: px_map is the whole frame, copy only the flushed area
+     * into the scanout buffer — the same work the SDL driver does before
+     * uploading its texture. */
+    lv_draw_buf_t *buf = lv_display_get_buf_active(disp);
+    uint32_t bpp = lv_color_format_get_size(lv_display_get_color_format(disp));
+    uint32_t stride = buf->header.stride;
+    int32_t w = lv_area_get_width(area);
+
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(s_scanout + (size_t)y * s_scanout_stride + (size_t)area->x1 * bpp,
+               px_map + (size_t)y * stride + (size_t)area->x1 * bpp,
+               (size_t)w * bpp);
+    }
+
+    s_stats.flushed_px += (uint64_t)lv_area_get_size(area);
+    s_stats.flush_ns += now_ns() - t0;
+
+    lv_display_flush_ready(disp);
+}
+
+static void bench_refr_event_cb(lv_event_t *e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_REFR_START) {
+        s_stats.refr_start_ns = now_ns();
+        s_stats.flush_ns = 0;
+        s_stats.flushed_px = 0;
+        s_stats.rendered = false;
+    }
+    else if (code == LV_EVENT_RENDER_START) {
+        s_stats.rendered = true;
+    }
+    else if (code == LV_EVENT_REFR_READY) {
+        /* Refreshes with nothing invalidated are not frames */
+        if (!s_stats.rendered || s_stats.count >= s_stats.capacity) return;
+
+        uint64_t total_ns = now_ns() - s_stats.refr_start_ns;
+        uint64_t render_ns = total_ns > s_stats.flush_ns ? total_ns - s_stats.flush_ns : 0;
+
+        s_stats.render_ms[s_stats.count] = (double)render_ns / 1e6;
+        s_stats.flush_ms[s_stats.count] = (double)s_stats.flush_ns / 1e6;
+        s_stats.total_flushed_px += s_stats.flushed_px;
+        if (s_stats.count == 0) {
+            lv_mem_monitor_t mon;
+            lv_mem_monitor(&mon);
+            s_first_frame_ns = now_ns();
+            s_first_frame_heap = mon.total_size - mon.free_size;
+        }
+        s_stats.count++;
+    }
+}
+
+void sim_bench_capture_stdout(void)
+{
+    /* Keep a private handle on the real stdout for the report, then point
+     * fd 1 at stderr so LV_LOG_PRINTF and example printf()s stay out of it. */
+    int fd = dup(STDOUT_FILENO);
+    if (fd >= 0) s_report_out = fdopen(fd, "w");
+    fflush(stdout);
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+}
+
+static uint32_t count_objs(const lv_obj_t *obj)
+{
+    uint32_t n = 1;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < child_cnt; i++) n += count_objs(lv_obj_get_child(obj, (int32_t)i));
+    return n;
+}
+
+/* Size the frame buffer and scanout for the current resolution. Called
+ * again when an example resizes the display, like the SDL window does. */
+static void bench_buffers_alloc(lv_display_t *disp)
+{
+    int32_t w = lv_display_get_horizontal_resolution(disp);
+    int32_t h = lv_display_get_vertical_resolution(disp);
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+
+    /* Frame buffers live on the system heap, not in the LV_MEM_SIZE pool */
+    uint32_t stride = lv_draw_buf_width_to_stride((uint32_t)w, cf);
+    uint32_t buf_size = stride * (uint32_t)h;
+    free(s_draw_mem);
+    s_draw_mem = malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    LV_ASSERT_MALLOC(s_draw_mem);
+    lv_display_set_buffers(disp, lv_draw_buf_align(s_draw_mem, cf), NULL, buf_size,
+                           LV_DISPLAY_RENDER_MODE_DIRECT);
+
+    s_scanout_stride = (uint32_t)w * lv_color_format_get_size(cf);
+    free(s_scanout);
+    s_scanout = calloc((size_t)h, s_scanout_stride);
+    LV_ASSERT_MALLOC(s_scanout);
+}
+
+static void bench_res_chg_event_cb(lv_event_t *e)
+{
+    bench_buffers_alloc(lv_event_get_current_target(e));
+}
+
+lv_display_t *sim_bench_display_create(int32_t w, int32_t h)
+{
+    lv_tick_set_cb(virtual_tick_cb);
+    lv_group_set_default(lv_group_create());
+
+    lv_display_t *disp = lv_display_create(w, h);
+    bench_buffers_alloc(disp);
+    lv_display_set_flush_cb(disp, bench_flush_cb);
+
+    lv_display_add_event_cb(disp, bench_refr_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, bench_refr_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, bench_refr_event_cb, LV_EVENT_REFR_READY, NULL);
+    lv_display_add_event_cb(disp, bench_res_chg_event_cb, LV_EVENT_RESOLUTION_CHANGED, NULL);
+
+    lv_display_set_default(disp);
+    return disp;
+}
+
+void sim_bench_ui_begin(void)
+{
+    s_ui_begin_ns = now_ns();
+}
+
+/* ── Argument parsing ─────────────────────────────────── */
+
+static void print_usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [--draw-tiles=N] [--loop-stats[=SEC]] [--replay=FILE [--replay-speed=X]] [--headless [--frames=N] [--period=MS] [--full-refresh] [--report=FILE]]\n",
+            prog);
+}
+
+static bool parse_u32(const char *s, uint32_t *out)
+{
+    char *end = NULL;
+    unsigned long v = strtoul(s, &end, 10);
+    if (end == s || *end != '\0' || v == 0 || v > UINT32_MAX) return false;
+    *out = (uint32_t)v;
+    return true;
+}
+
+bool sim_bench_parse_args(int argc, char **argv, sim_bench_config_t *cfg)
+{
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->frames = SIM_BENCH_DEFAULT_FRAMES;
+    cfg->period_ms = SIM_BENCH_DEFAULT_PERIOD_MS;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool ok = true;
+
+        if (strcmp(arg, "--headless") == 0) {
+            cfg->enabled = true;
+        }
+        else if (strncmp(arg, "--frames=", 9) == 0) {
+            ok = parse_u32(arg + 9, &cfg->frames);
+        }
+        else if (strncmp(arg, "--period=", 9) == 0) {
+            ok = parse_u32(arg + 9, &cfg->period_ms);
+        }
+        else if (strcmp(arg, "--full-refresh") == 0) {
+            cfg->full_refresh = true;
+        }
+        else if (strncmp(arg, "--report=", 9) == 0) {
+            cfg->report_path = arg + 9;
+        }
+
+        if (!ok) {
+            fprintf(stderr, "invalid option: %s\n", arg);
+            print_usage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+/* ── Statistics + report ──────────────────────────────── */
+
+static int cmp_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+/* Nearest-rank percentile on a sorted array */
+static double percentile(const double *sorted, uint32_t n, double p)
+{
+    if (n == 0) return 0.0;
+    uint32_t rank = (uint32_t)(p / 100.0 * (double)n + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    return sorted[rank - 1];
+}
+
+static bench_summary_t summarize(double *v, uint32_t n)
+{
+    bench_summary_t s = {0};
+    if (n == 0) return s;
+
+    double sum = 0.0;
+    for (uint32_t i = 0; i < n; i++) sum += v[i];
+
+    qsort(v, n, sizeof(double), cmp_double);
+    s.avg = sum / (double)n;
+    s.p50 = percentile(v, n, 50.0);
+    s.p95 = percentile(v, n, 95.0);
+    s.p99 = percentile(v, n, 99.0);
+    s.max = v[n - 1];
+    return s;
+}
+
+static void write_summary(FILE *f, const char *name, const bench_summary_t *s)
+{
+    fprintf(f, "  \"%s\": {\"avg\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f}",
+            name, s->avg, s->p50, s->p95, s->p99, s->max);
+}
+
+static const char *base_name(const char *path)
+{
+    const char *b = path;
+    for (const char *p = path; *p; p++) {
+        if (*p == '/' || *p == '\\') b = p + 1;
+    }
+    return b;
+}
+
+int sim_bench_run(const sim_bench_config_t *cfg, const char *target)
+{
+    lv_display_t *disp = lv_display_get_default();
+
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.capacity = cfg->frames;
+    s_stats.render_ms = calloc(cfg->frames, sizeof(double));
+    s_stats.flush_ms = calloc(cfg->frames, sizeof(double));
+    if (!s_stats.render_ms || !s_stats.flush_ms) {
+        fprintf(stderr, "sim_bench: out of memory for %u frames\n", (unsigned)cfg->frames);
+        return EXIT_FAILURE;
+    }
+
+    uint64_t t0 = now_ns();
+    if (s_ui_begin_ns == 0) s_ui_begin_ns = t0;
+    double build_ms = (double)(t0 - s_ui_begin_ns) / 1e6;
+
+    for (uint32_t i = 0; i < cfg->frames; i++) {
+        if (cfg->full_refresh) {
+            lv_lock();
+            lv_obj_invalidate(lv_screen_active());
+            lv_unlock();
+        }
+        s_virtual_ms += cfg->period_ms;
+        lv_timer_handler();
+    }
+    double wall_ms = (double)(now_ns() - t0) / 1e6;
+
+    uint32_t rendered = s_stats.count;
+    bench_summary_t render = summarize(s_stats.render_ms, rendered);
+    bench_summary_t flush = summarize(s_stats.flush_ms, rendered);
+    double wall_s = wall_ms / 1000.0;
+    double ttff_ms = rendered ? (double)(s_first_frame_ns - s_ui_begin_ns) / 1e6 : 0.0;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+
+    FILE *f = s_report_out ? s_report_out : stdout;
+    if (cfg->report_path) {
+        f = fopen(cfg->report_path, "w");
+        if (!f) {
+            fprintf(stderr, "sim_bench: cannot open %s\n", cfg->report_path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"target\": \"%s\",\n", base_name(target));
+    fprintf(f, "  \"resolution\": [%d, %d],\n",
+            (int)lv_display_get_horizontal_resolution(disp),
+            (int)lv_display_get_vertical_resolution(disp));
+    fprintf(f, "  \"frames\": %u,\n", (unsigned)cfg->frames);
+    fprintf(f, "  \"rendered_frames\": %u,\n", (unsigned)rendered);
+    fprintf(f, "  \"draw_units\": %u,\n", (unsigned)LV_DRAW_SW_DRAW_UNIT_CNT);
+    fprintf(f, "  \"draw_tiles\": %u,\n", (unsigned)lv_display_get_tile_cnt(disp));
+    fprintf(f, "  \"period_ms\": %u,\n", (unsigned)cfg->period_ms);
+    fprintf(f, "  \"full_refresh\": %s,\n", cfg->full_refresh ? "true" : "false");
+    fprintf(f, "  \"wall_ms\": %.3f,\n", wall_ms);
+    fprintf(f, "  \"fps\": %.2f,\n", wall_s > 0.0 ? (double)rendered / wall_s : 0.0);
+    fprintf(f, "  \"loop_hz\": %.2f,\n", wall_s > 0.0 ? (double)cfg->frames / wall_s : 0.0);
+    fprintf(f, "  \"flushed_px\": %llu,\n", (unsigned long long)s_stats.total_flushed_px);
+    fprintf(f, "  \"objects\": %u,\n", (unsigned)count_objs(lv_screen_active()));
+    fprintf(f, "  \"build_ms\": %.3f,\n", build_ms);
+    fprintf(f, "  \"ttff_ms\": %.3f,\n", ttff_ms);
+    fprintf(f, "  \"heap\": {\"first_frame\": %zu, \"end\": %zu, \"peak\": %zu, \"size\": %zu},\n",
+            s_first_frame_heap, mon.total_size - mon.free_size, mon.max_used, mon.total_size);
+    write_summary(f, "render_ms", &render);
+    fprintf(f, ",\n");
+    write_summary(f, "flush_ms", &flush);
+    fprintf(f, "\n}\n");
+
+    if (cfg->report_path) fclose(f);
+    else fflush(f);
+
+    free(s_stats.render_ms);
+    free(s_stats.flush_ms);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * @file    sim_bench.h
+ * @brief   Headless benchmark runner for the TESAIoT simulator launcher
+ *
+ * Runs any example against an off-screen draw buffer instead of an SDL
+ * window. lv_tick is driven from a virtual clock that advances one refresh
+ * period per frame, so timers/animations behave exactly as on screen while
+ * frames are rendered as fast as the host allows.
+ *
+ * Usage:  bin/<example> --headless [--frames=N] [--period=MS]
+ *                                  [--full-refresh] [--report=FILE]
+ ******************************************************************************/
+#ifndef SIM_BENCH_H
+#define SIM_BENCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+#define SIM_BENCH_DEFAULT_FRAMES      (600U)
+#define SIM_BENCH_DEFAULT_PERIOD_MS   (LV_DEF_REFR_PERIOD)
+
+typedef struct
+{
+    bool        enabled;        /* --headless */
+    uint32_t    frames;         /* --frames=N   : refresh periods to run */
+    uint32_t    period_ms;      /* --period=MS  : virtual time per frame */
+    bool        full_refresh;   /* --full-refresh : invalidate screen each frame */
+    const char *report_path;    /* --report=FILE : JSON report (default stdout) */
+} sim_bench_config_t;
+
+/* Parse launcher arguments. Unknown arguments are ignored.
+ * Returns false (and prints usage) on a malformed benchmark option. */
+bool sim_bench_parse_args(int argc, char **argv, sim_bench_config_t *cfg);
+
+/* Redirect stdout to stderr so stdout carries only the report (LVGL
+ * logs and example printf()s end up on stderr). Call before lv_init(). */
+void sim_bench_capture_stdout(void);
+
+/* Create an off-screen display (no SDL window, no input devices) and
+ * install the virtual tick source. Call after lv_init(). */
+lv_display_t *sim_bench_display_create(int32_t w, int32_t h);
+
+/* Mark the start of UI construction (just before example_main()).
+ * The report's build_ms and ttff_ms (time to first frame) count from here;
+ * heap figures are LVGL heap bytes (lv_mem_monitor). */
+void sim_bench_ui_begin(void);
+
+/* Render cfg->frames frames and write the JSON report.
+ * @param target  executable name recorded in the report
+ * @return process exit code */
+int sim_bench_run(const sim_bench_config_t *cfg, const char *target);
+
+#endif /* SIM_BENCH_H */
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * @file    sim_loop.c
+ * @brief   Event-driven main loop — SDL_WaitEventTimeout() on the delay from
+ *          lv_timer_handler(), early wake-up on input / new LVGL work,
+ *          idle % and wakeups/s report
+ ******************************************************************************/
+#include "sim_loop.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl.h"
+#include LV_SDL_INCLUDE_PATH
+
+/* Counters of the current report window */
+typedef struct
+{
+    uint64_t window_start;      /* performance counter */
+    uint64_t idle;              /* performance counter ticks spent waiting */
+    uint32_t wakeups;           /* every return from the wait */
+    uint32_t event_wakeups;     /* ... of which had an SDL event pending */
+} loop_stats_t;
+
+static uint32_t      s_wake_event = (uint32_t)-1;
+static SDL_atomic_t  s_wake_pending;
+static volatile bool s_running = false;     /* inside the LVGL part of the loop */
+static loop_stats_t  s_stats;
+
+/* ── Wake-up from LVGL ────────────────────────────────── */
+
+/*
+ * lv_timer calls this whenever a timer becomes ready earlier than the delay
+ * lv_timer_handler() returned: lv_timer_ready(), lv_timer_resume(), a new
+ * timer, or an invalidation that resumes a display's refresh timer.
+ * While the loop runs LVGL itself the handler picks that up anyway; while it
+ * waits, push one user event so SDL_WaitEventTimeout() returns.
+ * Other threads only get here with lv_lock() held, i.e. never concurrently
+ * with lv_timer_handler().
+ */
+static void timer_resume_cb(void *data)
+{
+    (void)data;
+    if (s_running) return;
+
+    if (SDL_AtomicCAS(&s_wake_pending, 0, 1)) {
+        SDL_Event ev;
+        SDL_zero(ev);
+        ev.type = s_wake_event;
+        SDL_PushEvent(&ev);
+    }
+}
+
+/* ── Statistics ───────────────────────────────────────── */
+
+static void stats_report(const sim_loop_config_t *cfg, uint64_t now)
+{
+    uint64_t freq = SDL_GetPerformanceFrequency();
+    uint64_t window = now - s_stats.window_start;
+    if (window * 1000U < (uint64_t)cfg->stats_period_ms * freq) return;
+
+    double sec = (double)window / (double)freq;
+    printf("[loop] %.1f s: idle %.1f %%, %.1f wakeups/s (%u on events), lv_timer idle %u %%\n",
+           sec, 100.0 * (double)s_stats.idle / (double)window,
+           (double)s_stats.wakeups / sec, (unsigned)s_stats.event_wakeups,
+           (unsigned)lv_timer_get_idle());
+    fflush(stdout);
+
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.window_start = now;
+}
+
+/* Longest wait that still lets the next report go out on time */
+static uint32_t stats_wait_limit(const sim_loop_config_t *cfg, uint64_t now)
+{
+    uint64_t freq = SDL_GetPerformanceFrequency();
+    uint64_t elapsed_ms = (now - s_stats.window_start) * 1000U / freq;
+    return elapsed_ms >= cfg->stats_period_ms ? 0 : cfg->stats_period_ms - (uint32_t)elapsed_ms;
+}
+
+/* ── Argument parsing ─────────────────────────────────── */
+
+bool sim_loop_parse_args(int argc, char **argv, sim_loop_config_t *cfg)
+{
+    memset(cfg, 0, sizeof(*cfg));
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+
+        if (strcmp(arg, "--loop-stats") == 0) {
+            cfg->stats_period_ms = SIM_LOOP_DEFAULT_STATS_SEC * 1000U;
+        }
+        else if (strncmp(arg, "--loop-stats=", 13) == 0) {
+            char *end = NULL;
+            unsigned long sec = strtoul(arg + 13, &end, 10);
+            if (end == arg + 13 || *end != '\0' || sec == 0 || sec > 3600) {
+                fprintf(stderr, "invalid option: %s\n", arg);
+                fprintf(stderr, "usage: %s [--loop-stats[=SEC]]  (1..3600 s)\n", argv[0]);
+                return false;
+            }
+            cfg->stats_period_ms = (uint32_t)sec * 1000U;
+        }
+    }
+    return true;
+}
+
+/* ── Main loop ────────────────────────────────────────── */
+
+void sim_loop_run(const sim_loop_config_t *cfg)
+{
+    s_wake_event = SDL_RegisterEvents(1);
+    SDL_AtomicSet(&s_wake_pending, 0);
+
+    /* Input is handled on wake-up below, not by the driver's 5 ms poll timer */
+    lv_lock();
+    lv_sdl_set_event_polling(false);
+    lv_timer_handler_set_resume_cb(timer_resume_cb, NULL);
+    lv_unlock();
+
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.window_start = SDL_GetPerformanceCounter();
+
+    while (1) {
+        s_running = true;
+        lv_lock();
+        lv_sdl_handle_events();
+        lv_unlock();
+        lv_timer_handler();
+        s_running = false;
+
+        /* Re-read after leaving the LVGL part: if another thread made a
+         * timer ready in between, the resume callback did not push a wake
+         * event but the delay is already 0 */
+        uint32_t wait_ms = lv_timer_get_time_until_next();
+
+        uint64_t t0 = SDL_GetPerformanceCounter();
+        if (cfg->stats_period_ms) {
+            stats_report(cfg, t0);
+            uint32_t limit = stats_wait_limit(cfg, t0);
+            if (wait_ms > limit) wait_ms = limit;
+        }
+
+        int has_event;
+        if (wait_ms == LV_NO_TIMER_READY) {
+            has_event = SDL_WaitEvent(NULL);
+        }
+        else {
+            /* NULL: only wait, lv_sdl_handle_events() consumes the event */
+            has_event = SDL_WaitEventTimeout(NULL, wait_ms > INT32_MAX ? INT32_MAX : (int)wait_ms);
+        }
+        SDL_AtomicSet(&s_wake_pending, 0);
+
+        s_stats.idle += SDL_GetPerformanceCounter() - t0;
+        s_stats.wakeups++;
+        if (has_event) s_stats.event_wakeups++;
+    }
+}
@@ -0,0 +1,36 @@
+/*******************************************************************************
+ * @file    sim_loop.h
+ * @brief   Event-driven main loop for the TESAIoT simulator launcher
+ *
+ * Instead of calling lv_timer_handler() and sleeping a fixed time, the loop
+ * blocks in SDL_WaitEventTimeout() for exactly the delay returned by
+ * lv_timer_handler(). It wakes early on SDL input/window events and when
+ * LVGL gets new work (lv_timer_ready(), a resumed/created timer or an
+ * invalidated area — all of them go through the lv_timer resume callback).
+ * A static screen therefore costs (almost) no CPU.
+ *
+ * Usage:  bin/<example> [--loop-stats[=SEC]]
+ *         prints idle percentage and wakeups per second every SEC seconds
+ ******************************************************************************/
+#ifndef SIM_LOOP_H
+#define SIM_LOOP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SIM_LOOP_DEFAULT_STATS_SEC    (5U)
+
+typedef struct
+{
+    uint32_t    stats_period_ms;    /* --loop-stats[=SEC] : 0 = no report */
+} sim_loop_config_t;
+
+/* Parse launcher arguments. Unknown arguments are ignored.
+ * Returns false (and prints usage) on a malformed loop option. */
+bool sim_loop_parse_args(int argc, char **argv, sim_loop_config_t *cfg);
+
+/* Run the LVGL/SDL loop. Call after sdl_hal_init() without lv_lock() held.
+ * Does not return; closing the window exits the process. */
+void sim_loop_run(const sim_loop_config_t *cfg);
+
+#endif /* SIM_LOOP_H */
@@ -3,33 +3,169 @@
  *
  * Initializes LVGL + SDL2 display, then calls example_main() which is
  * defined in the linked example's main_example.c.
+ *
+ * With --headless the SDL window is replaced by an off-screen display and
+ * the example is benchmarked for a fixed number of frames (see sim_bench.h).
+ *
+ * Threading: with SIM_DRAW_THREADS (CMake, default ON) LVGL runs with
+ * LV_OS_PTHREAD and one software draw unit per host core. Only the draw
+ * threads run in parallel; lv_timer_handler() holds lv_lock() while it runs,
+ * so every lv_timer callback (mic_presenter, sensorhub_presenter, ...) still
+ * executes on this thread, one at a time. Code that touches LVGL from any
+ * other thread must wrap the calls in lv_lock()/lv_unlock().
+ *
+ * --draw-tiles=N  splits each refresh into N horizontal tiles rendered in
+ *                 parallel (default: online cores). N must be a positive
+ *                 integer; it is clamped to LV_DRAW_SW_DRAW_UNIT_CNT.
+ *
+ * The window loop sleeps in SDL_WaitEventTimeout() until the next LVGL timer
+ * is due or input arrives (see sim_loop.h); --loop-stats[=SEC] reports the
+ * idle percentage and wakeups per second.
+ *
+ * --replay=FILE         serve a recorded sensor capture (.bin or .csv) from
+ *                       the mock *_reader_poll() instead of sine waves
+ * --replay-speed=X      replay X times faster than recorded (default 1)
+ * --replay-export=OUT   convert the capture to the binary format and exit
  */
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include "lvgl.h"
 #include "hal/hal.h"
 #include "tesaiot/app_interface.h"
+#include "sim_bench.h"
+#include "sim_loop.h"
+#include "mock_sensors/sensor_replay.h"
 
 #define DISP_HOR_RES 800
 #define DISP_VER_RES 480
 
+/* --draw-tiles=N. 0 (option absent) means auto. Values above the draw units
+ * compiled in are clamped: more tiles than units cannot render in parallel. */
+static bool parse_draw_tiles(int argc, char **argv, uint32_t *tiles)
+{
+    *tiles = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strncmp(arg, "--draw-tiles=", 13) != 0) continue;
+
+        /* strtoul() would accept "-1", " 4" and "+4": require plain digits */
+        const char *val = arg + 13;
+        char *end = NULL;
+        unsigned long n = (*val >= '0' && *val <= '9') ? strtoul(val, &end, 10) : 0;
+        if (n == 0 || *end != '\0') {
+            fprintf(stderr, "invalid option: %s\n", arg);
+            fprintf(stderr, "usage: %s [--draw-tiles=N]  (1..%d)\n", argv[0], LV_DRAW_SW_DRAW_UNIT_CNT);
+            return false;
+        }
+        if (n > LV_DRAW_SW_DRAW_UNIT_CNT) {
+            fprintf(stderr, "--draw-tiles=%lu clamped to %d (draw units)\n", n, LV_DRAW_SW_DRAW_UNIT_CNT);
+            n = LV_DRAW_SW_DRAW_UNIT_CNT;
+        }
+        *tiles = (uint32_t)n;
+    }
+    return true;
+}
+
+/* One tile per online core, never more than the draw units compiled in */
+static void setup_draw_tiles(lv_display_t *disp, uint32_t requested)
+{
+#if LV_USE_OS != LV_OS_NONE && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+#if defined(_SC_NPROCESSORS_ONLN)
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+#else
+    long cores = LV_DRAW_SW_DRAW_UNIT_CNT;     /* no sysconf() on MinGW */
+#endif
+    uint32_t tiles = requested ? requested : (cores > 0 ? (uint32_t)cores : 1U);
+    if (tiles > LV_DRAW_SW_DRAW_UNIT_CNT) tiles = LV_DRAW_SW_DRAW_UNIT_CNT;
+    lv_display_set_tile_cnt(disp, tiles);
+#else
+    (void)disp;
+    (void)requested;
+#endif
+}
+
+/* Load the capture given with --replay. Returns 1 to continue, 0 to exit
+ * successfully (--replay-export done), -1 on error. */
+static int setup_replay(int argc, char **argv)
+{
+    const char *path = NULL;
+    const char *export_path = NULL;
+    float speed = 1.0f;
+
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--replay=", 9) == 0) {
+            path = argv[i] + 9;
+        }
+        else if (strncmp(argv[i], "--replay-speed=", 15) == 0) {
+            char *end = NULL;
+            speed = strtof(argv[i] + 15, &end);
+            if (end == argv[i] + 15 || *end != '\0' || !(speed > 0.0f)) {
+                fprintf(stderr, "invalid option: %s\n", argv[i]);
+                return -1;
+            }
+        }
+        else if (strncmp(argv[i], "--replay-export=", 16) == 0) {
+            export_path = argv[i] + 16;
+        }
+    }
+
+    if (!path) return 1;
+    if (!sensor_replay_open(path)) return -1;
+    if (export_path) return sensor_replay_save(export_path) ? 0 : -1;
+
+    sensor_replay_set_speed(speed);
+    return 1;
+}
+
 int main(int argc, char **argv)
 {
-    (void)argc;
-    (void)argv;
+    sim_bench_config_t bench;
+    sim_loop_config_t loop;
+    uint32_t draw_tiles;
+    if (!sim_bench_parse_args(argc, argv, &bench) ||
+        !sim_loop_parse_args(argc, argv, &loop) ||
+        !parse_draw_tiles(argc, argv, &draw_tiles)) {
+        return EXIT_FAILURE;
+    }
+
+    if (bench.enabled) {
+        sim_bench_capture_stdout();
+    }
+
+    int replay = setup_replay(argc, argv);
+    if (replay <= 0) {
+        return replay == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
 
     lv_init();
-    sdl_hal_init(DISP_HOR_RES, DISP_VER_RES);
+
+    /* The draw threads are already running: build the UI under the lock */
+    lv_lock();
+
+    if (bench.enabled) {
+        lv_display_t *disp = sim_bench_display_create(DISP_HOR_RES, DISP_VER_RES);
+        setup_draw_tiles(disp, draw_tiles);
+        sim_bench_ui_begin();
+        example_main(lv_screen_active());
+        lv_unlock();
+        return sim_bench_run(&bench, argv[0]);
+    }
+
+    lv_display_t *disp = sdl_hal_init(DISP_HOR_RES, DISP_VER_RES);
+    setup_draw_tiles(disp, draw_tiles);
 
     /* Call the example entry point — identical to firmware contract */
     example_main(lv_screen_active());
 
-    /* Run LVGL event loop */
-    while (1) {
-        uint32_t time_till_next = lv_timer_handler();
-        usleep((time_till_next > 0 ? time_till_next : 5) * 1000);
-    }
+    lv_unlock();
+
+    /* Run LVGL event loop. lv_timer_handler() takes lv_lock() itself, so the
+     * lock is free while this thread sleeps. */
+    sim_loop_run(&loop);
 
     return 0;
 }
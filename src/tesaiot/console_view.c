@@ -0,0 +1,291 @@
+/*******************************************************************************
+ * @file    console_view.c
+ * @brief   Terminal-style console widget — colored single-line log output
+ ******************************************************************************/
+#include "console_view.h"
+
+#include <string.h>
+
+typedef struct {
+    uint16_t start;         /* byte offset in the line */
+    uint16_t len;
+    int32_t x;              /* from the left content edge */
+    int32_t w;
+    lv_color_t color;
+} cv_run_t;
+
+typedef struct {
+    cv_run_t runs[CONSOLE_VIEW_RUN_MAX];
+    uint8_t run_cnt;
+} cv_line_t;
+
+typedef struct {
+    char *text;             /* max_lines * line_len */
+    cv_line_t *lines;
+    uint16_t max_lines;
+    uint16_t line_len;
+    uint32_t count;
+    uint32_t next_seq;      /* seq of the next line */
+
+    /* Lines added since the last frame, applied at the next refresh */
+    lv_display_t *disp;
+    bool sync_pending;
+    bool follow;            /* was at the bottom before those lines */
+    uint32_t added;
+    uint32_t dropped;       /* lines dropped from the top since */
+} console_view_t;
+
+/* ── Helpers ───────────────────────────────────────────── */
+
+static uint32_t cv_slot(const console_view_t *cv, uint32_t idx)
+{
+    return (cv->next_seq - cv->count + idx) % cv->max_lines;
+}
+
+static int32_t cv_line_height(lv_obj_t *obj)
+{
+    const lv_font_t *font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    return lv_font_get_line_height(font) + lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+}
+
+/* Measure the runs of one line; done once per line, not per frame */
+static void cv_layout_line(lv_obj_t *obj, console_view_t *cv, uint32_t slot)
+{
+    const lv_font_t *font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    char *text = &cv->text[slot * cv->line_len];
+    cv_line_t *line = &cv->lines[slot];
+    int32_t x = 0;
+
+    for (uint8_t r = 0; r < line->run_cnt; r++) {
+        cv_run_t *run = &line->runs[r];
+        char *end = &text[run->start + run->len];
+        char saved = *end;
+        lv_point_t size;
+
+        *end = '\0';
+        lv_text_get_size(&size, &text[run->start], font, letter_space, 0,
+                         LV_COORD_MAX, LV_TEXT_FLAG_EXPAND);
+        *end = saved;
+        run->x = x;
+        run->w = size.x;
+        x += size.x + letter_space;
+    }
+}
+
+static void cv_invalidate_lines(lv_obj_t *obj, uint32_t first, uint32_t end)
+{
+    int32_t lh = cv_line_height(obj);
+    lv_area_t a;
+
+    lv_obj_get_coords(obj, &a);
+    int32_t y0 = a.y1 + lv_obj_get_style_space_top(obj, LV_PART_MAIN) - lv_obj_get_scroll_y(obj);
+    a.y1 = y0 + (int32_t)first * lh;
+    a.y2 = y0 + (int32_t)end * lh - 1;
+    lv_obj_invalidate_area(obj, &a);
+}
+
+/* ── Events ────────────────────────────────────────────── */
+
+/* One scroll or one invalidation per frame, however many lines came in */
+static void console_view_refr_start_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_user_data(e);
+    console_view_t *cv = lv_obj_get_user_data(obj);
+
+    if (!cv->sync_pending) return;
+    cv->sync_pending = false;
+
+    int32_t scroll_y = lv_obj_get_scroll_y(obj);
+    if (cv->follow) {
+        lv_obj_scroll_to_y(obj, LV_COORD_MAX, LV_ANIM_OFF);
+    } else if (cv->dropped > 0U) {
+        /* The lines in view moved up; move the view with them, but not past
+         * the top: once they are gone the oldest line left stays at the top */
+        int32_t dy = LV_MIN((int32_t)cv->dropped * cv_line_height(obj), scroll_y);
+        if (dy > 0) lv_obj_scroll_by(obj, 0, dy, LV_ANIM_OFF);
+    }
+
+    /* A scroll redraws the whole view by itself */
+    if (lv_obj_get_scroll_y(obj) == scroll_y) {
+        if (cv->dropped > 0U) {
+            lv_obj_invalidate(obj);
+        } else {
+            cv_invalidate_lines(obj, cv->count - LV_MIN(cv->added, cv->count), cv->count);
+        }
+    }
+    lv_obj_scrollbar_invalidate(obj);
+    cv->added = 0U;
+    cv->dropped = 0U;
+}
+
+static void console_view_draw_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    lv_layer_t *layer = lv_event_get_layer(e);
+    console_view_t *cv = lv_obj_get_user_data(obj);
+    if (cv->count == 0U) return;
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    int32_t lh = cv_line_height(obj);
+    int32_t x0 = coords.x1 + lv_obj_get_style_space_left(obj, LV_PART_MAIN);
+    int32_t y0 = coords.y1 + lv_obj_get_style_space_top(obj, LV_PART_MAIN) -
+                 lv_obj_get_scroll_y(obj);
+
+    /* Text stays inside the content box */
+    const lv_area_t clip_ori = layer->_clip_area;
+    lv_area_t clip = {
+        LV_MAX(clip_ori.x1, x0),
+        LV_MAX(clip_ori.y1, coords.y1 + lv_obj_get_style_space_top(obj, LV_PART_MAIN)),
+        LV_MIN(clip_ori.x2, coords.x2 - lv_obj_get_style_space_right(obj, LV_PART_MAIN)),
+        LV_MIN(clip_ori.y2, coords.y2 - lv_obj_get_style_space_bottom(obj, LV_PART_MAIN)),
+    };
+    if (clip.x1 > clip.x2 || clip.y1 > clip.y2) return;
+
+    int32_t first = LV_MAX((clip.y1 - y0) / lh, 0);
+    int32_t last = LV_MIN((clip.y2 - y0) / lh, (int32_t)cv->count - 1);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &dsc);
+    dsc.flag = LV_TEXT_FLAG_EXPAND;
+
+    layer->_clip_area = clip;
+    for (int32_t i = first; i <= last; i++) {
+        uint32_t slot = cv_slot(cv, (uint32_t)i);
+        const cv_line_t *line = &cv->lines[slot];
+        const char *text = &cv->text[slot * cv->line_len];
+        int32_t y = y0 + i * lh;
+
+        for (uint8_t r = 0; r < line->run_cnt; r++) {
+            const cv_run_t *run = &line->runs[r];
+            if (x0 + run->x > clip.x2) break;
+
+            lv_area_t a = {x0 + run->x, y, x0 + run->x + run->w - 1, y + lh - 1};
+            dsc.text = &text[run->start];
+            dsc.text_length = run->len;
+            dsc.color = run->color;
+            lv_draw_label(layer, &dsc, &a);
+        }
+    }
+    layer->_clip_area = clip_ori;
+}
+
+static void console_view_event_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    console_view_t *cv = lv_obj_get_user_data(obj);
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_GET_SELF_SIZE) {
+        lv_point_t *p = lv_event_get_param(e);
+        p->y = LV_MAX(p->y, (int32_t)cv->count * cv_line_height(obj));
+    } else if (code == LV_EVENT_STYLE_CHANGED) {
+        /* The font may have changed: measure again */
+        for (uint32_t i = 0; i < cv->count; i++) cv_layout_line(obj, cv, cv_slot(cv, i));
+    } else if (code == LV_EVENT_DELETE) {
+        lv_display_remove_event_cb_with_user_data(cv->disp, console_view_refr_start_cb, obj);
+        lv_free(cv->text);
+        lv_free(cv->lines);
+        lv_free(cv);
+    }
+}
+
+/* ── Public API ────────────────────────────────────────── */
+
+lv_obj_t *console_view_create(lv_obj_t *parent, uint16_t max_lines, uint16_t line_len)
+{
+    console_view_t *cv = lv_malloc_zeroed(sizeof(*cv));
+    LV_ASSERT_MALLOC(cv);
+    cv->max_lines = LV_MAX(max_lines, 1);
+    cv->line_len = LV_MAX(line_len, 2);
+    cv->text = lv_malloc_zeroed((size_t)cv->max_lines * cv->line_len);
+    cv->lines = lv_malloc_zeroed(sizeof(cv_line_t) * cv->max_lines);
+    LV_ASSERT_MALLOC(cv->text);
+    LV_ASSERT_MALLOC(cv->lines);
+
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_set_scroll_dir(obj, LV_DIR_VER);
+    lv_obj_set_user_data(obj, cv);
+    lv_obj_add_event_cb(obj, console_view_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(obj, console_view_event_cb, LV_EVENT_ALL, NULL);
+
+    cv->disp = lv_obj_get_display(obj);
+    lv_display_add_event_cb(cv->disp, console_view_refr_start_cb, LV_EVENT_REFR_START, obj);
+    return obj;
+}
+
+void console_view_add_line(lv_obj_t *obj, const char *text,
+                           const console_view_run_t *runs, uint8_t run_cnt)
+{
+    console_view_t *cv = lv_obj_get_user_data(obj);
+    if (cv == NULL || text == NULL) return;
+
+    if (!cv->sync_pending) {
+        /* Within half a line of the bottom: keep following */
+        cv->follow = lv_obj_get_scroll_bottom(obj) <= cv_line_height(obj) / 2;
+        cv->sync_pending = true;
+        lv_obj_scrollbar_invalidate(obj);
+        /* The refresh timer sleeps while nothing is invalid */
+        lv_display_send_event(cv->disp, LV_EVENT_REFR_REQUEST, NULL);
+    }
+
+    uint32_t slot = cv->next_seq % cv->max_lines;
+    char *dst = &cv->text[slot * cv->line_len];
+    size_t len = strlen(text);
+    if (len > (size_t)cv->line_len - 1U) {
+        len = (size_t)cv->line_len - 1U;
+        /* Do not cut a UTF-8 sequence in half */
+        while (len > 0U && ((uint8_t)text[len] & 0xC0U) == 0x80U) len--;
+    }
+    memcpy(dst, text, len);
+    dst[len] = '\0';
+
+    cv_line_t *line = &cv->lines[slot];
+    uint16_t start = 0;
+    line->run_cnt = 0;
+    if (run_cnt == 0U) {
+        line->runs[0] = (cv_run_t){0, (uint16_t)len, 0, 0,
+                                   lv_obj_get_style_text_color(obj, LV_PART_MAIN)};
+        line->run_cnt = 1;
+    }
+    for (uint8_t r = 0; r < run_cnt && r < CONSOLE_VIEW_RUN_MAX && start < len; r++) {
+        uint16_t run_len = runs[r].len;
+        /* The last run takes the rest of the line */
+        if (run_len == 0U || start + run_len > len || r + 1U == run_cnt) {
+            run_len = (uint16_t)(len - start);
+        }
+        line->runs[line->run_cnt++] = (cv_run_t){start, run_len, 0, 0, runs[r].color};
+        start = (uint16_t)(start + run_len);
+    }
+    cv_layout_line(obj, cv, slot);
+
+    cv->next_seq++;
+    cv->added++;
+    if (cv->count < cv->max_lines) {
+        cv->count++;
+    } else {
+        cv->dropped++;
+    }
+}
+
+void console_view_clear(lv_obj_t *obj)
+{
+    console_view_t *cv = lv_obj_get_user_data(obj);
+    if (cv == NULL) return;
+
+    cv->count = 0U;
+    cv->next_seq = 0U;
+    cv->sync_pending = false;
+    cv->added = 0U;
+    cv->dropped = 0U;
+    lv_obj_scroll_to_y(obj, 0, LV_ANIM_OFF);
+    lv_obj_invalidate(obj);
+}
+
+uint32_t console_view_get_line_count(lv_obj_t *obj)
+{
+    console_view_t *cv = lv_obj_get_user_data(obj);
+    return (cv != NULL) ? cv->count : 0U;
+}
@@ -0,0 +1,50 @@
+/*******************************************************************************
+ * @file    console_view.h
+ * @brief   Terminal-style console widget — colored single-line log output
+ *
+ * Lines go into a ring of `max_lines`; when it is full the oldest line is
+ * dropped. Each line is split into runs, each with its own color (e.g. a
+ * level tag, then the message). Run widths are measured once when the line
+ * is added, so drawing a line is one lv_draw_label() per run with no text
+ * layout, and only the lines inside the clip area are drawn. Lines do not
+ * wrap; text past the right edge is clipped.
+ *
+ * Added lines are applied at the start of the next display refresh, once
+ * per frame however many came in. While the view is at the bottom it
+ * follows the newest line (the scroll redraws the view); while the text
+ * still fits, only the new lines are invalidated. Scrolled back, the view
+ * stays on the same lines and nothing but the scrollbar is redrawn; once
+ * those lines drop out of the ring it stays on the oldest line left.
+ *
+ * Font, line spacing and padding come from the object's style (LV_PART_MAIN).
+ ******************************************************************************/
+#ifndef CONSOLE_VIEW_H
+#define CONSOLE_VIEW_H
+
+#include "lvgl.h"
+#include <stdint.h>
+
+/* Runs per line */
+#ifndef CONSOLE_VIEW_RUN_MAX
+#define CONSOLE_VIEW_RUN_MAX  4
+#endif
+
+typedef struct
+{
+    uint16_t len;           /* bytes; the last run takes the rest of the line */
+    lv_color_t color;
+} console_view_run_t;
+
+/* line_len includes the terminating NUL; longer lines are cut */
+lv_obj_t *console_view_create(lv_obj_t *parent, uint16_t max_lines, uint16_t line_len);
+
+/* Add a line colored by runs (run_cnt 0: one run in the style's text color) */
+void console_view_add_line(lv_obj_t *obj, const char *text,
+                           const console_view_run_t *runs, uint8_t run_cnt);
+
+void console_view_clear(lv_obj_t *obj);
+
+/* Lines held (<= max_lines) */
+uint32_t console_view_get_line_count(lv_obj_t *obj);
+
+#endif /* CONSOLE_VIEW_H */
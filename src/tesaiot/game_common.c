@@ -2,6 +2,7 @@
  * game_common.c — PC simulator version (touch-only, no F310 joystick)
  */
 #include "game_common.h"
+#include <stdint.h>
 #include <string.h>
 
 /* Touch state flags — set by overlay callbacks */
@@ -26,17 +27,538 @@ void game_input_read(game_input_state_t *state)
 
 /* ── CRT Scanline Overlay ──────────────────────────────── */
 
+/* One dark row every GAME_SCANLINE_PITCH rows, drawn by a single overlay
+ * object: its draw callback adds one fill per line that crosses the area
+ * being redrawn, so no per-line objects are styled, laid out or walked. */
+#define GAME_SCANLINE_PITCH  4
+
+static void scanlines_draw_cb(lv_event_t *e)
+{
+    lv_obj_t *overlay = lv_event_get_current_target(e);
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_area_t coords;
+    lv_obj_get_coords(overlay, &coords);
+
+    /* Only the rows being redrawn; the draw tasks clip horizontally */
+    int32_t y_top = LV_MAX(coords.y1, layer->_clip_area.y1);
+    int32_t y_bottom = LV_MIN(coords.y2, layer->_clip_area.y2);
+    if (y_top > y_bottom) return;
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_black();
+    dsc.bg_opa = LV_OPA_10;
+
+    /* First line at or below y_top */
+    int32_t y = coords.y1 + ((y_top - coords.y1 + GAME_SCANLINE_PITCH - 1) /
+                             GAME_SCANLINE_PITCH) * GAME_SCANLINE_PITCH;
+    for (; y <= y_bottom; y += GAME_SCANLINE_PITCH) {
+        lv_area_t line = {coords.x1, y, coords.x2, y};
+        lv_draw_rect(layer, &dsc, &line);
+    }
+}
+
 void game_add_lcd_scanlines(lv_obj_t *arena, lv_coord_t w, lv_coord_t h)
 {
-    for (int y = 0; y < h; y += 4) {
-        lv_obj_t *line = lv_obj_create(arena);
-        lv_obj_remove_style_all(line);
-        lv_obj_set_size(line, w, 1);
-        lv_obj_set_pos(line, 0, y);
-        lv_obj_set_style_bg_opa(line, LV_OPA_10, 0);
-        lv_obj_set_style_bg_color(line, lv_color_black(), 0);
-        lv_obj_remove_flag(line, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_t *overlay = lv_obj_create(arena);
+    lv_obj_remove_style_all(overlay);
+    lv_obj_set_size(overlay, w, h);
+    lv_obj_set_pos(overlay, 0, 0);
+    lv_obj_remove_flag(overlay, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(overlay, scanlines_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+}
+
+/* ── Sprite Layer ──────────────────────────────────────── */
+
+typedef struct {
+    lv_area_t area;                     /* sprite box, layer coordinates */
+    const game_sprite_style_t *style;
+    const game_sprite_part_t *parts;
+    uint8_t part_cnt;
+    bool visible;
+} game_sprite_t;
+
+typedef struct {
+    game_sprite_t *sprites;
+    uint16_t count;
+    uint16_t capacity;
+    lv_area_t dirty[GAME_SPRITE_DIRTY_MAX];
+    uint8_t dirty_cnt;
+    lv_display_t *disp;
+} game_sprite_layer_t;
+
+static int32_t area_size(const lv_area_t *a)
+{
+    return lv_area_get_width(a) * lv_area_get_height(a);
+}
+
+static void area_join(lv_area_t *res, const lv_area_t *a, const lv_area_t *b)
+{
+    res->x1 = LV_MIN(a->x1, b->x1);
+    res->y1 = LV_MIN(a->y1, b->y1);
+    res->x2 = LV_MAX(a->x2, b->x2);
+    res->y2 = LV_MAX(a->y2, b->y2);
+}
+
+static bool area_overlaps(const lv_area_t *a, const lv_area_t *b, int32_t gap)
+{
+    return a->x1 <= b->x2 + gap && b->x1 <= a->x2 + gap &&
+           a->y1 <= b->y2 + gap && b->y1 <= a->y2 + gap;
+}
+
+/* Box plus parts: everything the sprite may paint */
+static void sprite_bounds(const game_sprite_t *spr, lv_area_t *out)
+{
+    *out = spr->area;
+    for (uint8_t i = 0; i < spr->part_cnt; i++) {
+        const game_sprite_part_t *part = &spr->parts[i];
+        lv_area_t a = {spr->area.x1 + part->x, spr->area.y1 + part->y,
+                       spr->area.x1 + part->x + part->w - 1,
+                       spr->area.y1 + part->y + part->h - 1};
+        area_join(out, out, &a);
+    }
+}
+
+/* Merge into a touching rect, else take a free slot, else grow the rect
+ * that grows least. Keeps the per-frame invalidations bounded however
+ * many sprites move. */
+static void layer_mark_dirty(lv_obj_t *obj, game_sprite_layer_t *layer,
+                             const lv_area_t *area)
+{
+    uint8_t best = 0;
+    int32_t best_growth = INT32_MAX;
+
+    for (uint8_t i = 0; i < layer->dirty_cnt; i++) {
+        lv_area_t joined;
+        if (area_overlaps(&layer->dirty[i], area, 1)) {
+            area_join(&layer->dirty[i], &layer->dirty[i], area);
+            return;
+        }
+        area_join(&joined, &layer->dirty[i], area);
+        int32_t growth = area_size(&joined) - area_size(&layer->dirty[i]);
+        if (growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+
+    if (layer->dirty_cnt < GAME_SPRITE_DIRTY_MAX) {
+        if (layer->dirty_cnt == 0) {
+            /* The refresh timer sleeps while nothing is invalid */
+            lv_display_send_event(lv_obj_get_display(obj), LV_EVENT_REFR_REQUEST, NULL);
+        }
+        layer->dirty[layer->dirty_cnt++] = *area;
+        return;
+    }
+    area_join(&layer->dirty[best], &layer->dirty[best], area);
+}
+
+static void sprite_mark_dirty(lv_obj_t *obj, game_sprite_layer_t *layer,
+                              const game_sprite_t *spr)
+{
+    lv_area_t bounds;
+    if (!spr->visible) return;
+    sprite_bounds(spr, &bounds);
+    layer_mark_dirty(obj, layer, &bounds);
+}
+
+static void sprite_layer_refr_start_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_user_data(e);
+    game_sprite_layer_t *layer = lv_obj_get_user_data(obj);
+    lv_area_t coords;
+
+    if (layer->dirty_cnt == 0) return;
+    lv_obj_get_coords(obj, &coords);
+    for (uint8_t i = 0; i < layer->dirty_cnt; i++) {
+        lv_area_t a = layer->dirty[i];
+        lv_area_move(&a, coords.x1, coords.y1);
+        lv_obj_invalidate_area(obj, &a);
+    }
+    layer->dirty_cnt = 0;
+}
+
+static void sprite_draw_rect(lv_layer_t *draw_layer, const game_sprite_style_t *style,
+                             const lv_area_t *area)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_hex(style->bg_color);
+    dsc.border_color = lv_color_hex(style->border_color);
+    dsc.border_width = style->border_width;
+    dsc.radius = style->radius;
+    lv_draw_rect(draw_layer, &dsc, area);
+}
+
+static void sprite_layer_draw_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    lv_layer_t *draw_layer = lv_event_get_layer(e);
+    game_sprite_layer_t *layer = lv_obj_get_user_data(obj);
+    const lv_area_t *clip = &draw_layer->_clip_area;
+    lv_area_t coords;
+
+    lv_obj_get_coords(obj, &coords);
+    for (uint16_t i = 0; i < layer->count; i++) {
+        const game_sprite_t *spr = &layer->sprites[i];
+        lv_area_t bounds;
+        if (!spr->visible) continue;
+
+        sprite_bounds(spr, &bounds);
+        lv_area_move(&bounds, coords.x1, coords.y1);
+        if (!area_overlaps(&bounds, clip, 0)) continue;
+
+        lv_area_t box = spr->area;
+        lv_area_move(&box, coords.x1, coords.y1);
+        sprite_draw_rect(draw_layer, spr->style, &box);
+        for (uint8_t p = 0; p < spr->part_cnt; p++) {
+            const game_sprite_part_t *part = &spr->parts[p];
+            lv_area_t a = {box.x1 + part->x, box.y1 + part->y,
+                           box.x1 + part->x + part->w - 1,
+                           box.y1 + part->y + part->h - 1};
+            sprite_draw_rect(draw_layer, part->style, &a);
+        }
+    }
+}
+
+static void sprite_layer_delete_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    game_sprite_layer_t *layer = lv_obj_get_user_data(obj);
+
+    lv_display_remove_event_cb_with_user_data(layer->disp, sprite_layer_refr_start_cb, obj);
+    lv_free(layer->sprites);
+    lv_free(layer);
+}
+
+static game_sprite_t *sprite_get(lv_obj_t *obj, game_sprite_id_t id,
+                                 game_sprite_layer_t **layer_out)
+{
+    game_sprite_layer_t *layer = lv_obj_get_user_data(obj);
+    if (layer == NULL || id >= layer->count) return NULL;
+    *layer_out = layer;
+    return &layer->sprites[id];
+}
+
+lv_obj_t *game_sprite_layer_create(lv_obj_t *arena, lv_coord_t w, lv_coord_t h,
+                                   uint16_t capacity)
+{
+    game_sprite_layer_t *layer = lv_malloc_zeroed(sizeof(*layer));
+    LV_ASSERT_MALLOC(layer);
+    layer->sprites = lv_malloc_zeroed(sizeof(game_sprite_t) * capacity);
+    LV_ASSERT_MALLOC(layer->sprites);
+    layer->capacity = capacity;
+
+    lv_obj_t *obj = lv_obj_create(arena);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_pos(obj, 0, 0);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_user_data(obj, layer);
+    lv_obj_add_event_cb(obj, sprite_layer_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(obj, sprite_layer_delete_cb, LV_EVENT_DELETE, NULL);
+
+    layer->disp = lv_obj_get_display(obj);
+    lv_display_add_event_cb(layer->disp, sprite_layer_refr_start_cb, LV_EVENT_REFR_START, obj);
+    return obj;
+}
+
+game_sprite_id_t game_sprite_add(lv_obj_t *obj, lv_coord_t w, lv_coord_t h,
+                                 const game_sprite_style_t *style)
+{
+    game_sprite_layer_t *layer = lv_obj_get_user_data(obj);
+    if (layer == NULL || layer->count >= layer->capacity) return GAME_SPRITE_NONE;
+
+    game_sprite_t *spr = &layer->sprites[layer->count];
+    lv_area_set(&spr->area, 0, 0, w - 1, h - 1);
+    spr->style = style;
+    spr->parts = NULL;
+    spr->part_cnt = 0;
+    spr->visible = false;
+    return layer->count++;
+}
+
+void game_sprite_set_pos(lv_obj_t *obj, game_sprite_id_t id, lv_coord_t x, lv_coord_t y)
+{
+    game_sprite_layer_t *layer;
+    game_sprite_t *spr = sprite_get(obj, id, &layer);
+    if (spr == NULL || (spr->area.x1 == x && spr->area.y1 == y)) return;
+
+    /* Old and new places usually overlap: mark them as one rect */
+    lv_area_t before;
+    lv_area_t after;
+    sprite_bounds(spr, &before);
+    lv_area_move(&spr->area, x - spr->area.x1, y - spr->area.y1);
+    if (!spr->visible) return;
+    sprite_bounds(spr, &after);
+    if (area_overlaps(&before, &after, 1)) {
+        area_join(&after, &after, &before);
+    }
+    else {
+        layer_mark_dirty(obj, layer, &before);
+    }
+    layer_mark_dirty(obj, layer, &after);
+}
+
+void game_sprite_set_size(lv_obj_t *obj, game_sprite_id_t id, lv_coord_t w, lv_coord_t h)
+{
+    game_sprite_layer_t *layer;
+    game_sprite_t *spr = sprite_get(obj, id, &layer);
+    if (spr == NULL) return;
+    if (lv_area_get_width(&spr->area) == w && lv_area_get_height(&spr->area) == h) return;
+
+    sprite_mark_dirty(obj, layer, spr);
+    spr->area.x2 = spr->area.x1 + w - 1;
+    spr->area.y2 = spr->area.y1 + h - 1;
+    sprite_mark_dirty(obj, layer, spr);
+}
+
+void game_sprite_set_visible(lv_obj_t *obj, game_sprite_id_t id, bool visible)
+{
+    game_sprite_layer_t *layer;
+    game_sprite_t *spr = sprite_get(obj, id, &layer);
+    if (spr == NULL || spr->visible == visible) return;
+
+    /* Marked while visible: before hiding, after showing */
+    sprite_mark_dirty(obj, layer, spr);
+    spr->visible = visible;
+    sprite_mark_dirty(obj, layer, spr);
+}
+
+void game_sprite_set_style(lv_obj_t *obj, game_sprite_id_t id,
+                           const game_sprite_style_t *style)
+{
+    game_sprite_layer_t *layer;
+    game_sprite_t *spr = sprite_get(obj, id, &layer);
+    if (spr == NULL || spr->style == style) return;
+
+    spr->style = style;
+    sprite_mark_dirty(obj, layer, spr);
+}
+
+void game_sprite_set_parts(lv_obj_t *obj, game_sprite_id_t id,
+                           const game_sprite_part_t *parts, uint8_t part_cnt)
+{
+    game_sprite_layer_t *layer;
+    game_sprite_t *spr = sprite_get(obj, id, &layer);
+    if (spr == NULL || (spr->parts == parts && spr->part_cnt == part_cnt)) return;
+
+    sprite_mark_dirty(obj, layer, spr);
+    spr->parts = parts;
+    spr->part_cnt = part_cnt;
+    sprite_mark_dirty(obj, layer, spr);
+}
+
+/* ── Collision Grid ────────────────────────────────────── */
+
+#define GRID_NIL  UINT32_MAX
+
+typedef struct {
+    uint32_t next;          /* next entry in the same cell */
+    uint16_t id;
+} grid_entry_t;
+
+typedef struct {
+    lv_area_t box;          /* inclusive, caller units */
+    int16_t col1;           /* cells the box is listed in */
+    int16_t row1;
+    int16_t col2;
+    int16_t row2;
+    bool in_grid;
+} grid_obj_t;
+
+struct game_collision_grid {
+    int32_t cell_size;
+    int32_t cols;
+    int32_t rows;
+    uint32_t *cells;        /* first entry per cell */
+    grid_obj_t *objs;
+    uint16_t capacity;
+    grid_entry_t *entries;
+    uint32_t entry_cap;
+    uint32_t free_entry;    /* free list through grid_entry_t::next */
+    uint32_t free_count;
+};
+
+static int32_t grid_col(const game_collision_grid_t *grid, int32_t x)
+{
+    int32_t c = (x < 0) ? 0 : x / grid->cell_size;
+    return (c >= grid->cols) ? grid->cols - 1 : c;
+}
+
+static int32_t grid_row(const game_collision_grid_t *grid, int32_t y)
+{
+    int32_t r = (y < 0) ? 0 : y / grid->cell_size;
+    return (r >= grid->rows) ? grid->rows - 1 : r;
+}
+
+/* An overlap is reported only from the cell holding the top-left corner of
+ * the intersection; both boxes are listed there, so it is found once. */
+static bool grid_is_home_cell(const game_collision_grid_t *grid, const lv_area_t *a,
+                              const lv_area_t *b, int32_t col, int32_t row)
+{
+    return grid_col(grid, LV_MAX(a->x1, b->x1)) == col &&
+           grid_row(grid, LV_MAX(a->y1, b->y1)) == row;
+}
+
+game_collision_grid_t *game_collision_grid_create(int32_t w, int32_t h,
+                                                  int32_t cell_size,
+                                                  uint16_t capacity)
+{
+    game_collision_grid_t *grid = lv_malloc_zeroed(sizeof(*grid));
+    LV_ASSERT_MALLOC(grid);
+    if (grid == NULL) return NULL;
+
+    grid->cell_size = LV_MAX(cell_size, 1);
+    grid->cols = LV_MAX((w + grid->cell_size - 1) / grid->cell_size, 1);
+    grid->rows = LV_MAX((h + grid->cell_size - 1) / grid->cell_size, 1);
+    grid->capacity = capacity;
+    /* A box no larger than a cell touches at most 2x2 cells */
+    grid->entry_cap = (uint32_t)capacity * 4U;
+    grid->cells = lv_malloc(sizeof(uint32_t) * (size_t)(grid->cols * grid->rows));
+    grid->objs = lv_malloc_zeroed(sizeof(grid_obj_t) * capacity);
+    grid->entries = lv_malloc(sizeof(grid_entry_t) * grid->entry_cap);
+    LV_ASSERT_MALLOC(grid->cells);
+    LV_ASSERT_MALLOC(grid->objs);
+    LV_ASSERT_MALLOC(grid->entries);
+
+    game_collision_grid_clear(grid);
+    return grid;
+}
+
+void game_collision_grid_delete(game_collision_grid_t *grid)
+{
+    if (grid == NULL) return;
+    lv_free(grid->cells);
+    lv_free(grid->objs);
+    lv_free(grid->entries);
+    lv_free(grid);
+}
+
+void game_collision_grid_clear(game_collision_grid_t *grid)
+{
+    for (int32_t i = 0; i < grid->cols * grid->rows; i++) grid->cells[i] = GRID_NIL;
+    for (uint16_t i = 0; i < grid->capacity; i++) grid->objs[i].in_grid = false;
+    for (uint32_t i = 0; i < grid->entry_cap; i++) {
+        grid->entries[i].next = (i + 1U < grid->entry_cap) ? i + 1U : GRID_NIL;
+    }
+    grid->free_entry = (grid->entry_cap > 0U) ? 0U : GRID_NIL;
+    grid->free_count = grid->entry_cap;
+}
+
+void game_collision_grid_remove(game_collision_grid_t *grid, uint16_t id)
+{
+    if (id >= grid->capacity || !grid->objs[id].in_grid) return;
+    grid_obj_t *obj = &grid->objs[id];
+
+    for (int32_t row = obj->row1; row <= obj->row2; row++) {
+        for (int32_t col = obj->col1; col <= obj->col2; col++) {
+            uint32_t *link = &grid->cells[row * grid->cols + col];
+            while (*link != GRID_NIL && grid->entries[*link].id != id) {
+                link = &grid->entries[*link].next;
+            }
+            if (*link == GRID_NIL) continue;
+            uint32_t e = *link;
+            *link = grid->entries[e].next;
+            grid->entries[e].next = grid->free_entry;
+            grid->free_entry = e;
+            grid->free_count++;
+        }
+    }
+    obj->in_grid = false;
+}
+
+bool game_collision_grid_set(game_collision_grid_t *grid, uint16_t id,
+                             int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    if (id >= grid->capacity || w <= 0 || h <= 0) return false;
+    grid_obj_t *obj = &grid->objs[id];
+    int32_t col1 = grid_col(grid, x);
+    int32_t row1 = grid_row(grid, y);
+    int32_t col2 = grid_col(grid, x + w - 1);
+    int32_t row2 = grid_row(grid, y + h - 1);
+
+    lv_area_set(&obj->box, x, y, x + w - 1, y + h - 1);
+    /* Still in the same cells: the lists stay as they are */
+    if (obj->in_grid && obj->col1 == col1 && obj->row1 == row1 &&
+        obj->col2 == col2 && obj->row2 == row2) {
+        return true;
+    }
+
+    game_collision_grid_remove(grid, id);
+    if ((uint32_t)((col2 - col1 + 1) * (row2 - row1 + 1)) > grid->free_count) return false;
+    obj->col1 = (int16_t)col1;
+    obj->row1 = (int16_t)row1;
+    obj->col2 = (int16_t)col2;
+    obj->row2 = (int16_t)row2;
+    obj->in_grid = true;
+
+    for (int32_t row = row1; row <= row2; row++) {
+        for (int32_t col = col1; col <= col2; col++) {
+            uint32_t e = grid->free_entry;
+            uint32_t *head = &grid->cells[row * grid->cols + col];
+            grid->free_entry = grid->entries[e].next;
+            grid->free_count--;
+            grid->entries[e].id = id;
+            grid->entries[e].next = *head;
+            *head = e;
+        }
+    }
+    return true;
+}
+
+uint32_t game_collision_grid_query(const game_collision_grid_t *grid,
+                                   int32_t x, int32_t y, int32_t w, int32_t h,
+                                   game_collision_cb_t cb, void *user_data)
+{
+    if (w <= 0 || h <= 0) return 0;
+    lv_area_t box = {x, y, x + w - 1, y + h - 1};
+    int32_t col1 = grid_col(grid, box.x1);
+    int32_t row1 = grid_row(grid, box.y1);
+    int32_t col2 = grid_col(grid, box.x2);
+    int32_t row2 = grid_row(grid, box.y2);
+    uint32_t found = 0;
+
+    for (int32_t row = row1; row <= row2; row++) {
+        for (int32_t col = col1; col <= col2; col++) {
+            uint32_t e = grid->cells[row * grid->cols + col];
+            for (; e != GRID_NIL; e = grid->entries[e].next) {
+                uint16_t id = grid->entries[e].id;
+                const lv_area_t *obj_box = &grid->objs[id].box;
+                if (!area_overlaps(&box, obj_box, 0)) continue;
+                if (!grid_is_home_cell(grid, &box, obj_box, col, row)) continue;
+                found++;
+                if (cb != NULL && !cb(id, user_data)) return found;
+            }
+        }
+    }
+    return found;
+}
+
+uint32_t game_collision_grid_pairs(const game_collision_grid_t *grid,
+                                   game_collision_pair_cb_t cb, void *user_data)
+{
+    uint32_t found = 0;
+
+    for (int32_t row = 0; row < grid->rows; row++) {
+        for (int32_t col = 0; col < grid->cols; col++) {
+            uint32_t a = grid->cells[row * grid->cols + col];
+            for (; a != GRID_NIL; a = grid->entries[a].next) {
+                const lv_area_t *box_a = &grid->objs[grid->entries[a].id].box;
+                uint32_t b = grid->entries[a].next;
+                for (; b != GRID_NIL; b = grid->entries[b].next) {
+                    const lv_area_t *box_b = &grid->objs[grid->entries[b].id].box;
+                    if (!area_overlaps(box_a, box_b, 0)) continue;
+                    if (!grid_is_home_cell(grid, box_a, box_b, col, row)) continue;
+                    found++;
+                    if (cb != NULL && !cb(grid->entries[a].id, grid->entries[b].id, user_data)) {
+                        return found;
+                    }
+                }
+            }
+        }
     }
+    return found;
 }
 
 /* ── Touch Overlay Helpers ─────────────────────────────── */
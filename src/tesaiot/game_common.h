@@ -3,7 +3,8 @@
  *
  * Description: Shared game infrastructure for Developer Hub game examples.
  *              Game Boy 4-tone palette, touch-only input abstraction,
- *              scanline overlay, and common UI helpers.
+ *              scanline overlay, sprite layer, collision grid, and common
+ *              UI helpers.
  *
  *              Simplified from production game_common.h — no F310 joystick,
  *              no page_manager. Touch overlay controls only.
@@ -71,6 +72,117 @@ void game_input_read(game_input_state_t *state);
 /** Add CRT-style scanline overlay to an arena object. */
 void game_add_lcd_scanlines(lv_obj_t *arena, lv_coord_t w, lv_coord_t h);
 
+/*******************************************************************************
+ * Sprite Layer
+ *
+ * One LVGL object that draws a flat array of sprites in its own draw event,
+ * for entities that move every tick (bullets, enemies, snake segments...).
+ * Moving a sprite costs no style lookup or relayout: the layer records the
+ * old and new rectangles and merges them into at most GAME_SPRITE_DIRTY_MAX
+ * dirty rects, invalidated once per display refresh. Sprites draw in add
+ * order, clipped to the layer. Coordinates are relative to the layer.
+ *******************************************************************************/
+#define GAME_SPRITE_NONE       0xFFFFU
+#define GAME_SPRITE_DIRTY_MAX  8
+
+typedef uint16_t game_sprite_id_t;
+
+/** Fill + border of a sprite or part (colors as 24-bit hex, like GB_*).
+ *  Meant to be static const and shared by many sprites. */
+typedef struct {
+    uint32_t bg_color;
+    uint32_t border_color;
+    uint8_t border_width;
+    uint8_t radius;
+} game_sprite_style_t;
+
+/** Detail drawn on top of a sprite (eye, wing...), offset from its origin.
+ *  Parts may stick out of the sprite box. */
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    const game_sprite_style_t *style;
+} game_sprite_part_t;
+
+/** Create a sprite layer covering (0,0)-(w,h) of an arena.
+ *  @param arena     parent object (create it after the scanlines)
+ *  @param w         layer width
+ *  @param h         layer height
+ *  @param capacity  maximum number of sprites
+ */
+lv_obj_t *game_sprite_layer_create(lv_obj_t *arena, lv_coord_t w, lv_coord_t h,
+                                   uint16_t capacity);
+
+/** Add a hidden w x h sprite at (0,0). Returns GAME_SPRITE_NONE when full. */
+game_sprite_id_t game_sprite_add(lv_obj_t *layer, lv_coord_t w, lv_coord_t h,
+                                 const game_sprite_style_t *style);
+
+void game_sprite_set_pos(lv_obj_t *layer, game_sprite_id_t id,
+                         lv_coord_t x, lv_coord_t y);
+void game_sprite_set_size(lv_obj_t *layer, game_sprite_id_t id,
+                          lv_coord_t w, lv_coord_t h);
+void game_sprite_set_visible(lv_obj_t *layer, game_sprite_id_t id, bool visible);
+void game_sprite_set_style(lv_obj_t *layer, game_sprite_id_t id,
+                           const game_sprite_style_t *style);
+
+/** Replace the detail parts of a sprite (the array is not copied). */
+void game_sprite_set_parts(lv_obj_t *layer, game_sprite_id_t id,
+                           const game_sprite_part_t *parts, uint8_t part_cnt);
+
+/*******************************************************************************
+ * Collision Grid (spatial hash)
+ *
+ * AABB broad phase on a uniform grid: each object is listed in every cell
+ * its box touches, so a query only visits the objects near the query box
+ * instead of all of them. Boxes are x,y,w,h in any unit (pixels, grid
+ * cells); boxes that share an edge overlap. Objects outside the grid go in
+ * the edge cells. Pick cell_size at least as large as the biggest object.
+ *
+ * Candidates are passed to a callback, which does the exact (narrow phase)
+ * test and returns false to stop. Each overlap is reported once, however
+ * many cells the two boxes share. Do not change the grid from a callback.
+ *******************************************************************************/
+typedef struct game_collision_grid game_collision_grid_t;
+
+/** Called for each object overlapping a query box. */
+typedef bool (*game_collision_cb_t)(uint16_t id, void *user_data);
+
+/** Called for each overlapping pair of objects in the grid. */
+typedef bool (*game_collision_pair_cb_t)(uint16_t id_a, uint16_t id_b, void *user_data);
+
+/** Create a grid covering (0,0)-(w,h).
+ *  @param w          grid width
+ *  @param h          grid height
+ *  @param cell_size  cell edge, same unit as w/h
+ *  @param capacity   object ids run from 0 to capacity - 1
+ */
+game_collision_grid_t *game_collision_grid_create(int32_t w, int32_t h,
+                                                  int32_t cell_size,
+                                                  uint16_t capacity);
+void game_collision_grid_delete(game_collision_grid_t *grid);
+
+/** Remove every object. */
+void game_collision_grid_clear(game_collision_grid_t *grid);
+
+/** Insert object id, or move it if present. Returns false when the grid
+ *  runs out of cell entries (object much larger than a cell). */
+bool game_collision_grid_set(game_collision_grid_t *grid, uint16_t id,
+                             int32_t x, int32_t y, int32_t w, int32_t h);
+void game_collision_grid_remove(game_collision_grid_t *grid, uint16_t id);
+
+/** Report objects overlapping a box. cb may be NULL to just count them.
+ *  @return number of objects reported */
+uint32_t game_collision_grid_query(const game_collision_grid_t *grid,
+                                   int32_t x, int32_t y, int32_t w, int32_t h,
+                                   game_collision_cb_t cb, void *user_data);
+
+/** Report every overlapping pair of objects.
+ *  @return number of pairs reported */
+uint32_t game_collision_grid_pairs(const game_collision_grid_t *grid,
+                                   game_collision_pair_cb_t cb, void *user_data);
+
 /** Create touch D-pad overlay (left margin of parent).
  *  @param parent     parent container
  *  @param arena_x    arena X position (controls go in left margin)
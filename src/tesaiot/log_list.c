@@ -0,0 +1,257 @@
+/*******************************************************************************
+ * @file    log_list.c
+ * @brief   Virtual log list — fixed-height rows recycled over a record ring
+ ******************************************************************************/
+#include "log_list.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_LIST_UNBOUND  UINT32_MAX
+
+typedef struct {
+    uint8_t *records;           /* ring, capacity * record_size */
+    size_t record_size;
+    uint32_t capacity;
+    uint32_t count;
+    uint32_t next_seq;          /* seq of the next append */
+
+    int32_t row_h;
+    int32_t row_gap;
+    log_list_create_cb_t create_cb;
+    log_list_bind_cb_t bind_cb;
+    void *user_data;
+
+    /* Row pool: record seq s is shown by rows[s % row_cnt] */
+    lv_obj_t **rows;
+    uint32_t *row_seq;          /* seq bound to each row, or LOG_LIST_UNBOUND */
+    uint32_t row_cnt;
+
+    /* Appends since the last frame, applied once at the next refresh */
+    lv_display_t *disp;
+    bool sync_pending;
+    bool follow;                /* was at the end before those appends */
+    uint32_t dropped;           /* records dropped from the front since */
+} log_list_t;
+
+/* ── Helpers ───────────────────────────────────────────── */
+
+static int32_t list_pitch(const log_list_t *ll)
+{
+    return ll->row_h + ll->row_gap;
+}
+
+static const void *list_record(const log_list_t *ll, uint32_t seq)
+{
+    return ll->records + (size_t)(seq % ll->capacity) * ll->record_size;
+}
+
+/* Grow the pool to cover the list height plus a partial row at each end */
+static void list_ensure_rows(lv_obj_t *obj, log_list_t *ll)
+{
+    if (ll->create_cb == NULL) return;
+    uint32_t need = (uint32_t)(lv_obj_get_height(obj) / list_pitch(ll)) + 2U;
+    if (need <= ll->row_cnt) return;
+
+    ll->rows = lv_realloc(ll->rows, sizeof(lv_obj_t *) * need);
+    ll->row_seq = lv_realloc(ll->row_seq, sizeof(uint32_t) * need);
+    LV_ASSERT_MALLOC(ll->rows);
+    LV_ASSERT_MALLOC(ll->row_seq);
+
+    for (uint32_t i = ll->row_cnt; i < need; i++) {
+        lv_obj_t *row = lv_obj_create(obj);
+        lv_obj_set_size(row, lv_pct(100), ll->row_h);
+        lv_obj_remove_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        ll->create_cb(row, ll->user_data);
+        ll->rows[i] = row;
+    }
+    ll->row_cnt = need;
+
+    /* The seq -> row mapping changed with the pool size */
+    for (uint32_t i = 0; i < ll->row_cnt; i++) {
+        ll->row_seq[i] = LOG_LIST_UNBOUND;
+        lv_obj_add_flag(ll->rows[i], LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/* Bind and place the rows in view, hide the others. Rows that already show
+ * the right record are only moved (their index shifts as old records drop). */
+static void list_refresh(lv_obj_t *obj, log_list_t *ll)
+{
+    if (ll->row_cnt == 0U) return;
+
+    int32_t pitch = list_pitch(ll);
+    int32_t top = lv_obj_get_scroll_y(obj) - lv_obj_get_style_space_top(obj, LV_PART_MAIN);
+    int32_t first = LV_MAX(top, 0) / pitch;
+    int32_t last = (top + lv_obj_get_height(obj)) / pitch;
+    uint32_t oldest = ll->next_seq - ll->count;
+    uint32_t s0 = oldest + (uint32_t)first;
+    uint32_t s1 = oldest + (uint32_t)LV_MIN(last, (int32_t)ll->count - 1);
+
+    for (uint32_t i = 0; i < ll->row_cnt; i++) {
+        lv_obj_t *row = ll->rows[i];
+        /* The seq in [s0, s1] that maps to this row, if any */
+        uint32_t seq = s0 + (i + ll->row_cnt - s0 % ll->row_cnt) % ll->row_cnt;
+
+        if (ll->count == 0U || (int32_t)(seq - s0) > (int32_t)(s1 - s0)) {
+            lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+            continue;
+        }
+        if (ll->row_seq[i] != seq) {
+            ll->bind_cb(row, seq, list_record(ll, seq), ll->user_data);
+            ll->row_seq[i] = seq;
+        }
+        lv_obj_set_y(row, (int32_t)(seq - oldest) * pitch);
+        lv_obj_remove_flag(row, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/* ── Events ────────────────────────────────────────────── */
+
+/* One scroll and row pass per frame, however many appends came in */
+static void log_list_refr_start_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_user_data(e);
+    log_list_t *ll = lv_obj_get_user_data(obj);
+
+    if (!ll->sync_pending) return;
+    ll->sync_pending = false;
+
+    if (ll->follow) {
+        lv_obj_scroll_to_y(obj, LV_COORD_MAX, LV_ANIM_OFF);
+    } else if (ll->dropped > 0U) {
+        /* The records in view moved up; move the view with them, but not past
+         * the top: once they are gone the oldest record stays at the top */
+        int32_t dy = LV_MIN((int32_t)ll->dropped * list_pitch(ll), lv_obj_get_scroll_y(obj));
+        if (dy > 0) lv_obj_scroll_by(obj, 0, dy, LV_ANIM_OFF);
+    }
+    ll->dropped = 0U;
+    lv_obj_scrollbar_invalidate(obj);
+    list_refresh(obj, ll);
+}
+
+static void log_list_event_cb(lv_event_t *e)
+{
+    lv_obj_t *obj = lv_event_get_current_target(e);
+    log_list_t *ll = lv_obj_get_user_data(obj);
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_GET_SELF_SIZE) {
+        /* Height of all rows, so the scroll range covers every record */
+        lv_point_t *p = lv_event_get_param(e);
+        if (ll->count > 0U) {
+            p->y = LV_MAX(p->y, (int32_t)ll->count * list_pitch(ll) - ll->row_gap);
+        }
+    } else if (code == LV_EVENT_SCROLL) {
+        list_refresh(obj, ll);
+    } else if (code == LV_EVENT_SIZE_CHANGED) {
+        list_ensure_rows(obj, ll);
+        list_refresh(obj, ll);
+    } else if (code == LV_EVENT_DELETE) {
+        lv_display_remove_event_cb_with_user_data(ll->disp, log_list_refr_start_cb, obj);
+        free(ll->records);
+        lv_free(ll->rows);
+        lv_free(ll->row_seq);
+        lv_free(ll);
+    }
+}
+
+/* ── Public API ────────────────────────────────────────── */
+
+lv_obj_t *log_list_create(lv_obj_t *parent, size_t record_size, uint32_t capacity)
+{
+    if (record_size == 0U || capacity == 0U) return NULL;
+
+    log_list_t *ll = lv_malloc_zeroed(sizeof(*ll));
+    LV_ASSERT_MALLOC(ll);
+    if (ll == NULL) return NULL;
+
+    ll->records = malloc(record_size * capacity);
+    if (ll->records == NULL) {
+        LV_LOG_WARN("log_list: no memory for %lu records", (unsigned long)capacity);
+        lv_free(ll);
+        return NULL;
+    }
+    ll->record_size = record_size;
+    ll->capacity = capacity;
+    ll->row_h = 1;
+
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_set_scroll_dir(obj, LV_DIR_VER);
+    lv_obj_set_user_data(obj, ll);
+    lv_obj_add_event_cb(obj, log_list_event_cb, LV_EVENT_ALL, NULL);
+
+    ll->disp = lv_obj_get_display(obj);
+    lv_display_add_event_cb(ll->disp, log_list_refr_start_cb, LV_EVENT_REFR_START, obj);
+    return obj;
+}
+
+void log_list_set_rows(lv_obj_t *list, int32_t row_h, int32_t row_gap,
+                       log_list_create_cb_t create_cb, log_list_bind_cb_t bind_cb,
+                       void *user_data)
+{
+    log_list_t *ll = lv_obj_get_user_data(list);
+    if (ll == NULL || ll->create_cb != NULL) return;
+
+    ll->row_h = LV_MAX(row_h, 1);
+    ll->row_gap = LV_MAX(row_gap, 0);
+    ll->create_cb = create_cb;
+    ll->bind_cb = bind_cb;
+    ll->user_data = user_data;
+    list_ensure_rows(list, ll);
+}
+
+void log_list_append(lv_obj_t *list, const void *record)
+{
+    log_list_t *ll = lv_obj_get_user_data(list);
+    if (ll == NULL) return;
+
+    if (!ll->sync_pending) {
+        /* Within half a row of the end: keep following the newest record */
+        ll->follow = lv_obj_get_scroll_bottom(list) <= list_pitch(ll) / 2;
+        ll->sync_pending = true;
+        /* The scrollbar thumb shrinks as the list grows */
+        lv_obj_scrollbar_invalidate(list);
+        /* The refresh timer sleeps while nothing is invalid */
+        lv_display_send_event(ll->disp, LV_EVENT_REFR_REQUEST, NULL);
+    }
+
+    memcpy(ll->records + (size_t)(ll->next_seq % ll->capacity) * ll->record_size,
+           record, ll->record_size);
+    ll->next_seq++;
+    if (ll->count < ll->capacity) {
+        ll->count++;
+    } else {
+        ll->dropped++;
+    }
+}
+
+void log_list_clear(lv_obj_t *list)
+{
+    log_list_t *ll = lv_obj_get_user_data(list);
+    if (ll == NULL) return;
+
+    lv_obj_scrollbar_invalidate(list);
+    ll->count = 0U;
+    ll->next_seq = 0U;
+    ll->sync_pending = false;
+    ll->dropped = 0U;
+    for (uint32_t i = 0; i < ll->row_cnt; i++) {
+        ll->row_seq[i] = LOG_LIST_UNBOUND;
+        lv_obj_add_flag(ll->rows[i], LV_OBJ_FLAG_HIDDEN);
+    }
+    lv_obj_scroll_to_y(list, 0, LV_ANIM_OFF);
+}
+
+uint32_t log_list_get_count(lv_obj_t *list)
+{
+    log_list_t *ll = lv_obj_get_user_data(list);
+    return (ll != NULL) ? ll->count : 0U;
+}
+
+uint32_t log_list_get_row_count(lv_obj_t *list)
+{
+    log_list_t *ll = lv_obj_get_user_data(list);
+    return (ll != NULL) ? ll->row_cnt : 0U;
+}
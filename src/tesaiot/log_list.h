@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * @file    log_list.h
+ * @brief   Virtual log list — fixed-height rows recycled over a record ring
+ *
+ * Records are fixed-size structs copied into a ring of `capacity` slots;
+ * when it is full, each append drops the oldest record. Only the rows that
+ * fit in the list (plus one or two) exist as LVGL objects. They are built
+ * once by the create callback and pointed at records by the bind callback
+ * whenever scrolling or an append brings a new record into view, so memory
+ * stays constant whatever the number of records.
+ *
+ * An append only copies the record; the list catches up at the start of
+ * the next display refresh with one scroll and one pass over the visible
+ * rows, however many records came in during the frame.
+ *
+ * Row r shows the record at y = r * (row_h + row_gap); the list reports the
+ * full height as its content size, so scrolling and the scrollbar behave as
+ * if every row existed. Appends keep the view on the newest record while
+ * the list is scrolled to the end; otherwise the view stays on the same
+ * records until they drop out of the ring, then on the oldest record left.
+ *
+ * The ring is allocated with malloc(), not from the LVGL heap, so large
+ * histories (100k records) do not exhaust LV_MEM_SIZE.
+ ******************************************************************************/
+#ifndef LOG_LIST_H
+#define LOG_LIST_H
+
+#include "lvgl.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Build the children of an empty row (called once per pooled row) */
+typedef void (*log_list_create_cb_t)(lv_obj_t *row, void *user_data);
+
+/* Show a record in a row. seq counts appends since the last clear, from 0. */
+typedef void (*log_list_bind_cb_t)(lv_obj_t *row, uint32_t seq, const void *record,
+                                   void *user_data);
+
+/* Create the list (style it like any lv_obj). Returns NULL if the ring
+ * cannot be allocated. */
+lv_obj_t *log_list_create(lv_obj_t *parent, size_t record_size, uint32_t capacity);
+
+/* Row geometry and callbacks; call once, before the first append */
+void log_list_set_rows(lv_obj_t *list, int32_t row_h, int32_t row_gap,
+                       log_list_create_cb_t create_cb, log_list_bind_cb_t bind_cb,
+                       void *user_data);
+
+/* Copy a record in, dropping the oldest if the ring is full */
+void log_list_append(lv_obj_t *list, const void *record);
+
+/* Drop every record; seq starts again at 0 */
+void log_list_clear(lv_obj_t *list);
+
+/* Records held (<= capacity) */
+uint32_t log_list_get_count(lv_obj_t *list);
+
+/* Row objects in the pool */
+uint32_t log_list_get_row_count(lv_obj_t *list);
+
+#endif /* LOG_LIST_H */
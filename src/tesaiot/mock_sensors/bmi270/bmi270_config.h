@@ -9,6 +9,10 @@
 #define BMI270_SAMPLE_PERIOD_MS           (200U)
 #define BMI270_SAMPLE_LOG_INTERVAL        (20U)
 
+/* FIFO output data rate and depth. 2 KB FIFO / 12-byte acc+gyr frame. */
+#define BMI270_FIFO_ODR_HZ                (200U)
+#define BMI270_FIFO_DEPTH                 (170U)
+
 /* Update LVGL widgets every N samples to reduce visible flicker. */
 #define BMI270_UI_UPDATE_DIV              (2U)
 
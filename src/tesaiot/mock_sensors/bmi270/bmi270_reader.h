@@ -2,6 +2,8 @@
 #define BMI270_READER_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "../sensor_bus.h"
 #include "bmi270_types.h"
@@ -10,4 +12,11 @@ cy_rslt_t bmi270_reader_init(mtb_hal_i2c_t *i2c_bus);
 bool bmi270_reader_poll(bmi270_sample_t *out_sample);
 cy_rslt_t bmi270_reader_get_last_error(void);
 
+/* FIFO (stream mode): the sensor queues one sample per 1/ODR. Copies up to
+ * max queued samples, oldest first, and returns how many were copied.
+ * When the FIFO is full the oldest samples are overwritten. */
+size_t bmi270_reader_read_fifo(bmi270_sample_t *buf, size_t max);
+uint32_t bmi270_reader_get_fifo_odr_hz(void);
+uint32_t bmi270_reader_get_fifo_overruns(void);
+
 #endif /* BMI270_READER_H */
@@ -3,7 +3,11 @@
  * @brief   Mock BMI270 IMU — gentle sine-wave accelerometer + small gyro
  ******************************************************************************/
 #include <math.h>
+#include <string.h>
 #include "bmi270_reader.h"
+#include "bmi270_config.h"
+#include "../sensor_replay.h"
+#include "lvgl.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -11,19 +15,23 @@
 
 static uint32_t tick = 0;
 
-cy_rslt_t bmi270_reader_init(mtb_hal_i2c_t *i2c_bus)
-{
-    (void)i2c_bus;
-    tick = 0;
-    return CY_RSLT_SUCCESS;
-}
-
-bool bmi270_reader_poll(bmi270_sample_t *out_sample)
+/* Stream-mode FIFO, filled at BMI270_FIFO_ODR_HZ on lv_tick time whenever
+ * it is read (the hardware fills it in the background) */
+typedef struct
 {
-    if (!out_sample) return false;
+    bmi270_sample_t ring[BMI270_FIFO_DEPTH];
+    uint32_t head;          /* oldest sample */
+    uint32_t count;
+    uint32_t overruns;      /* samples overwritten before they were read */
+    uint64_t produced;      /* samples generated since init */
+    uint64_t elapsed_ms;
+    uint32_t last_tick;
+} bmi270_fifo_t;
 
-    double t = (double)tick * 0.02;   /* ~50 Hz virtual sample rate */
+static bmi270_fifo_t fifo;
 
+static void synth_sample(double t, bmi270_sample_t *out_sample)
+{
     out_sample->acc_g_x = 0.15f * sinf((float)(t * 1.0));
     out_sample->acc_g_y = 0.10f * sinf((float)(t * 0.7 + 1.0));
     out_sample->acc_g_z = 1.0f + 0.02f * sinf((float)(t * 0.3));
@@ -39,6 +47,76 @@ bool bmi270_reader_poll(bmi270_sample_t *out_sample)
     out_sample->gyr_mag_dps = sqrtf(out_sample->gyr_dps_x * out_sample->gyr_dps_x +
                                     out_sample->gyr_dps_y * out_sample->gyr_dps_y +
                                     out_sample->gyr_dps_z * out_sample->gyr_dps_z);
+}
+
+static void fifo_push(const bmi270_sample_t *sample)
+{
+    if (fifo.count == BMI270_FIFO_DEPTH) {
+        fifo.head = (fifo.head + 1U) % BMI270_FIFO_DEPTH;
+        fifo.count--;
+        fifo.overruns++;
+    }
+    bmi270_sample_t *slot = &fifo.ring[(fifo.head + fifo.count) % BMI270_FIFO_DEPTH];
+    *slot = *sample;
+    slot->sample_count = (uint32_t)fifo.produced++;
+    fifo.count++;
+}
+
+/* Queue every sample the sensor would have produced since the last read */
+static void fifo_fill(void)
+{
+    uint32_t now = lv_tick_get();
+    fifo.elapsed_ms += lv_tick_diff(now, fifo.last_tick);
+    fifo.last_tick = now;
+
+    if (sensor_replay_active(SENSOR_REPLAY_BMI270)) {
+        uint32_t n;
+        uint32_t dropped;
+        const bmi270_sample_t *run;
+        while ((run = sensor_replay_take(SENSOR_REPLAY_BMI270, &n, &dropped)) != NULL && n > 0) {
+            fifo.overruns += dropped;
+            for (uint32_t i = 0; i < n; i++) fifo_push(&run[i]);
+        }
+        return;
+    }
+
+    uint64_t due = fifo.elapsed_ms * BMI270_FIFO_ODR_HZ / 1000U;
+    if (due - fifo.produced > BMI270_FIFO_DEPTH) {
+        /* Only the newest BMI270_FIFO_DEPTH samples would survive anyway */
+        fifo.overruns += (uint32_t)(due - fifo.produced - BMI270_FIFO_DEPTH);
+        fifo.produced = due - BMI270_FIFO_DEPTH;
+    }
+    while (fifo.produced < due) {
+        bmi270_sample_t sample;
+        synth_sample((double)fifo.produced / BMI270_FIFO_ODR_HZ, &sample);
+        fifo_push(&sample);
+    }
+}
+
+cy_rslt_t bmi270_reader_init(mtb_hal_i2c_t *i2c_bus)
+{
+    (void)i2c_bus;
+    tick = 0;
+    sensor_replay_rewind(SENSOR_REPLAY_BMI270);
+
+    memset(&fifo, 0, sizeof(fifo));
+    fifo.last_tick = lv_tick_get();
+    return CY_RSLT_SUCCESS;
+}
+
+bool bmi270_reader_poll(bmi270_sample_t *out_sample)
+{
+    if (!out_sample) return false;
+
+    /* Recorded trace loaded with --replay: serve it instead of the sine waves */
+    uint32_t seq;
+    if (sensor_replay_latest(SENSOR_REPLAY_BMI270, out_sample, &seq)) {
+        out_sample->sample_count = seq;
+        return true;
+    }
+
+    double t = (double)tick * 0.02;   /* ~50 Hz virtual sample rate */
+    synth_sample(t, out_sample);
 
     out_sample->sample_count = tick;
     tick++;
@@ -49,3 +127,29 @@ cy_rslt_t bmi270_reader_get_last_error(void)
 {
     return CY_RSLT_SUCCESS;
 }
+
+size_t bmi270_reader_read_fifo(bmi270_sample_t *buf, size_t max)
+{
+    if (!buf) return 0;
+
+    fifo_fill();
+
+    size_t n = (fifo.count < max) ? fifo.count : max;
+    for (size_t i = 0; i < n; i++) {
+        buf[i] = fifo.ring[fifo.head];
+        fifo.head = (fifo.head + 1U) % BMI270_FIFO_DEPTH;
+    }
+    fifo.count -= (uint32_t)n;
+    return n;
+}
+
+uint32_t bmi270_reader_get_fifo_odr_hz(void)
+{
+    uint32_t replay_hz = sensor_replay_rate_hz(SENSOR_REPLAY_BMI270);
+    return replay_hz ? replay_hz : BMI270_FIFO_ODR_HZ;
+}
+
+uint32_t bmi270_reader_get_fifo_overruns(void)
+{
+    return fifo.overruns;
+}
@@ -4,6 +4,7 @@
  ******************************************************************************/
 #include <math.h>
 #include "bmm350_reader.h"
+#include "../sensor_replay.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -16,6 +17,7 @@ cy_rslt_t bmm350_reader_init(I3C_CORE_Type *i3c_hw, cy_stc_i3c_context_t *i3c_co
     (void)i3c_hw;
     (void)i3c_context;
     tick = 0;
+    sensor_replay_rewind(SENSOR_REPLAY_BMM350);
     return CY_RSLT_SUCCESS;
 }
 
@@ -23,6 +25,13 @@ bool bmm350_reader_poll(bmm350_sample_t *out_sample)
 {
     if (!out_sample) return false;
 
+    /* Recorded trace loaded with --replay: serve it instead of the sine waves */
+    uint32_t seq;
+    if (sensor_replay_latest(SENSOR_REPLAY_BMM350, out_sample, &seq)) {
+        out_sample->sample_count = seq;
+        return true;
+    }
+
     double t = (double)tick * 0.02;
 
     /* Heading rotates slowly through 0-360 degrees */
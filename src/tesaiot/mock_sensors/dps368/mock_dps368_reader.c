@@ -4,6 +4,7 @@
  ******************************************************************************/
 #include <math.h>
 #include "dps368_reader.h"
+#include "../sensor_replay.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -15,6 +16,7 @@ cy_rslt_t dps368_reader_init(mtb_hal_i2c_t *i2c_bus)
 {
     (void)i2c_bus;
     tick = 0;
+    sensor_replay_rewind(SENSOR_REPLAY_DPS368);
     return CY_RSLT_SUCCESS;
 }
 
@@ -22,6 +24,13 @@ bool dps368_reader_poll(dps368_sample_t *out_sample)
 {
     if (!out_sample) return false;
 
+    /* Recorded trace loaded with --replay: serve it instead of the sine waves */
+    uint32_t seq;
+    if (sensor_replay_latest(SENSOR_REPLAY_DPS368, out_sample, &seq)) {
+        out_sample->sample_count = seq;
+        return true;
+    }
+
     double t = (double)tick * 0.02;
 
     out_sample->pressure_hpa    = 1013.25f + 0.5f * sinf((float)(t * 0.1));
@@ -0,0 +1,541 @@
+/*******************************************************************************
+ * @file    sensor_replay.c
+ * @brief   Recorded sensor trace replay — mmap'd binary / CSV capture,
+ *          lv_tick driven replay clock with speed factor, zero-copy access
+ ******************************************************************************/
+#include "sensor_replay.h"
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "lvgl.h"
+#include "dps368/dps368_types.h"
+#include "sht4x/sht4x_types.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define REPLAY_ALIGN(x)    (((x) + 7U) & ~(uint64_t)7U)
+
+typedef struct
+{
+    const uint64_t *ts_us;      /* [count] capture timestamps */
+    const uint8_t  *data;       /* [count * size] samples */
+    uint32_t        count;
+    uint32_t        size;
+    uint64_t        loop_us;    /* length of one pass incl. one sample period */
+    uint64_t        base_us;    /* replay clock time of ts_us[0] in this pass */
+    uint32_t        next;       /* first sample of this pass not yet due */
+    uint64_t        served;     /* samples due so far, across passes */
+    uint64_t        taken;      /* samples handed out by sensor_replay_take() */
+
+    /* CSV import only: heap copies owned by the stream */
+    uint64_t       *own_ts;
+    uint8_t        *own_data;
+    uint32_t        own_cap;
+} replay_stream_t;
+
+static const char *const k_sensor_name[SENSOR_REPLAY_SENSOR_COUNT] = {
+    "bmi270", "bmm350", "dps368", "sht4x"
+};
+
+static const uint32_t k_sample_size[SENSOR_REPLAY_SENSOR_COUNT] = {
+    sizeof(bmi270_sample_t), sizeof(bmm350_sample_t),
+    sizeof(dps368_sample_t), sizeof(sht4x_sample_t)
+};
+
+static replay_stream_t s_streams[SENSOR_REPLAY_SENSOR_COUNT];
+static void           *s_file_mem = NULL;   /* mapped (or read) binary capture */
+static size_t          s_file_size = 0;
+
+static float    s_speed = 1.0f;
+static double   s_clock_us = 0.0;
+static uint32_t s_last_tick = 0;
+static bool     s_clock_started = false;
+
+/* ── Replay clock ─────────────────────────────────────── */
+
+/* Starts on first use so the capture begins when the example first polls */
+static uint64_t replay_now_us(void)
+{
+    uint32_t tick = lv_tick_get();
+    if (!s_clock_started) {
+        s_clock_started = true;
+        s_last_tick = tick;
+    }
+    s_clock_us += (double)lv_tick_diff(tick, s_last_tick) * 1000.0 * (double)s_speed;
+    s_last_tick = tick;
+    return (uint64_t)s_clock_us;
+}
+
+static void stream_reset(replay_stream_t *st, uint64_t now_us)
+{
+    st->base_us = now_us;
+    st->next = 0;
+    st->served = 0;
+    st->taken = 0;
+}
+
+static void stream_prepare(replay_stream_t *st)
+{
+    uint64_t span = st->ts_us[st->count - 1] - st->ts_us[0];
+    uint64_t step = (st->count > 1) ? span / (st->count - 1) : 0;
+    st->loop_us = span + step;
+    if (st->loop_us == 0) st->loop_us = 1000;   /* single sample / same stamp */
+    stream_reset(st, s_clock_started ? (uint64_t)s_clock_us : 0);
+}
+
+/* Mark every sample whose timestamp has been reached as due */
+static void stream_advance(replay_stream_t *st, uint64_t now_us)
+{
+    if (now_us < st->base_us) return;
+
+    uint64_t rel = now_us - st->base_us;
+    if (rel >= st->loop_us) {
+        uint64_t passes = rel / st->loop_us;
+        st->served += (uint64_t)(st->count - st->next) + (passes - 1) * st->count;
+        st->next = 0;
+        st->base_us += passes * st->loop_us;
+        rel -= passes * st->loop_us;
+    }
+
+    uint64_t t0 = st->ts_us[0];
+    while (st->next < st->count && st->ts_us[st->next] - t0 <= rel) {
+        st->next++;
+        st->served++;
+    }
+}
+
+static replay_stream_t *stream_get(sensor_replay_sensor_t sensor)
+{
+    if ((unsigned)sensor >= SENSOR_REPLAY_SENSOR_COUNT) return NULL;
+    replay_stream_t *st = &s_streams[sensor];
+    return st->count ? st : NULL;
+}
+
+/* ── Binary capture ───────────────────────────────────── */
+
+static bool file_map(const char *path)
+{
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat sb;
+    if (fstat(fd, &sb) != 0 || sb.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    void *mem = mmap(NULL, (size_t)sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) return false;
+
+    s_file_mem = mem;
+    s_file_size = (size_t)sb.st_size;
+    return true;
+#else
+    /* No mmap() on MinGW: read the capture into one buffer instead */
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    void *mem = (size > 0) ? malloc((size_t)size) : NULL;
+    if (!mem || fread(mem, 1, (size_t)size, f) != (size_t)size) {
+        free(mem);
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+
+    s_file_mem = mem;
+    s_file_size = (size_t)size;
+    return true;
+#endif
+}
+
+static void file_unmap(void)
+{
+    if (!s_file_mem) return;
+#ifndef _WIN32
+    munmap(s_file_mem, s_file_size);
+#else
+    free(s_file_mem);
+#endif
+    s_file_mem = NULL;
+    s_file_size = 0;
+}
+
+static bool range_ok(uint64_t offset, uint64_t len)
+{
+    return (offset % 8U) == 0 && offset <= s_file_size && len <= s_file_size - offset;
+}
+
+static bool load_binary(const char *path)
+{
+    if (!file_map(path)) {
+        fprintf(stderr, "sensor_replay: cannot read %s\n", path);
+        return false;
+    }
+
+    const uint8_t *base = s_file_mem;
+    const sensor_replay_file_header_t *hdr = s_file_mem;
+    if (s_file_size < sizeof(*hdr) ||
+        memcmp(hdr->magic, SENSOR_REPLAY_MAGIC, sizeof(hdr->magic)) != 0 ||
+        hdr->version != SENSOR_REPLAY_VERSION ||
+        !range_ok(sizeof(*hdr), (uint64_t)hdr->stream_count * sizeof(sensor_replay_stream_header_t))) {
+        fprintf(stderr, "sensor_replay: %s is not a version %u capture\n", path, SENSOR_REPLAY_VERSION);
+        return false;
+    }
+
+    const sensor_replay_stream_header_t *sh = (const void *)(base + sizeof(*hdr));
+    for (uint32_t i = 0; i < hdr->stream_count; i++, sh++) {
+        if (sh->sensor >= SENSOR_REPLAY_SENSOR_COUNT || sh->count == 0 ||
+            sh->sample_size != k_sample_size[sh->sensor] ||
+            s_streams[sh->sensor].count != 0 ||
+            !range_ok(sh->ts_offset, (uint64_t)sh->count * sizeof(uint64_t)) ||
+            !range_ok(sh->data_offset, (uint64_t)sh->count * sh->sample_size)) {
+            fprintf(stderr, "sensor_replay: %s: bad stream header %u\n", path, (unsigned)i);
+            return false;
+        }
+
+        replay_stream_t *st = &s_streams[sh->sensor];
+        st->ts_us = (const uint64_t *)(const void *)(base + sh->ts_offset);
+        st->data = base + sh->data_offset;
+        st->count = sh->count;
+        st->size = sh->sample_size;
+
+        for (uint32_t k = 1; k < st->count; k++) {
+            if (st->ts_us[k] < st->ts_us[k - 1]) {
+                fprintf(stderr, "sensor_replay: %s: %s timestamps go backwards at sample %u\n",
+                        path, k_sensor_name[sh->sensor], (unsigned)k);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* ── CSV import ───────────────────────────────────────── */
+
+static bool csv_append(replay_stream_t *st, sensor_replay_sensor_t sensor, uint64_t ts, const float *v)
+{
+    if (st->count == st->own_cap) {
+        uint32_t cap = st->own_cap ? st->own_cap * 2U : 1024U;
+        uint64_t *ts_arr = realloc(st->own_ts, (size_t)cap * sizeof(uint64_t));
+        if (ts_arr) st->own_ts = ts_arr;
+        uint8_t *data = realloc(st->own_data, (size_t)cap * k_sample_size[sensor]);
+        if (data) st->own_data = data;
+        if (!ts_arr || !data) return false;
+        st->own_cap = cap;
+    }
+
+    uint8_t *slot = st->own_data + (size_t)st->count * k_sample_size[sensor];
+    switch (sensor) {
+        case SENSOR_REPLAY_BMI270: {
+            bmi270_sample_t *s = (bmi270_sample_t *)(void *)slot;
+            s->acc_g_x = v[0];
+            s->acc_g_y = v[1];
+            s->acc_g_z = v[2];
+            s->gyr_dps_x = v[3];
+            s->gyr_dps_y = v[4];
+            s->gyr_dps_z = v[5];
+            s->acc_mag_g = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+            s->gyr_mag_dps = sqrtf(v[3] * v[3] + v[4] * v[4] + v[5] * v[5]);
+            s->sample_count = st->count;
+            break;
+        }
+        case SENSOR_REPLAY_BMM350: {
+            bmm350_sample_t *s = (bmm350_sample_t *)(void *)slot;
+            s->x_ut = v[0];
+            s->y_ut = v[1];
+            s->z_ut = v[2];
+            s->temperature_c = v[3];
+            s->heading_deg = atan2f(v[1], v[0]) * (float)(180.0 / M_PI);
+            if (s->heading_deg < 0.0f) s->heading_deg += 360.0f;
+            s->field_strength_ut = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+            s->sample_count = st->count;
+            break;
+        }
+        case SENSOR_REPLAY_DPS368: {
+            dps368_sample_t *s = (dps368_sample_t *)(void *)slot;
+            s->pressure_hpa = v[0];
+            s->temperature_c = v[1];
+            s->sample_count = st->count;
+            break;
+        }
+        case SENSOR_REPLAY_SHT4X: {
+            sht4x_sample_t *s = (sht4x_sample_t *)(void *)slot;
+            s->temperature_c = v[0];
+            s->humidity_rh = v[1];
+            s->sample_count = st->count;
+            break;
+        }
+        default:
+            return false;
+    }
+
+    st->own_ts[st->count] = ts;
+    st->count++;
+    return true;
+}
+
+static bool load_csv(const char *path)
+{
+    static const uint32_t k_value_cnt[SENSOR_REPLAY_SENSOR_COUNT] = { 6, 4, 2, 2 };
+
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "sensor_replay: cannot read %s\n", path);
+        return false;
+    }
+
+    char line[256];
+    uint32_t line_no = 0;
+    bool ok = true;
+
+    while (ok && fgets(line, sizeof(line), f)) {
+        line_no++;
+        const char *p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        /* Comments, blank lines and a column header line */
+        if (!isdigit((unsigned char)*p)) continue;
+
+        char *end = NULL;
+        uint64_t ts = strtoull(p, &end, 10);
+        ok = (*end == ',');
+        p = end + 1;
+
+        int sensor = -1;
+        for (int i = 0; ok && i < SENSOR_REPLAY_SENSOR_COUNT; i++) {
+            size_t len = strlen(k_sensor_name[i]);
+            if (strncmp(p, k_sensor_name[i], len) == 0 && p[len] == ',') {
+                sensor = i;
+                p += len + 1;
+            }
+        }
+        ok = ok && sensor >= 0;
+
+        float v[6] = { 0 };
+        for (uint32_t i = 0; ok && i < k_value_cnt[sensor]; i++) {
+            v[i] = strtof(p, &end);
+            ok = (end != p) && (*end == ',' || i + 1 == k_value_cnt[sensor]);
+            p = end + 1;
+        }
+
+        if (ok) {
+            replay_stream_t *st = &s_streams[sensor];
+            if (st->count && ts < st->own_ts[st->count - 1]) {
+                fprintf(stderr, "sensor_replay: %s:%u: timestamp goes backwards\n", path, (unsigned)line_no);
+                ok = false;
+            }
+            else if (!csv_append(st, (sensor_replay_sensor_t)sensor, ts, v)) {
+                fprintf(stderr, "sensor_replay: out of memory\n");
+                ok = false;
+            }
+        }
+        else {
+            fprintf(stderr, "sensor_replay: %s:%u: malformed line\n", path, (unsigned)line_no);
+        }
+    }
+    fclose(f);
+
+    for (int i = 0; i < SENSOR_REPLAY_SENSOR_COUNT; i++) {
+        replay_stream_t *st = &s_streams[i];
+        st->ts_us = st->own_ts;
+        st->data = st->own_data;
+        st->size = k_sample_size[i];
+    }
+    return ok;
+}
+
+/* Zero-pad up to offset (< 8 bytes), then write len bytes */
+static bool write_at(FILE *f, uint64_t *pos, uint64_t offset, const void *data, size_t len)
+{
+    static const uint8_t pad[8] = { 0 };
+    size_t pad_len = (size_t)(offset - *pos);
+    if (pad_len && fwrite(pad, 1, pad_len, f) != pad_len) return false;
+    if (len && fwrite(data, 1, len, f) != len) return false;
+    *pos = offset + len;
+    return true;
+}
+
+/* ── Public API ───────────────────────────────────────── */
+
+bool sensor_replay_open(const char *path)
+{
+    sensor_replay_close();
+
+    size_t len = strlen(path);
+    bool csv = len > 4 && (strcmp(path + len - 4, ".csv") == 0 || strcmp(path + len - 4, ".CSV") == 0);
+    bool ok = csv ? load_csv(path) : load_binary(path);
+
+    uint32_t total = 0;
+    for (int i = 0; ok && i < SENSOR_REPLAY_SENSOR_COUNT; i++) {
+        replay_stream_t *st = &s_streams[i];
+        if (!st->count) continue;
+        stream_prepare(st);
+        total += st->count;
+        printf("sensor_replay: %-6s %u samples, %.3f s\n", k_sensor_name[i], (unsigned)st->count,
+               (double)st->loop_us / 1e6);
+    }
+
+    if (ok && total == 0) {
+        fprintf(stderr, "sensor_replay: %s has no samples\n", path);
+        ok = false;
+    }
+    if (!ok) sensor_replay_close();
+    return ok;
+}
+
+void sensor_replay_close(void)
+{
+    for (int i = 0; i < SENSOR_REPLAY_SENSOR_COUNT; i++) {
+        free(s_streams[i].own_ts);
+        free(s_streams[i].own_data);
+    }
+    memset(s_streams, 0, sizeof(s_streams));
+    file_unmap();
+}
+
+bool sensor_replay_save(const char *path)
+{
+    sensor_replay_file_header_t hdr;
+    sensor_replay_stream_header_t sh[SENSOR_REPLAY_SENSOR_COUNT];
+    memset(&hdr, 0, sizeof(hdr));
+    memset(sh, 0, sizeof(sh));
+    memcpy(hdr.magic, SENSOR_REPLAY_MAGIC, sizeof(hdr.magic));
+    hdr.version = SENSOR_REPLAY_VERSION;
+
+    for (int i = 0; i < SENSOR_REPLAY_SENSOR_COUNT; i++) {
+        if (s_streams[i].count) hdr.stream_count++;
+    }
+
+    uint64_t offset = REPLAY_ALIGN(sizeof(hdr) + hdr.stream_count * sizeof(sh[0]));
+    uint32_t n = 0;
+    for (int i = 0; i < SENSOR_REPLAY_SENSOR_COUNT; i++) {
+        const replay_stream_t *st = &s_streams[i];
+        if (!st->count) continue;
+        sh[n].sensor = (uint32_t)i;
+        sh[n].sample_size = st->size;
+        sh[n].count = st->count;
+        sh[n].ts_offset = offset;
+        offset = REPLAY_ALIGN(offset + (uint64_t)st->count * sizeof(uint64_t));
+        sh[n].data_offset = offset;
+        offset = REPLAY_ALIGN(offset + (uint64_t)st->count * st->size);
+        n++;
+    }
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        fprintf(stderr, "sensor_replay: cannot write %s\n", path);
+        return false;
+    }
+
+    uint64_t pos = 0;
+    bool ok = write_at(f, &pos, 0, &hdr, sizeof(hdr)) &&
+              write_at(f, &pos, pos, sh, n * sizeof(sh[0]));
+
+    for (uint32_t k = 0; ok && k < n; k++) {
+        const replay_stream_t *st = &s_streams[sh[k].sensor];
+        ok = write_at(f, &pos, sh[k].ts_offset, st->ts_us, (size_t)st->count * sizeof(uint64_t)) &&
+             write_at(f, &pos, sh[k].data_offset, st->data, (size_t)st->count * st->size);
+    }
+
+    if (fclose(f) != 0) ok = false;
+    if (!ok) fprintf(stderr, "sensor_replay: error writing %s\n", path);
+    return ok;
+}
+
+void sensor_replay_set_speed(float speed)
+{
+    if (speed > 0.0f) {
+        if (s_clock_started) replay_now_us();   /* time so far at the old speed */
+        s_speed = speed;
+    }
+}
+
+bool sensor_replay_active(sensor_replay_sensor_t sensor)
+{
+    return stream_get(sensor) != NULL;
+}
+
+uint32_t sensor_replay_rate_hz(sensor_replay_sensor_t sensor)
+{
+    replay_stream_t *st = stream_get(sensor);
+    if (!st) return 0;
+    return (uint32_t)(((uint64_t)st->count * 1000000U + st->loop_us / 2) / st->loop_us);
+}
+
+void sensor_replay_rewind(sensor_replay_sensor_t sensor)
+{
+    replay_stream_t *st = stream_get(sensor);
+    if (st) stream_reset(st, replay_now_us());
+}
+
+bool sensor_replay_latest(sensor_replay_sensor_t sensor, void *out, uint32_t *seq)
+{
+    replay_stream_t *st = stream_get(sensor);
+    if (!st || !out) return false;
+
+    stream_advance(st, replay_now_us());
+
+    uint64_t last = st->served ? st->served - 1 : 0;
+    memcpy(out, st->data + (size_t)(last % st->count) * st->size, st->size);
+    if (seq) *seq = (uint32_t)last;
+    return true;
+}
+
+const void *sensor_replay_take(sensor_replay_sensor_t sensor, uint32_t *count, uint32_t *dropped)
+{
+    replay_stream_t *st = stream_get(sensor);
+    if (dropped) *dropped = 0;
+    if (!st) {
+        *count = 0;
+        return NULL;
+    }
+
+    stream_advance(st, replay_now_us());
+
+    uint64_t pending = st->served - st->taken;
+    if (pending > st->count) {
+        if (dropped) *dropped = (uint32_t)(pending - st->count);
+        st->taken = st->served - st->count;
+        pending = st->count;
+    }
+
+    uint32_t start = (uint32_t)(st->taken % st->count);
+    uint32_t n = st->count - start;
+    if (pending < n) n = (uint32_t)pending;
+    st->taken += n;
+
+    *count = n;
+    return st->data + (size_t)start * st->size;
+}
+
+const bmi270_sample_t *sensor_replay_bmi270_samples(uint32_t *count)
+{
+    replay_stream_t *st = stream_get(SENSOR_REPLAY_BMI270);
+    *count = st ? st->count : 0;
+    return st ? (const bmi270_sample_t *)(const void *)st->data : NULL;
+}
+
+const bmm350_sample_t *sensor_replay_bmm350_samples(uint32_t *count)
+{
+    replay_stream_t *st = stream_get(SENSOR_REPLAY_BMM350);
+    *count = st ? st->count : 0;
+    return st ? (const bmm350_sample_t *)(const void *)st->data : NULL;
+}
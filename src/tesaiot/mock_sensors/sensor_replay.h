@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * @file    sensor_replay.h
+ * @brief   Recorded sensor trace replay behind the mock *_reader_poll()
+ *
+ * When a capture is loaded, the mock readers serve its samples instead of
+ * the synthetic sine waves: *_reader_poll() returns the newest sample whose
+ * timestamp has been reached on the replay clock. That clock follows
+ * lv_tick (so headless runs on the virtual tick are deterministic), scaled
+ * by the replay speed. A capture loops when its last sample is reached.
+ *
+ * Two input formats:
+ *
+ *   Binary (.bin, anything not ending in .csv) — memory-mapped, zero-copy.
+ *   Native byte order, all offsets 8-byte aligned:
+ *     sensor_replay_file_header_t
+ *     sensor_replay_stream_header_t  [stream_count]
+ *     per stream: uint64_t ts_us[count], <sensor>_sample_t samples[count]
+ *
+ *   CSV (.csv) — one sample per line, '#' starts a comment:
+ *     t_us,bmi270,acc_x_g,acc_y_g,acc_z_g,gyr_x_dps,gyr_y_dps,gyr_z_dps
+ *     t_us,bmm350,x_ut,y_ut,z_ut,temperature_c
+ *     t_us,dps368,pressure_hpa,temperature_c
+ *     t_us,sht4x,temperature_c,humidity_rh
+ *   Derived fields (magnitudes, heading, field strength) are computed on
+ *   import. sensor_replay_save() converts a loaded capture to binary.
+ *
+ * Launcher options (sim_main.c):
+ *   --replay=FILE  --replay-speed=X  --replay-export=OUT.bin
+ ******************************************************************************/
+#ifndef SENSOR_REPLAY_H
+#define SENSOR_REPLAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bmi270/bmi270_types.h"
+#include "bmm350/bmm350_types.h"
+
+#define SENSOR_REPLAY_MAGIC       "TSREPLAY"
+#define SENSOR_REPLAY_VERSION     (1U)
+
+typedef enum
+{
+    SENSOR_REPLAY_BMI270 = 0,
+    SENSOR_REPLAY_BMM350,
+    SENSOR_REPLAY_DPS368,
+    SENSOR_REPLAY_SHT4X,
+    SENSOR_REPLAY_SENSOR_COUNT
+} sensor_replay_sensor_t;
+
+typedef struct
+{
+    char     magic[8];          /* SENSOR_REPLAY_MAGIC, not NUL terminated */
+    uint32_t version;           /* SENSOR_REPLAY_VERSION */
+    uint32_t stream_count;
+} sensor_replay_file_header_t;
+
+typedef struct
+{
+    uint32_t sensor;            /* sensor_replay_sensor_t */
+    uint32_t sample_size;       /* sizeof(<sensor>_sample_t) of the writer */
+    uint32_t count;
+    uint32_t reserved;
+    uint64_t ts_offset;         /* file offset of uint64_t ts_us[count] */
+    uint64_t data_offset;       /* file offset of the sample array */
+} sensor_replay_stream_header_t;
+
+/* Load a capture (binary or CSV, see above), replacing any loaded one.
+ * Returns false and prints the reason to stderr on failure. */
+bool sensor_replay_open(const char *path);
+
+void sensor_replay_close(void);
+
+/* Write the loaded capture in the binary format */
+bool sensor_replay_save(const char *path);
+
+/* Replay speed factor: 1.0 = recorded timestamps, 4.0 = 4x faster */
+void sensor_replay_set_speed(float speed);
+
+/* true if the loaded capture has samples for this sensor */
+bool sensor_replay_active(sensor_replay_sensor_t sensor);
+
+/* Average sample rate of a replayed sensor, 0 if not replayed */
+uint32_t sensor_replay_rate_hz(sensor_replay_sensor_t sensor);
+
+/* Restart one sensor's stream from its first sample at the current time */
+void sensor_replay_rewind(sensor_replay_sensor_t sensor);
+
+/*
+ * Copy the newest due sample into out (sizeof(<sensor>_sample_t) bytes).
+ * seq receives the running sample number, counted across loops.
+ * Returns false if the sensor is not replayed.
+ */
+bool sensor_replay_latest(sensor_replay_sensor_t sensor, void *out, uint32_t *seq);
+
+/*
+ * Zero-copy access to the samples that became due since the previous call.
+ * Returns a pointer into the capture and the number of consecutive samples
+ * in *count; call again until *count is 0 (the data may wrap at the loop
+ * end). If the reader falls more than a whole capture behind, the oldest
+ * samples are skipped and counted in *dropped (may be NULL).
+ */
+const void *sensor_replay_take(sensor_replay_sensor_t sensor, uint32_t *count, uint32_t *dropped);
+
+/* The complete recorded arrays (NULL / 0 if the sensor is not replayed) */
+const bmi270_sample_t *sensor_replay_bmi270_samples(uint32_t *count);
+const bmm350_sample_t *sensor_replay_bmm350_samples(uint32_t *count);
+
+#endif /* SENSOR_REPLAY_H */
@@ -4,6 +4,7 @@
  ******************************************************************************/
 #include <math.h>
 #include "sht4x_reader.h"
+#include "../sensor_replay.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -15,6 +16,7 @@ cy_rslt_t sht4x_reader_init(mtb_hal_i2c_t *i2c_bus)
 {
     (void)i2c_bus;
     tick = 0;
+    sensor_replay_rewind(SENSOR_REPLAY_SHT4X);
     return CY_RSLT_SUCCESS;
 }
 
@@ -22,6 +24,13 @@ bool sht4x_reader_poll(sht4x_sample_t *out_sample)
 {
     if (!out_sample) return false;
 
+    /* Recorded trace loaded with --replay: serve it instead of the sine waves */
+    uint32_t seq;
+    if (sensor_replay_latest(SENSOR_REPLAY_SHT4X, out_sample, &seq)) {
+        out_sample->sample_count = seq;
+        return true;
+    }
+
     double t = (double)tick * 0.02;
 
     out_sample->temperature_c = 26.0f + 1.0f * sinf((float)(t * 0.08));
@@ -0,0 +1,696 @@
+/*******************************************************************************
+ * @file    nor_log.c
+ * @brief   Log-structured key/value + append-log store on emulated NOR flash
+ ******************************************************************************/
+#include "nor_log.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define SECTOR_MAGIC        (0x31534C4EU)   /* "NLS1" */
+#define BATCH_MAGIC         (0x31424C4EU)   /* "NLB1" */
+#define ERASED_WORD         (0xFFFFFFFFU)
+#define SECTOR_HDR_SIZE     (16U)
+#define BATCH_HDR_SIZE      (12U)
+#define RECORD_HDR_SIZE     (4U)
+#define ALIGN4(n)           (((n) + 3U) & ~3U)
+
+#if (NOR_LOG_STAGE_SIZE + BATCH_HDR_SIZE + SECTOR_HDR_SIZE) > NOR_LOG_SECTOR_SIZE
+#error "NOR_LOG_STAGE_SIZE must leave room for the sector and batch headers"
+#endif
+
+enum
+{
+    REC_PUT = 1,
+    REC_DEL = 2,
+    REC_APPEND = 3,
+};
+
+typedef struct
+{
+    uint32_t  magic;
+    uint32_t  erase_count;
+    uint32_t  seq;          /* ERASED_WORD while the sector is free */
+    uint32_t  reserved;
+} sector_hdr_t;
+
+typedef struct
+{
+    uint32_t  magic;
+    uint32_t  len;          /* payload bytes, a multiple of 4 */
+    uint32_t  crc;          /* crc32 of the payload */
+} batch_hdr_t;
+
+/* Called for each record of a valid batch; value_addr is a flash offset. */
+typedef void (*record_fn_t)(nor_log_t *log, uint8_t kind, const char *key,
+                            uint32_t key_len, uint32_t value_addr,
+                            uint32_t value_len, void *ctx);
+
+/* ── CRC32 (IEEE, reflected) ──────────────────────────── */
+
+static uint32_t s_crc_table[256];
+static bool s_crc_ready = false;
+
+static uint32_t crc32_calc(const uint8_t *data, uint32_t len)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+
+    if (!s_crc_ready) {
+        for (uint32_t i = 0; i < 256U; i++) {
+            uint32_t c = i;
+            for (uint32_t k = 0; k < 8U; k++) {
+                c = (c & 1U) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+            }
+            s_crc_table[i] = c;
+        }
+        s_crc_ready = true;
+    }
+
+    for (uint32_t i = 0; i < len; i++) {
+        crc = s_crc_table[(crc ^ data[i]) & 0xFFU] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFU;
+}
+
+static uint32_t now_us(void)
+{
+#if defined(_WIN32)
+    return (uint32_t)((uint64_t)clock() * 1000000U / CLOCKS_PER_SEC);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U);
+#endif
+}
+
+/* ── Backing file ─────────────────────────────────────── */
+
+/* Returns true when the image is new (or resized) and must be formatted. */
+static bool image_map(nor_log_t *log, const char *path)
+{
+#if defined(_WIN32)
+    FILE *fp = fopen(path, "r+b");
+    bool fresh = false;
+
+    if (fp == NULL) {
+        fp = fopen(path, "w+b");
+    }
+    log->flash = (fp != NULL) ? malloc(log->size) : NULL;
+    if (log->flash == NULL) {
+        if (fp != NULL) fclose(fp);
+        return false;
+    }
+    if (fread(log->flash, 1, log->size, fp) != log->size) {
+        fresh = true;
+    }
+    log->file = fp;
+    return fresh;
+#else
+    struct stat st;
+    bool fresh;
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+
+    if (fd < 0) {
+        return false;
+    }
+    fresh = (fstat(fd, &st) != 0) || ((uint32_t)st.st_size != log->size);
+    if (fresh && ftruncate(fd, (off_t)log->size) != 0) {
+        close(fd);
+        return false;
+    }
+    log->flash = mmap(NULL, log->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (log->flash == MAP_FAILED) {
+        log->flash = NULL;
+        close(fd);
+        return false;
+    }
+    log->file = (void *)(intptr_t)(fd + 1);
+    return fresh;
+#endif
+}
+
+static void image_sync(nor_log_t *log, uint32_t addr, uint32_t len)
+{
+#if defined(_WIN32)
+    FILE *fp = (FILE *)log->file;
+    if (fseek(fp, (long)addr, SEEK_SET) == 0) {
+        (void)fwrite(log->flash + addr, 1, len, fp);
+        (void)fflush(fp);
+    }
+#else
+    /* MAP_SHARED: the page cache already holds the write. */
+    (void)log;
+    (void)addr;
+    (void)len;
+#endif
+}
+
+static void image_unmap(nor_log_t *log)
+{
+#if defined(_WIN32)
+    fclose((FILE *)log->file);
+    free(log->flash);
+#else
+    (void)msync(log->flash, log->size, MS_SYNC);
+    (void)munmap(log->flash, log->size);
+    close((int)(intptr_t)log->file - 1);
+#endif
+    log->flash = NULL;
+    log->file = NULL;
+}
+
+/* ── NOR primitives ───────────────────────────────────── */
+
+static void flash_program(nor_log_t *log, uint32_t addr, const void *src, uint32_t len)
+{
+    const uint8_t *in = (const uint8_t *)src;
+
+    for (uint32_t i = 0; i < len; i++) {
+        uint8_t v = log->flash[addr + i] & in[i];
+        if (v != in[i]) {
+            log->stats.program_faults++;
+        }
+        log->flash[addr + i] = v;
+    }
+    log->stats.flash_bytes += len;
+    image_sync(log, addr, len);
+}
+
+static sector_hdr_t sector_hdr(const nor_log_t *log, uint32_t sector)
+{
+    sector_hdr_t hdr;
+    memcpy(&hdr, log->flash + sector * NOR_LOG_SECTOR_SIZE, sizeof(hdr));
+    return hdr;
+}
+
+static bool sector_is_free(const nor_log_t *log, uint32_t sector)
+{
+    sector_hdr_t hdr = sector_hdr(log, sector);
+    return (hdr.magic == SECTOR_MAGIC) && (hdr.seq == ERASED_WORD);
+}
+
+static bool sector_is_active(const nor_log_t *log, uint32_t sector)
+{
+    sector_hdr_t hdr = sector_hdr(log, sector);
+    return (hdr.magic == SECTOR_MAGIC) && (hdr.seq != ERASED_WORD);
+}
+
+static void flash_erase(nor_log_t *log, uint32_t sector)
+{
+    uint32_t base = sector * NOR_LOG_SECTOR_SIZE;
+    sector_hdr_t hdr = sector_hdr(log, sector);
+    uint32_t erase_count = (hdr.magic == SECTOR_MAGIC) ? hdr.erase_count : 0U;
+
+    memset(log->flash + base, 0xFF, NOR_LOG_SECTOR_SIZE);
+    image_sync(log, base, NOR_LOG_SECTOR_SIZE);
+    log->stats.erases++;
+
+    hdr.magic = SECTOR_MAGIC;
+    hdr.erase_count = erase_count + 1U;
+    hdr.seq = ERASED_WORD;
+    hdr.reserved = ERASED_WORD;
+    flash_program(log, base, &hdr, sizeof(hdr));
+}
+
+/* ── Batch / record walking ───────────────────────────── */
+
+static void walk_records(nor_log_t *log, uint32_t payload_addr, uint32_t len,
+                         record_fn_t fn, void *ctx)
+{
+    const uint8_t *p = log->flash + payload_addr;
+    uint32_t off = 0;
+
+    while (off + RECORD_HDR_SIZE <= len) {
+        uint8_t kind = p[off];
+        uint32_t key_len = p[off + 1U];
+        uint32_t value_len = (uint32_t)p[off + 2U] | ((uint32_t)p[off + 3U] << 8);
+        uint32_t rec_len = RECORD_HDR_SIZE + key_len + value_len;
+
+        if (off + rec_len > len) {
+            break;
+        }
+        fn(log, kind, (const char *)(p + off + RECORD_HDR_SIZE), key_len,
+           payload_addr + off + RECORD_HDR_SIZE + key_len, value_len, ctx);
+        off += ALIGN4(rec_len);
+    }
+}
+
+/* Visit every valid batch of a sector and return the first free offset.
+ * The batch header is programmed before its payload, so a torn payload still
+ * has a usable length: it is counted in *torn and skipped. A damaged header
+ * leaves no way to find the next batch; the sector is then reported full.
+ * torn and batches may be NULL. */
+static uint32_t walk_sector(nor_log_t *log, uint32_t sector, record_fn_t fn,
+                            void *ctx, uint32_t *torn, uint32_t *batches)
+{
+    uint32_t base = sector * NOR_LOG_SECTOR_SIZE;
+    uint32_t off = SECTOR_HDR_SIZE;
+
+    while (off + BATCH_HDR_SIZE <= NOR_LOG_SECTOR_SIZE) {
+        batch_hdr_t bh;
+        memcpy(&bh, log->flash + base + off, sizeof(bh));
+
+        if ((bh.magic == ERASED_WORD) && (bh.len == ERASED_WORD)) {
+            break;                          /* free space starts here */
+        }
+        if ((bh.magic != BATCH_MAGIC) ||
+            (bh.len > NOR_LOG_SECTOR_SIZE - off - BATCH_HDR_SIZE)) {
+            if (torn != NULL) {
+                (*torn)++;
+            }
+            return NOR_LOG_SECTOR_SIZE;
+        }
+        if (crc32_calc(log->flash + base + off + BATCH_HDR_SIZE, bh.len) != bh.crc) {
+            if (torn != NULL) {
+                (*torn)++;
+            }
+        }
+        else {
+            if (fn != NULL) {
+                walk_records(log, base + off + BATCH_HDR_SIZE, bh.len, fn, ctx);
+            }
+            if (batches != NULL) {
+                (*batches)++;
+            }
+        }
+        off += BATCH_HDR_SIZE + ALIGN4(bh.len);
+    }
+    return off;
+}
+
+/* Active sectors, oldest first. Returns the count. */
+static uint32_t sectors_by_age(const nor_log_t *log, uint32_t *order)
+{
+    uint32_t n = 0;
+
+    for (uint32_t s = 0; s < log->sector_count; s++) {
+        uint32_t seq;
+        uint32_t i;
+
+        if (!sector_is_active(log, s)) {
+            continue;
+        }
+        seq = sector_hdr(log, s).seq;
+        for (i = n; (i > 0U) && (sector_hdr(log, order[i - 1U]).seq > seq); i--) {
+            order[i] = order[i - 1U];
+        }
+        order[i] = s;
+        n++;
+    }
+    return n;
+}
+
+/* ── Key index ────────────────────────────────────────── */
+
+static int find_key(const nor_log_t *log, const char *key, uint32_t key_len)
+{
+    for (uint32_t i = 0; i < log->key_count; i++) {
+        if ((strlen(log->keys[i].key) == key_len) &&
+            (memcmp(log->keys[i].key, key, key_len) == 0)) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static void index_record(nor_log_t *log, uint8_t kind, const char *key,
+                         uint32_t key_len, uint32_t value_addr,
+                         uint32_t value_len, void *ctx)
+{
+    int idx = find_key(log, key, key_len);
+    (void)ctx;
+
+    if (kind == REC_PUT) {
+        if (idx < 0) {
+            if (log->key_count >= NOR_LOG_MAX_KEYS) {
+                return;
+            }
+            idx = (int)log->key_count++;
+            memcpy(log->keys[idx].key, key, key_len);
+            log->keys[idx].key[key_len] = '\0';
+        }
+        log->keys[idx].addr = value_addr;
+        log->keys[idx].len = value_len;
+    }
+    else if ((kind == REC_DEL) && (idx >= 0)) {
+        log->keys[idx] = log->keys[--log->key_count];
+    }
+}
+
+static void count_append(nor_log_t *log, uint8_t kind, const char *key,
+                         uint32_t key_len, uint32_t value_addr,
+                         uint32_t value_len, void *ctx)
+{
+    (void)log; (void)key; (void)key_len; (void)value_addr; (void)value_len;
+    if (kind == REC_APPEND) {
+        (*(uint32_t *)ctx)++;
+    }
+}
+
+/* ── Writing ──────────────────────────────────────────── */
+
+static uint32_t put_record(uint8_t *dst, uint8_t kind, const char *key,
+                           uint32_t key_len, const void *value, uint32_t value_len)
+{
+    uint32_t rec_len = RECORD_HDR_SIZE + key_len + value_len;
+
+    dst[0] = kind;
+    dst[1] = (uint8_t)key_len;
+    dst[2] = (uint8_t)(value_len & 0xFFU);
+    dst[3] = (uint8_t)(value_len >> 8);
+    memcpy(dst + RECORD_HDR_SIZE, key, key_len);
+    if (value_len > 0U) {
+        memcpy(dst + RECORD_HDR_SIZE + key_len, value, value_len);
+    }
+    memset(dst + rec_len, 0, ALIGN4(rec_len) - rec_len);
+    return ALIGN4(rec_len);
+}
+
+/* Program one batch at the head (caller made room) and index it. */
+static void program_batch(nor_log_t *log, const uint8_t *payload, uint32_t len)
+{
+    uint32_t addr = log->head * NOR_LOG_SECTOR_SIZE + log->head_offset;
+    batch_hdr_t bh = { BATCH_MAGIC, len, crc32_calc(payload, len) };
+
+    /* Header first: a torn payload then fails its CRC instead of looking
+     * like free space that would be programmed over. */
+    flash_program(log, addr, &bh, sizeof(bh));
+    flash_program(log, addr + BATCH_HDR_SIZE, payload, len);
+    log->head_offset += BATCH_HDR_SIZE + len;
+    log->stats.batches++;
+
+    walk_records(log, addr + BATCH_HDR_SIZE, len, index_record, NULL);
+}
+
+/* Copy the live keys of the oldest sector to the head, then erase it. */
+static bool reclaim_sector(nor_log_t *log, uint32_t sector)
+{
+    uint8_t reloc[NOR_LOG_SECTOR_SIZE];
+    uint32_t lo = sector * NOR_LOG_SECTOR_SIZE;
+    uint32_t hi = lo + NOR_LOG_SECTOR_SIZE;
+    uint32_t len = 0;
+    uint32_t appends = 0;
+
+    for (uint32_t i = 0; i < log->key_count; i++) {
+        const nor_log_key_t *k = &log->keys[i];
+        uint32_t key_len = (uint32_t)strlen(k->key);
+
+        if ((k->addr < lo) || (k->addr >= hi)) {
+            continue;
+        }
+        if (len + ALIGN4(RECORD_HDR_SIZE + key_len + k->len) >
+            NOR_LOG_SECTOR_SIZE - BATCH_HDR_SIZE - log->head_offset) {
+            return false;
+        }
+        len += put_record(reloc + len, REC_PUT, k->key, key_len,
+                          log->flash + k->addr, k->len);
+        log->stats.relocated_bytes += key_len + k->len;
+    }
+
+    (void)walk_sector(log, sector, count_append, &appends, NULL, NULL);
+    log->stats.expired_appends += appends;
+
+    /* Live data reaches the head before its old copy is erased. */
+    if (len > 0U) {
+        program_batch(log, reloc, len);
+    }
+    flash_erase(log, sector);
+    return true;
+}
+
+/* Keep the sector after the head erased and ready. */
+static bool ensure_spare(nor_log_t *log)
+{
+    uint32_t spare = (log->head + 1U) % log->sector_count;
+
+    if (sector_is_active(log, spare)) {
+        return reclaim_sector(log, spare);
+    }
+    if (!sector_is_free(log, spare)) {
+        flash_erase(log, spare);
+    }
+    return true;
+}
+
+static void open_sector(nor_log_t *log, uint32_t sector)
+{
+    uint32_t seq = log->next_seq++;
+
+    flash_program(log, sector * NOR_LOG_SECTOR_SIZE + offsetof(sector_hdr_t, seq),
+                  &seq, sizeof(seq));
+    log->head = sector;
+    log->head_offset = SECTOR_HDR_SIZE;
+}
+
+static bool make_room(nor_log_t *log, uint32_t need)
+{
+    for (uint32_t tries = 0; log->head_offset + need > NOR_LOG_SECTOR_SIZE; tries++) {
+        uint32_t next = (log->head + 1U) % log->sector_count;
+
+        /* A spare that could not be reclaimed means live keys fill the image. */
+        if ((tries >= log->sector_count) || !sector_is_free(log, next)) {
+            return false;
+        }
+        open_sector(log, next);
+        if (!ensure_spare(log)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool stage_record(nor_log_t *log, uint8_t kind, const char *key,
+                         const void *value, uint32_t value_len)
+{
+    uint32_t key_len;
+    uint32_t rec_len;
+
+    if ((log == NULL) || (log->flash == NULL) || (key == NULL)) {
+        return false;
+    }
+    key_len = (uint32_t)strlen(key);
+    rec_len = ALIGN4(RECORD_HDR_SIZE + key_len + value_len);
+    if ((key_len == 0U) || (key_len > NOR_LOG_KEY_MAX_LEN) ||
+        (rec_len > NOR_LOG_STAGE_SIZE)) {
+        return false;
+    }
+    if ((kind == REC_PUT) && (find_key(log, key, key_len) < 0) &&
+        (log->key_count >= NOR_LOG_MAX_KEYS)) {
+        return false;
+    }
+    if ((log->stage_len + rec_len > NOR_LOG_STAGE_SIZE) && !nor_log_commit(log)) {
+        return false;
+    }
+
+    log->stage_len += put_record(log->stage + log->stage_len, kind, key, key_len,
+                                 value, value_len);
+    log->stage_user_bytes += key_len + value_len;
+    return true;
+}
+
+/* ── Public API ───────────────────────────────────────── */
+
+bool nor_log_open(nor_log_t *log, const char *path, uint32_t sector_count)
+{
+    uint32_t *order;
+    uint32_t active;
+    uint32_t t0 = now_us();
+
+    if ((log == NULL) || (path == NULL) || (sector_count < NOR_LOG_MIN_SECTORS)) {
+        return false;
+    }
+
+    memset(log, 0, sizeof(*log));
+    log->sector_count = sector_count;
+    log->size = sector_count * NOR_LOG_SECTOR_SIZE;
+    log->next_seq = 1U;
+
+    order = malloc(sector_count * sizeof(uint32_t));
+    if (order == NULL) {
+        return false;
+    }
+    if (image_map(log, path)) {
+        memset(log->flash, 0xFF, log->size);  /* blank part, as shipped */
+        image_sync(log, 0U, log->size);
+    }
+    if (log->flash == NULL) {
+        free(order);
+        return false;
+    }
+
+    active = sectors_by_age(log, order);
+    for (uint32_t i = 0; i < active; i++) {
+        log->head = order[i];
+        log->head_offset = walk_sector(log, order[i], index_record, NULL,
+                                       &log->stats.torn_batches,
+                                       &log->stats.recovered_batches);
+    }
+
+    if (active == 0U) {
+        if (!sector_is_free(log, 0U)) {
+            flash_erase(log, 0U);
+        }
+        open_sector(log, 0U);
+    }
+    else {
+        log->next_seq = sector_hdr(log, log->head).seq + 1U;
+    }
+    free(order);
+
+    /* Finishes a reclaim that was cut short before its erase. */
+    (void)ensure_spare(log);
+
+    /* Recovery itself is not user traffic. */
+    log->stats.flash_bytes = 0U;
+    log->stats.recovery_us = now_us() - t0;
+    return true;
+}
+
+void nor_log_close(nor_log_t *log)
+{
+    if ((log == NULL) || (log->flash == NULL)) {
+        return;
+    }
+    (void)nor_log_commit(log);
+    image_unmap(log);
+}
+
+bool nor_log_put(nor_log_t *log, const char *key, const void *value, uint32_t len)
+{
+    return stage_record(log, REC_PUT, key, value, len);
+}
+
+bool nor_log_delete(nor_log_t *log, const char *key)
+{
+    return stage_record(log, REC_DEL, key, NULL, 0U);
+}
+
+bool nor_log_append(nor_log_t *log, const char *stream, const void *data, uint32_t len)
+{
+    return stage_record(log, REC_APPEND, stream, data, len);
+}
+
+bool nor_log_commit(nor_log_t *log)
+{
+    if ((log == NULL) || (log->flash == NULL)) {
+        return false;
+    }
+    if (log->stage_len == 0U) {
+        return true;
+    }
+    if (!make_room(log, BATCH_HDR_SIZE + log->stage_len)) {
+        return false;
+    }
+
+    program_batch(log, log->stage, log->stage_len);
+    log->stats.user_bytes += log->stage_user_bytes;
+    log->stage_len = 0U;
+    log->stage_user_bytes = 0U;
+    return true;
+}
+
+bool nor_log_get(const nor_log_t *log, const char *key, void *out,
+                 uint32_t max_len, uint32_t *out_len)
+{
+    int idx;
+    uint32_t n;
+
+    if ((log == NULL) || (log->flash == NULL) || (key == NULL)) {
+        return false;
+    }
+    idx = find_key(log, key, (uint32_t)strlen(key));
+    if (idx < 0) {
+        return false;
+    }
+
+    n = (log->keys[idx].len < max_len) ? log->keys[idx].len : max_len;
+    if ((out != NULL) && (n > 0U)) {
+        memcpy(out, log->flash + log->keys[idx].addr, n);
+    }
+    if (out_len != NULL) {
+        *out_len = log->keys[idx].len;
+    }
+    return true;
+}
+
+typedef struct
+{
+    const char          *stream;
+    uint32_t             stream_len;
+    nor_log_record_cb_t  cb;
+    void                *user;
+    uint32_t             count;
+    bool                 stop;
+} iterate_ctx_t;
+
+static void iterate_record(nor_log_t *log, uint8_t kind, const char *key,
+                           uint32_t key_len, uint32_t value_addr,
+                           uint32_t value_len, void *ctx)
+{
+    iterate_ctx_t *it = (iterate_ctx_t *)ctx;
+
+    if (it->stop || (kind != REC_APPEND) || (key_len != it->stream_len) ||
+        (memcmp(key, it->stream, key_len) != 0)) {
+        return;
+    }
+    it->count++;
+    if (!it->cb(log->flash + value_addr, value_len, it->user)) {
+        it->stop = true;
+    }
+}
+
+uint32_t nor_log_iterate(const nor_log_t *log, const char *stream,
+                         nor_log_record_cb_t cb, void *user)
+{
+    iterate_ctx_t it = { stream, 0U, cb, user, 0U, false };
+    uint32_t *order;
+    uint32_t active;
+
+    if ((log == NULL) || (log->flash == NULL) || (stream == NULL) || (cb == NULL)) {
+        return 0U;
+    }
+    order = malloc(log->sector_count * sizeof(uint32_t));
+    if (order == NULL) {
+        return 0U;
+    }
+
+    it.stream_len = (uint32_t)strlen(stream);
+    active = sectors_by_age(log, order);
+    for (uint32_t i = 0; (i < active) && !it.stop; i++) {
+        /* Walking only reads; the cast lets it share walk_sector(). */
+        (void)walk_sector((nor_log_t *)log, order[i], iterate_record, &it, NULL, NULL);
+    }
+    free(order);
+    return it.count;
+}
+
+void nor_log_get_stats(const nor_log_t *log, nor_log_stats_t *out)
+{
+    if ((log == NULL) || (out == NULL)) {
+        return;
+    }
+
+    *out = log->stats;
+    out->erase_min = UINT32_MAX;
+    out->erase_max = 0U;
+    for (uint32_t s = 0; (log->flash != NULL) && (s < log->sector_count); s++) {
+        sector_hdr_t hdr = sector_hdr(log, s);
+        uint32_t count = (hdr.magic == SECTOR_MAGIC) ? hdr.erase_count : 0U;
+        if (count < out->erase_min) out->erase_min = count;
+        if (count > out->erase_max) out->erase_max = count;
+    }
+    if (out->erase_min == UINT32_MAX) {
+        out->erase_min = 0U;
+    }
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * @file    nor_log.h
+ * @brief   Log-structured key/value + append-log store on emulated NOR flash
+ *
+ * The flash image is a file mapped into memory and treated with NOR rules:
+ * erase works on whole sectors and sets every byte to 0xFF, programming can
+ * only clear bits. Everything is written as CRC-checked batches appended to
+ * a circular sector log:
+ *
+ *   sector   [hdr: magic, erase count, sequence][batch][batch]...[0xFF...]
+ *   batch    [magic, payload length, crc32][record][record]...
+ *   record   [kind, key length, value length][key][value] (4-byte aligned)
+ *
+ * Key/value records: the newest PUT of a key wins, DEL removes it. A RAM
+ * index maps each live key to its value in flash.
+ * Append records: an ordered stream per key (e.g. measurement history).
+ *
+ * Writes are staged in RAM and programmed as one batch by nor_log_commit()
+ * (or when the stage fills), so many small records share one header and one
+ * program operation. The sector after the head is always kept erased; when
+ * the head moves into it, the oldest sector is reclaimed: its live keys are
+ * copied to the new head first, then it is erased. Append records in it
+ * expire, so streams behave as a ring bounded by the image size. Sectors
+ * are reused strictly in turn, which spreads erases evenly (wear-levelling).
+ *
+ * Crash safety: a batch counts only if its CRC matches. A torn batch can
+ * only be the last write before the crash; recovery skips it (its header is
+ * programmed first) or, if the header itself is torn, seals that sector.
+ * A reclaim interrupted before the erase is finished at open.
+ *
+ * Not thread-safe. POSIX uses mmap(); Windows falls back to a RAM image
+ * written through to the file.
+ ******************************************************************************/
+#ifndef NOR_LOG_H
+#define NOR_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef NOR_LOG_SECTOR_SIZE
+#define NOR_LOG_SECTOR_SIZE     (4096U)     /* erase unit */
+#endif
+
+#ifndef NOR_LOG_STAGE_SIZE
+#define NOR_LOG_STAGE_SIZE      (1024U)     /* largest batch, bytes */
+#endif
+
+#ifndef NOR_LOG_MAX_KEYS
+#define NOR_LOG_MAX_KEYS        (32U)
+#endif
+
+#define NOR_LOG_KEY_MAX_LEN     (31U)
+#define NOR_LOG_MIN_SECTORS     (3U)        /* head + spare + one to reclaim */
+
+typedef struct
+{
+    uint64_t  user_bytes;       /* key + value bytes accepted from callers */
+    uint64_t  flash_bytes;      /* bytes programmed, all overheads included */
+    uint32_t  batches;          /* batches programmed */
+    uint32_t  erases;           /* sector erases this session */
+    uint32_t  erase_min;        /* lowest / highest lifetime erase count */
+    uint32_t  erase_max;
+    uint32_t  relocated_bytes;  /* live key bytes copied by reclaim */
+    uint32_t  expired_appends;  /* append records dropped by reclaim */
+    uint32_t  program_faults;   /* program tried to set a 0 bit back to 1 */
+    uint32_t  recovered_batches;
+    uint32_t  torn_batches;     /* batches rejected at open (bad CRC) */
+    uint32_t  recovery_us;      /* time nor_log_open() spent scanning */
+} nor_log_stats_t;
+
+typedef struct
+{
+    char      key[NOR_LOG_KEY_MAX_LEN + 1U];
+    uint32_t  addr;             /* flash offset of the value */
+    uint32_t  len;
+} nor_log_key_t;
+
+typedef struct
+{
+    uint8_t        *flash;
+    uint32_t        size;
+    uint32_t        sector_count;
+    uint32_t        head;           /* sector being appended to */
+    uint32_t        head_offset;    /* next free byte inside head */
+    uint32_t        next_seq;
+    nor_log_key_t   keys[NOR_LOG_MAX_KEYS];
+    uint32_t        key_count;
+    uint8_t         stage[NOR_LOG_STAGE_SIZE];
+    uint32_t        stage_len;
+    uint32_t        stage_user_bytes;
+    nor_log_stats_t stats;
+    void           *file;           /* platform handle */
+} nor_log_t;
+
+/* Receives one append record; return false to stop the walk. */
+typedef bool (*nor_log_record_cb_t)(const void *data, uint32_t len, void *user);
+
+/* Map (creating if needed) an image of sector_count sectors and recover the
+ * index from it. An image of a different size is reformatted. */
+bool nor_log_open(nor_log_t *log, const char *path, uint32_t sector_count);
+
+/* Commit pending writes and unmap. */
+void nor_log_close(nor_log_t *log);
+
+/* Stage writes; they reach flash (and become readable) at commit. */
+bool nor_log_put(nor_log_t *log, const char *key, const void *value, uint32_t len);
+bool nor_log_delete(nor_log_t *log, const char *key);
+bool nor_log_append(nor_log_t *log, const char *stream, const void *data, uint32_t len);
+
+/* Program the staged batch. No-op when nothing is staged. */
+bool nor_log_commit(nor_log_t *log);
+
+/* Copy the committed value of key. Returns false if the key is absent. */
+bool nor_log_get(const nor_log_t *log, const char *key, void *out,
+                 uint32_t max_len, uint32_t *out_len);
+
+/* Walk the committed append records of stream, oldest first.
+ * Returns the number of records passed to cb. */
+uint32_t nor_log_iterate(const nor_log_t *log, const char *stream,
+                         nor_log_record_cb_t cb, void *user);
+
+void nor_log_get_stats(const nor_log_t *log, nor_log_stats_t *out);
+
+#endif /* NOR_LOG_H */
@@ -0,0 +1,538 @@
+/*******************************************************************************
+ * @file    pcm_meter.c
+ * @brief   Stereo PCM level metering — scalar reference, SSE2/AVX2 and NEON
+ *
+ * All paths accumulate the same integers (max |x|, sum |x|, sum x^2) and
+ * share finish(), so vector and scalar results are identical. |x| is kept
+ * as an unsigned 16-bit value so -32768 measures 32768.
+ ******************************************************************************/
+#include "pcm_meter.h"
+
+#include <math.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PCM_METER_X86       1
+#include <emmintrin.h>
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PCM_METER_NEON      1
+#include <arm_neon.h>
+#endif
+
+/* AVX2 kernels use a per-function target attribute so the rest of the
+ * program keeps the baseline ISA; the CPU is checked at run time. */
+#if defined(PCM_METER_X86)
+#if defined(__AVX2__)
+#define PCM_METER_AVX2      1
+#define PCM_METER_AVX2_ATTR
+#elif defined(__GNUC__) || defined(__clang__)
+#define PCM_METER_AVX2      1
+#define PCM_METER_AVX2_ATTR __attribute__((target("avx2")))
+#endif
+#endif
+
+/* 32-bit |x| lane sums are folded into 64 bits after this many vectors,
+ * far below the 65535 that could overflow a lane. */
+#define PCM_METER_BLOCK     (4096U)
+
+typedef struct
+{
+    uint32_t peak;
+    uint64_t sum_abs;
+    uint64_t sum_sq;
+} meter_acc_t;
+
+/* ── Scalar ───────────────────────────────────────────── */
+
+static void acc_scalar(meter_acc_t *acc, const int16_t *s, uint32_t n, uint32_t stride)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t v = s[(size_t)i * stride];
+        uint32_t a = (uint32_t)(v < 0 ? -v : v);
+        if (a > acc->peak) acc->peak = a;
+        acc->sum_abs += a;
+        acc->sum_sq += (uint64_t)(v * v);
+    }
+}
+
+static pcm_meter_level_t finish(const meter_acc_t *acc, uint32_t n)
+{
+    pcm_meter_level_t level = {0, 0, 0};
+    if (n == 0) return level;
+
+    level.peak_abs = acc->peak;
+    level.mean_abs = (uint32_t)(acc->sum_abs / n);
+    level.rms = (uint32_t)sqrt((double)acc->sum_sq / (double)n);
+    return level;
+}
+
+static void finish_stereo(const meter_acc_t *l, const meter_acc_t *r, uint32_t n,
+                          pcm_meter_stereo_t *out)
+{
+    out->left = finish(l, n);
+    out->right = finish(r, n);
+}
+
+void pcm_meter_planar_ref(const int16_t *left, const int16_t *right, uint32_t count,
+                          pcm_meter_stereo_t *out)
+{
+    meter_acc_t l = {0, 0, 0};
+    meter_acc_t r = {0, 0, 0};
+    acc_scalar(&l, left, count, 1);
+    acc_scalar(&r, right, count, 1);
+    finish_stereo(&l, &r, count, out);
+}
+
+void pcm_meter_interleaved_ref(const int16_t *lr, uint32_t frames, pcm_meter_stereo_t *out)
+{
+    meter_acc_t l = {0, 0, 0};
+    meter_acc_t r = {0, 0, 0};
+    acc_scalar(&l, lr, frames, 2);
+    acc_scalar(&r, lr + 1, frames, 2);
+    finish_stereo(&l, &r, frames, out);
+}
+
+/* ── x86 SSE2 ─────────────────────────────────────────── */
+
+#if defined(PCM_METER_X86)
+
+static bool s_force_sse2 = false;
+static volatile int8_t s_avx2_state = -1;
+
+static bool has_avx2(void)
+{
+#if defined(PCM_METER_AVX2)
+    if (s_avx2_state < 0) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_cpu_init();
+        s_avx2_state = __builtin_cpu_supports("avx2") ? 1 : 0;
+#else
+        s_avx2_state = 1;
+#endif
+    }
+    return s_avx2_state == 1 && !s_force_sse2;
+#else
+    return false;
+#endif
+}
+
+/* |x| as u16 without SSSE3: (x ^ sign) - sign */
+static inline __m128i sse2_abs_u16(__m128i x)
+{
+    __m128i sign = _mm_srai_epi16(x, 15);
+    return _mm_sub_epi16(_mm_xor_si128(x, sign), sign);
+}
+
+/* SSE2 has only a signed 16-bit max: bias by 0x8000 around it */
+static inline __m128i sse2_max_u16_biased(__m128i peak_biased, __m128i a)
+{
+    return _mm_max_epi16(peak_biased, _mm_xor_si128(a, _mm_set1_epi16((short)0x8000)));
+}
+
+/* u16 pairs -> u32 lanes */
+static inline __m128i sse2_sum_u16(__m128i acc32, __m128i a)
+{
+    __m128i zero = _mm_setzero_si128();
+    acc32 = _mm_add_epi32(acc32, _mm_unpacklo_epi16(a, zero));
+    return _mm_add_epi32(acc32, _mm_unpackhi_epi16(a, zero));
+}
+
+/* madd lanes are x0^2 + x1^2 <= 2^31: exact as u32, widened to u64 */
+static inline __m128i sse2_sum_sq(__m128i acc64, __m128i sq32)
+{
+    __m128i zero = _mm_setzero_si128();
+    acc64 = _mm_add_epi64(acc64, _mm_unpacklo_epi32(sq32, zero));
+    return _mm_add_epi64(acc64, _mm_unpackhi_epi32(sq32, zero));
+}
+
+static uint64_t sse2_hsum_u64(__m128i v)
+{
+    uint64_t lane[2];
+    _mm_storeu_si128((__m128i *)lane, v);
+    return lane[0] + lane[1];
+}
+
+static uint32_t sse2_hmax_biased(__m128i v)
+{
+    uint16_t lane[8];
+    uint32_t peak = 0;
+    _mm_storeu_si128((__m128i *)lane, v);
+    for (int i = 0; i < 8; i++) {
+        uint32_t p = (uint32_t)(lane[i] ^ 0x8000U);
+        if (p > peak) peak = p;
+    }
+    return peak;
+}
+
+static uint32_t sse2_planar(meter_acc_t *l, meter_acc_t *r, const int16_t *left,
+                            const int16_t *right, uint32_t count)
+{
+    uint32_t vecs = count / 8U;
+    __m128i peak_l = _mm_set1_epi16((short)0x8000);
+    __m128i peak_r = peak_l;
+    __m128i sq_l = _mm_setzero_si128();
+    __m128i sq_r = _mm_setzero_si128();
+
+    for (uint32_t v = 0; v < vecs;) {
+        uint32_t end = v + PCM_METER_BLOCK < vecs ? v + PCM_METER_BLOCK : vecs;
+        __m128i abs_l = _mm_setzero_si128();
+        __m128i abs_r = _mm_setzero_si128();
+
+        for (; v < end; v++) {
+            __m128i xl = _mm_loadu_si128((const __m128i *)(left + v * 8U));
+            __m128i xr = _mm_loadu_si128((const __m128i *)(right + v * 8U));
+            __m128i al = sse2_abs_u16(xl);
+            __m128i ar = sse2_abs_u16(xr);
+
+            peak_l = sse2_max_u16_biased(peak_l, al);
+            peak_r = sse2_max_u16_biased(peak_r, ar);
+            abs_l = sse2_sum_u16(abs_l, al);
+            abs_r = sse2_sum_u16(abs_r, ar);
+            sq_l = sse2_sum_sq(sq_l, _mm_madd_epi16(xl, xl));
+            sq_r = sse2_sum_sq(sq_r, _mm_madd_epi16(xr, xr));
+        }
+
+        l->sum_abs += sse2_hsum_u64(sse2_sum_sq(_mm_setzero_si128(), abs_l));
+        r->sum_abs += sse2_hsum_u64(sse2_sum_sq(_mm_setzero_si128(), abs_r));
+    }
+
+    l->peak = sse2_hmax_biased(peak_l);
+    r->peak = sse2_hmax_biased(peak_r);
+    l->sum_sq += sse2_hsum_u64(sq_l);
+    r->sum_sq += sse2_hsum_u64(sq_r);
+    return vecs * 8U;
+}
+
+/* Interleaved: even 16-bit lanes are left, odd lanes right. The 32-bit
+ * |x| sums keep that parity; squares are split with a lane mask. */
+static uint32_t sse2_interleaved(meter_acc_t *l, meter_acc_t *r, const int16_t *lr,
+                                 uint32_t frames)
+{
+    uint32_t vecs = frames / 4U;
+    __m128i mask_l = _mm_set1_epi32(0x0000FFFF);
+    __m128i peak = _mm_set1_epi16((short)0x8000);
+    __m128i sq_l = _mm_setzero_si128();
+    __m128i sq_r = _mm_setzero_si128();
+
+    for (uint32_t v = 0; v < vecs;) {
+        uint32_t end = v + PCM_METER_BLOCK < vecs ? v + PCM_METER_BLOCK : vecs;
+        __m128i abs_lr = _mm_setzero_si128();
+
+        for (; v < end; v++) {
+            __m128i x = _mm_loadu_si128((const __m128i *)(lr + v * 8U));
+            __m128i xl = _mm_and_si128(x, mask_l);
+            __m128i xr = _mm_andnot_si128(mask_l, x);
+            __m128i a = sse2_abs_u16(x);
+
+            peak = sse2_max_u16_biased(peak, a);
+            abs_lr = sse2_sum_u16(abs_lr, a);
+            sq_l = sse2_sum_sq(sq_l, _mm_madd_epi16(xl, x));
+            sq_r = sse2_sum_sq(sq_r, _mm_madd_epi16(xr, x));
+        }
+
+        uint32_t lane[4];
+        _mm_storeu_si128((__m128i *)lane, abs_lr);
+        l->sum_abs += (uint64_t)lane[0] + lane[2];
+        r->sum_abs += (uint64_t)lane[1] + lane[3];
+    }
+
+    uint16_t p[8];
+    _mm_storeu_si128((__m128i *)p, peak);
+    for (int i = 0; i < 8; i++) {
+        uint32_t a = (uint32_t)(p[i] ^ 0x8000U);
+        meter_acc_t *acc = (i & 1) ? r : l;
+        if (a > acc->peak) acc->peak = a;
+    }
+    l->sum_sq += sse2_hsum_u64(sq_l);
+    r->sum_sq += sse2_hsum_u64(sq_r);
+    return vecs * 4U;
+}
+
+/* ── x86 AVX2 ─────────────────────────────────────────── */
+
+#if defined(PCM_METER_AVX2)
+
+static PCM_METER_AVX2_ATTR __m256i avx2_sum_u16(__m256i acc32, __m256i a)
+{
+    __m256i zero = _mm256_setzero_si256();
+    acc32 = _mm256_add_epi32(acc32, _mm256_unpacklo_epi16(a, zero));
+    return _mm256_add_epi32(acc32, _mm256_unpackhi_epi16(a, zero));
+}
+
+static PCM_METER_AVX2_ATTR __m256i avx2_sum_sq(__m256i acc64, __m256i sq32)
+{
+    __m256i zero = _mm256_setzero_si256();
+    acc64 = _mm256_add_epi64(acc64, _mm256_unpacklo_epi32(sq32, zero));
+    return _mm256_add_epi64(acc64, _mm256_unpackhi_epi32(sq32, zero));
+}
+
+static PCM_METER_AVX2_ATTR uint64_t avx2_hsum_u64(__m256i v)
+{
+    uint64_t lane[4];
+    _mm256_storeu_si256((__m256i *)lane, v);
+    return lane[0] + lane[1] + lane[2] + lane[3];
+}
+
+static PCM_METER_AVX2_ATTR uint32_t avx2_hmax_u16(__m256i v)
+{
+    __m128i m = _mm_max_epu16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    /* minpos on the inverted values finds the max */
+    m = _mm_minpos_epu16(_mm_xor_si128(m, _mm_set1_epi16(-1)));
+    return (uint32_t)(0xFFFFU ^ (uint32_t)_mm_extract_epi16(m, 0));
+}
+
+/* _mm256_abs_epi16(-32768) is 0x8000, i.e. 32768 read as u16 */
+static PCM_METER_AVX2_ATTR uint32_t avx2_planar(meter_acc_t *l, meter_acc_t *r,
+                                                const int16_t *left, const int16_t *right,
+                                                uint32_t count)
+{
+    uint32_t vecs = count / 16U;
+    __m256i peak_l = _mm256_setzero_si256();
+    __m256i peak_r = _mm256_setzero_si256();
+    __m256i sq_l = _mm256_setzero_si256();
+    __m256i sq_r = _mm256_setzero_si256();
+
+    for (uint32_t v = 0; v < vecs;) {
+        uint32_t end = v + PCM_METER_BLOCK < vecs ? v + PCM_METER_BLOCK : vecs;
+        __m256i abs_l = _mm256_setzero_si256();
+        __m256i abs_r = _mm256_setzero_si256();
+
+        for (; v < end; v++) {
+            __m256i xl = _mm256_loadu_si256((const __m256i *)(left + v * 16U));
+            __m256i xr = _mm256_loadu_si256((const __m256i *)(right + v * 16U));
+            __m256i al = _mm256_abs_epi16(xl);
+            __m256i ar = _mm256_abs_epi16(xr);
+
+            peak_l = _mm256_max_epu16(peak_l, al);
+            peak_r = _mm256_max_epu16(peak_r, ar);
+            abs_l = avx2_sum_u16(abs_l, al);
+            abs_r = avx2_sum_u16(abs_r, ar);
+            sq_l = avx2_sum_sq(sq_l, _mm256_madd_epi16(xl, xl));
+            sq_r = avx2_sum_sq(sq_r, _mm256_madd_epi16(xr, xr));
+        }
+
+        l->sum_abs += avx2_hsum_u64(avx2_sum_sq(_mm256_setzero_si256(), abs_l));
+        r->sum_abs += avx2_hsum_u64(avx2_sum_sq(_mm256_setzero_si256(), abs_r));
+    }
+
+    l->peak = avx2_hmax_u16(peak_l);
+    r->peak = avx2_hmax_u16(peak_r);
+    l->sum_sq += avx2_hsum_u64(sq_l);
+    r->sum_sq += avx2_hsum_u64(sq_r);
+    return vecs * 16U;
+}
+
+static PCM_METER_AVX2_ATTR uint32_t avx2_interleaved(meter_acc_t *l, meter_acc_t *r,
+                                                     const int16_t *lr, uint32_t frames)
+{
+    uint32_t vecs = frames / 8U;
+    __m256i mask_l = _mm256_set1_epi32(0x0000FFFF);
+    __m256i peak = _mm256_setzero_si256();
+    __m256i sq_l = _mm256_setzero_si256();
+    __m256i sq_r = _mm256_setzero_si256();
+
+    for (uint32_t v = 0; v < vecs;) {
+        uint32_t end = v + PCM_METER_BLOCK < vecs ? v + PCM_METER_BLOCK : vecs;
+        __m256i abs_lr = _mm256_setzero_si256();
+
+        for (; v < end; v++) {
+            __m256i x = _mm256_loadu_si256((const __m256i *)(lr + v * 16U));
+            __m256i xl = _mm256_and_si256(x, mask_l);
+            __m256i xr = _mm256_andnot_si256(mask_l, x);
+            __m256i a = _mm256_abs_epi16(x);
+
+            peak = _mm256_max_epu16(peak, a);
+            abs_lr = avx2_sum_u16(abs_lr, a);
+            sq_l = avx2_sum_sq(sq_l, _mm256_madd_epi16(xl, x));
+            sq_r = avx2_sum_sq(sq_r, _mm256_madd_epi16(xr, x));
+        }
+
+        uint32_t lane[8];
+        _mm256_storeu_si256((__m256i *)lane, abs_lr);
+        for (int i = 0; i < 8; i += 2) {
+            l->sum_abs += lane[i];
+            r->sum_abs += lane[i + 1];
+        }
+    }
+
+    uint16_t p[16];
+    _mm256_storeu_si256((__m256i *)p, peak);
+    for (int i = 0; i < 16; i++) {
+        meter_acc_t *acc = (i & 1) ? r : l;
+        if (p[i] > acc->peak) acc->peak = p[i];
+    }
+    l->sum_sq += avx2_hsum_u64(sq_l);
+    r->sum_sq += avx2_hsum_u64(sq_r);
+    return vecs * 8U;
+}
+
+#endif /* PCM_METER_AVX2 */
+
+#endif /* PCM_METER_X86 */
+
+/* ── Arm NEON ─────────────────────────────────────────── */
+
+#if defined(PCM_METER_NEON)
+
+typedef struct
+{
+    uint16x8_t peak;
+    uint32x4_t sum_abs;
+    uint64x2_t sum_sq;
+} neon_acc_t;
+
+/* vabsq_s16(-32768) wraps to 0x8000, i.e. 32768 read as u16 */
+static inline void neon_step(neon_acc_t *acc, int16x8_t x)
+{
+    uint16x8_t a = vreinterpretq_u16_s16(vabsq_s16(x));
+    int16x4_t lo = vget_low_s16(x);
+    int16x4_t hi = vget_high_s16(x);
+
+    acc->peak = vmaxq_u16(acc->peak, a);
+    acc->sum_abs = vpadalq_u16(acc->sum_abs, a);
+    acc->sum_sq = vpadalq_u32(acc->sum_sq, vreinterpretq_u32_s32(vmull_s16(lo, lo)));
+    acc->sum_sq = vpadalq_u32(acc->sum_sq, vreinterpretq_u32_s32(vmull_s16(hi, hi)));
+}
+
+static void neon_flush_abs(neon_acc_t *acc, meter_acc_t *out)
+{
+    uint64x2_t s = vpaddlq_u32(acc->sum_abs);
+    out->sum_abs += vgetq_lane_u64(s, 0) + vgetq_lane_u64(s, 1);
+    acc->sum_abs = vdupq_n_u32(0);
+}
+
+static void neon_finish(neon_acc_t *acc, meter_acc_t *out)
+{
+    uint16_t p[8];
+    vst1q_u16(p, acc->peak);
+    for (int i = 0; i < 8; i++) {
+        if (p[i] > out->peak) out->peak = p[i];
+    }
+    out->sum_sq += vgetq_lane_u64(acc->sum_sq, 0) + vgetq_lane_u64(acc->sum_sq, 1);
+}
+
+static void neon_init(neon_acc_t *acc)
+{
+    acc->peak = vdupq_n_u16(0);
+    acc->sum_abs = vdupq_n_u32(0);
+    acc->sum_sq = vdupq_n_u64(0);
+}
+
+static uint32_t neon_planar(meter_acc_t *l, meter_acc_t *r, const int16_t *left,
+                            const int16_t *right, uint32_t count)
+{
+    uint32_t vecs = count / 8U;
+    neon_acc_t al;
+    neon_acc_t ar;
+    neon_init(&al);
+    neon_init(&ar);
+
+    for (uint32_t v = 0; v < vecs;) {
+        uint32_t end = v + PCM_METER_BLOCK < vecs ? v + PCM_METER_BLOCK : vecs;
+        for (; v < end; v++) {
+            neon_step(&al, vld1q_s16(left + v * 8U));
+            neon_step(&ar, vld1q_s16(right + v * 8U));
+        }
+        neon_flush_abs(&al, l);
+        neon_flush_abs(&ar, r);
+    }
+
+    neon_finish(&al, l);
+    neon_finish(&ar, r);
+    return vecs * 8U;
+}
+
+/* vld2q de-interleaves, so the planar step applies unchanged */
+static uint32_t neon_interleaved(meter_acc_t *l, meter_acc_t *r, const int16_t *lr,
+                                 uint32_t frames)
+{
+    uint32_t vecs = frames / 8U;
+    neon_acc_t al;
+    neon_acc_t ar;
+    neon_init(&al);
+    neon_init(&ar);
+
+    for (uint32_t v = 0; v < vecs;) {
+        uint32_t end = v + PCM_METER_BLOCK < vecs ? v + PCM_METER_BLOCK : vecs;
+        for (; v < end; v++) {
+            int16x8x2_t x = vld2q_s16(lr + v * 16U);
+            neon_step(&al, x.val[0]);
+            neon_step(&ar, x.val[1]);
+        }
+        neon_flush_abs(&al, l);
+        neon_flush_abs(&ar, r);
+    }
+
+    neon_finish(&al, l);
+    neon_finish(&ar, r);
+    return vecs * 8U;
+}
+
+#endif /* PCM_METER_NEON */
+
+/* ── Public API ───────────────────────────────────────── */
+
+void pcm_meter_planar(const int16_t *left, const int16_t *right, uint32_t count,
+                      pcm_meter_stereo_t *out)
+{
+    meter_acc_t l = {0, 0, 0};
+    meter_acc_t r = {0, 0, 0};
+    uint32_t done = 0;
+
+#if defined(PCM_METER_X86)
+#if defined(PCM_METER_AVX2)
+    if (has_avx2()) done = avx2_planar(&l, &r, left, right, count);
+    else
+#endif
+        done = sse2_planar(&l, &r, left, right, count);
+#elif defined(PCM_METER_NEON)
+    done = neon_planar(&l, &r, left, right, count);
+#endif
+
+    acc_scalar(&l, left + done, count - done, 1);
+    acc_scalar(&r, right + done, count - done, 1);
+    finish_stereo(&l, &r, count, out);
+}
+
+void pcm_meter_interleaved(const int16_t *lr, uint32_t frames, pcm_meter_stereo_t *out)
+{
+    meter_acc_t l = {0, 0, 0};
+    meter_acc_t r = {0, 0, 0};
+    uint32_t done = 0;
+
+#if defined(PCM_METER_X86)
+#if defined(PCM_METER_AVX2)
+    if (has_avx2()) done = avx2_interleaved(&l, &r, lr, frames);
+    else
+#endif
+        done = sse2_interleaved(&l, &r, lr, frames);
+#elif defined(PCM_METER_NEON)
+    done = neon_interleaved(&l, &r, lr, frames);
+#endif
+
+    acc_scalar(&l, lr + 2U * done, frames - done, 2);
+    acc_scalar(&r, lr + 2U * done + 1U, frames - done, 2);
+    finish_stereo(&l, &r, frames, out);
+}
+
+const char *pcm_meter_backend(void)
+{
+#if defined(PCM_METER_X86)
+    return has_avx2() ? "avx2" : "sse2";
+#elif defined(PCM_METER_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+void pcm_meter_force_sse2(bool en)
+{
+#if defined(PCM_METER_X86)
+    s_force_sse2 = en;
+    s_avx2_state = -1;
+#else
+    (void)en;
+#endif
+}
@@ -0,0 +1,53 @@
+/*******************************************************************************
+ * @file    pcm_meter.h
+ * @brief   Stereo PCM level metering — peak, mean-abs and RMS in one pass
+ *
+ * Both channels are measured in a single pass over either planar buffers
+ * (left[], right[] as returned by pdm_mic_get_frame()) or an interleaved
+ * L/R buffer. Vector kernels:
+ *
+ *   x86      SSE2 baseline, AVX2 picked at run time if the CPU has it
+ *   Arm      NEON when the compiler targets it (__ARM_NEON)
+ *   other    scalar
+ *
+ * The scalar reference functions (*_ref) give bit-identical results and
+ * are kept for checking the vector paths.
+ ******************************************************************************/
+#ifndef PCM_METER_H
+#define PCM_METER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct
+{
+    uint32_t peak_abs;      /* max |x|, 0..32768 */
+    uint32_t mean_abs;      /* sum |x| / n */
+    uint32_t rms;           /* sqrt(sum x^2 / n), truncated */
+} pcm_meter_level_t;
+
+typedef struct
+{
+    pcm_meter_level_t left;
+    pcm_meter_level_t right;
+} pcm_meter_stereo_t;
+
+/* count samples per channel in left[] and right[] */
+void pcm_meter_planar(const int16_t *left, const int16_t *right, uint32_t count,
+                      pcm_meter_stereo_t *out);
+
+/* frames L/R pairs in lr[] (2 * frames samples) */
+void pcm_meter_interleaved(const int16_t *lr, uint32_t frames, pcm_meter_stereo_t *out);
+
+/* Scalar reference implementations */
+void pcm_meter_planar_ref(const int16_t *left, const int16_t *right, uint32_t count,
+                          pcm_meter_stereo_t *out);
+void pcm_meter_interleaved_ref(const int16_t *lr, uint32_t frames, pcm_meter_stereo_t *out);
+
+/* Kernel in use: "avx2", "sse2", "neon" or "scalar" */
+const char *pcm_meter_backend(void);
+
+/* x86 only: use SSE2 even if AVX2 is available (to compare the two paths) */
+void pcm_meter_force_sse2(bool en);
+
+#endif /* PCM_METER_H */
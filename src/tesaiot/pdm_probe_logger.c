@@ -0,0 +1,340 @@
+/*******************************************************************************
+ * @file    pdm_probe_logger.c
+ * @brief   PC simulator mock -- PDM probe logger
+ *
+ *          Two threads replace the firmware's PDM DMA interrupt and logger
+ *          task:
+ *
+ *            capture  every 10 ms frame from pdm_mic_get_frame() goes into a
+ *                     preallocated frame ring (the DMA buffer model).
+ *            meter    drains the ring, meters both channels of each frame in
+ *                     one vectorized pass (pcm_meter.h) and publishes one
+ *                     aggregated 100 ms window to mic_presenter.
+ *
+ *          The LVGL thread only consumes windows (lock-free, spsc_channel.h).
+ *          Overruns and dropped frames are counted so the ring and window
+ *          sizes can be chosen for the firmware port.
+ *
+ *          Shared by int_ep06_digital_mic_probe and int_ep07_sensorhub_final,
+ *          which link it against their own pdm_mic and mic_presenter.
+ ******************************************************************************/
+#include "pdm_probe_logger.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mic_presenter.h"
+#include "pcm_meter.h"
+#include "pdm_mic.h"
+#include "spsc_channel.h"
+
+#define PDM_FRAME_PERIOD_NS        (1000000000ULL * PDM_MIC_FRAME_SAMPLES_PER_CHANNEL / PDM_MIC_SAMPLE_RATE_HZ)
+#define PDM_FRAME_RING_DEPTH       16U    /* power of two; 16 frames = 160 ms */
+#define PDM_METER_PERIOD_MS        20U    /* meter wakes up and drains in batches */
+#define PDM_WINDOW_FRAMES          10U    /* 10 x 10 ms = one published window */
+#define PDM_STATS_LOG_FRAMES       500U   /* stats line every 5 s of audio */
+#define PDM_UI_FLOOR_ABS           80U
+#define PDM_UI_CEIL_ABS            8000U
+
+typedef struct {
+    uint32_t peak_abs;
+    uint32_t avg_abs;
+    uint32_t peak_tenth_pct_fs;
+    uint32_t avg_tenth_pct_fs;
+    uint32_t ui_pct;
+} mic_level_t;
+
+/* One ring slot: a 10 ms stereo frame copied out of the driver buffer.
+ * A short read fills only the first `count` samples; the rest is stale. */
+typedef struct {
+    uint32_t seq;
+    uint32_t count;         /* samples per channel */
+    int16_t  left[PDM_MIC_FRAME_SAMPLES_PER_CHANNEL];
+    int16_t  right[PDM_MIC_FRAME_SAMPLES_PER_CHANNEL];
+} pdm_frame_slot_t;
+
+/* Running window on the meter thread */
+typedef struct {
+    uint32_t frames;
+    uint32_t left_peak;
+    uint32_t right_peak;
+    uint64_t left_sum_avg;
+    uint64_t right_sum_avg;
+    uint64_t left_sum_ms;       /* sum of per-frame rms^2 */
+    uint64_t right_sum_ms;
+} pdm_window_t;
+
+static bool s_started = false;
+static pthread_t s_capture_thread;
+static pthread_t s_meter_thread;
+
+static spsc_ring_t s_frame_ring;
+static pdm_frame_slot_t s_frame_buf[PDM_FRAME_RING_DEPTH];
+
+static uint32_t s_frame_count = 0U;     /* frames metered, meter thread only */
+static pdm_window_t s_window;
+
+/* Written by one thread each, read by anyone */
+static pdm_probe_logger_stats_t s_stats;
+
+#define STAT_ADD(field, n)   __atomic_fetch_add(&s_stats.field, (n), __ATOMIC_RELAXED)
+#define STAT_GET(field)      __atomic_load_n(&s_stats.field, __ATOMIC_RELAXED)
+
+static uint32_t to_tenth_pct_fs(uint32_t abs_value)
+{
+    return (abs_value * 1000U) / 32767U;
+}
+
+static uint32_t to_ui_pct(uint32_t avg_abs)
+{
+    if (avg_abs <= PDM_UI_FLOOR_ABS)  return 0U;
+    if (avg_abs >= PDM_UI_CEIL_ABS)   return 100U;
+    return ((avg_abs - PDM_UI_FLOOR_ABS) * 100U) / (PDM_UI_CEIL_ABS - PDM_UI_FLOOR_ABS);
+}
+
+static mic_level_t level_from(uint32_t peak_abs, uint32_t avg_abs)
+{
+    mic_level_t level;
+
+    level.peak_abs          = peak_abs;
+    level.avg_abs           = avg_abs;
+    level.peak_tenth_pct_fs = to_tenth_pct_fs(peak_abs);
+    level.avg_tenth_pct_fs  = to_tenth_pct_fs(avg_abs);
+    level.ui_pct            = to_ui_pct(avg_abs);
+
+    return level;
+}
+
+/* ── Monotonic time ───────────────────────────────────── */
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void sleep_ns(uint64_t ns)
+{
+    struct timespec ts;
+    ts.tv_sec  = (time_t)(ns / 1000000000ULL);
+    ts.tv_nsec = (long)(ns % 1000000000ULL);
+    nanosleep(&ts, NULL);
+}
+
+/* ── Capture thread (DMA model) ───────────────────────── */
+
+static void capture_one_frame(void)
+{
+    static pdm_frame_slot_t slot;     /* capture thread only */
+    pdm_mic_frame_t frame;
+    memset(&frame, 0, sizeof(frame));
+
+    cy_rslt_t rslt = pdm_mic_get_frame(&frame);
+    if ((CY_RSLT_SUCCESS != rslt) || (NULL == frame.left) || (NULL == frame.right)) {
+        return;
+    }
+
+    uint32_t n = frame.sample_count;
+    if (n > PDM_MIC_FRAME_SAMPLES_PER_CHANNEL) {
+        n = PDM_MIC_FRAME_SAMPLES_PER_CHANNEL;
+    }
+    if (n == 0U) {
+        return;
+    }
+
+    slot.seq = STAT_GET(frames_captured);
+    slot.count = n;
+    memcpy(slot.left,  frame.left,  n * sizeof(int16_t));
+    memcpy(slot.right, frame.right, n * sizeof(int16_t));
+    STAT_ADD(frames_captured, 1U);
+
+    /* Meter too slow: the frame is lost, like a DMA buffer nobody released */
+    if (!spsc_ring_push(&s_frame_ring, &slot)) {
+        STAT_ADD(frames_dropped, 1U);
+        return;
+    }
+
+    uint32_t depth = spsc_ring_count(&s_frame_ring);
+    if (depth > STAT_GET(ring_high_water)) {
+        __atomic_store_n(&s_stats.ring_high_water, depth, __ATOMIC_RELAXED);
+    }
+}
+
+static void *capture_thread_main(void *arg)
+{
+    (void)arg;
+    uint64_t next = now_ns();
+
+    while (1) {
+        uint64_t now = now_ns();
+        if (now < next) {
+            sleep_ns(next - now);
+            continue;
+        }
+
+        /* Woke up late: the hardware kept recording, so deliver the frames
+         * that became due in between -- unless more than a ring's worth was
+         * missed, which on the board is a PDM FIFO overrun. */
+        uint64_t due = (now - next) / PDM_FRAME_PERIOD_NS + 1U;
+        if (due > PDM_FRAME_RING_DEPTH) {
+            STAT_ADD(overruns, 1U);
+            STAT_ADD(frames_dropped, (uint32_t)(due - 1U));
+            due = 1U;
+            next = now;
+        }
+
+        for (uint64_t i = 0; i < due; i++) {
+            capture_one_frame();
+        }
+        next += due * PDM_FRAME_PERIOD_NS;
+    }
+
+    return NULL;
+}
+
+/* ── Meter thread (logger task) ───────────────────────── */
+
+static void publish_window(void)
+{
+    mic_level_t left  = level_from(s_window.left_peak,
+                                   (uint32_t)(s_window.left_sum_avg / s_window.frames));
+    mic_level_t right = level_from(s_window.right_peak,
+                                   (uint32_t)(s_window.right_sum_avg / s_window.frames));
+
+    uint32_t sum_avg = left.avg_abs + right.avg_abs;
+    int32_t balance_lr = 0;
+    if (sum_avg > 0U) {
+        balance_lr = ((int32_t)left.avg_abs - (int32_t)right.avg_abs)
+                     * 100 / (int32_t)sum_avg;
+    }
+
+    uint32_t left_rms  = (uint32_t)sqrt((double)s_window.left_sum_ms / (double)s_window.frames);
+    uint32_t right_rms = (uint32_t)sqrt((double)s_window.right_sum_ms / (double)s_window.frames);
+
+    mic_presenter_sample_t sample = {
+        .frame_count            = s_frame_count,
+        .left_peak_abs          = left.peak_abs,
+        .left_avg_abs           = left.avg_abs,
+        .right_peak_abs         = right.peak_abs,
+        .right_avg_abs          = right.avg_abs,
+        .left_peak_tenth_pct_fs = left.peak_tenth_pct_fs,
+        .left_avg_tenth_pct_fs  = left.avg_tenth_pct_fs,
+        .right_peak_tenth_pct_fs = right.peak_tenth_pct_fs,
+        .right_avg_tenth_pct_fs = right.avg_tenth_pct_fs,
+        .left_ui_pct            = left.ui_pct,
+        .right_ui_pct           = right.ui_pct,
+        .balance_lr             = balance_lr,
+        .left_rms_abs           = left_rms,
+        .right_rms_abs          = right_rms,
+    };
+
+    mic_presenter_publish_sample(&sample);
+    memset(&s_window, 0, sizeof(s_window));
+}
+
+static void meter_frame(const pdm_frame_slot_t *slot)
+{
+    pcm_meter_stereo_t level;
+    pcm_meter_planar(slot->left, slot->right, slot->count, &level);
+
+    if (level.left.peak_abs > s_window.left_peak)   s_window.left_peak  = level.left.peak_abs;
+    if (level.right.peak_abs > s_window.right_peak) s_window.right_peak = level.right.peak_abs;
+    s_window.left_sum_avg  += level.left.mean_abs;
+    s_window.right_sum_avg += level.right.mean_abs;
+    s_window.left_sum_ms   += (uint64_t)level.left.rms * level.left.rms;
+    s_window.right_sum_ms  += (uint64_t)level.right.rms * level.right.rms;
+    s_window.frames++;
+
+    s_frame_count++;
+    STAT_ADD(frames_metered, 1U);
+
+    if (s_window.frames >= PDM_WINDOW_FRAMES) {
+        publish_window();
+    }
+
+    if ((s_frame_count % PDM_STATS_LOG_FRAMES) == 0U) {
+        pdm_probe_logger_stats_t st;
+        pdm_probe_logger_get_stats(&st);
+        printf("[MOCK][MIC] STATS captured=%u metered=%u dropped=%u overruns=%u "
+               "ring_hw=%u/%u ui_dropped=%u\n",
+               (unsigned)st.frames_captured, (unsigned)st.frames_metered,
+               (unsigned)st.frames_dropped, (unsigned)st.overruns,
+               (unsigned)st.ring_high_water, (unsigned)PDM_FRAME_RING_DEPTH,
+               (unsigned)st.windows_dropped);
+        fflush(stdout);
+    }
+}
+
+static void *meter_thread_main(void *arg)
+{
+    (void)arg;
+    static pdm_frame_slot_t slot;     /* meter thread only */
+
+    while (1) {
+        while (spsc_ring_pop(&s_frame_ring, &slot, 1U) > 0U) {
+            meter_frame(&slot);
+        }
+        sleep_ns((uint64_t)PDM_METER_PERIOD_MS * 1000000ULL);
+    }
+
+    return NULL;
+}
+
+/* ── Public API ───────────────────────────────────────── */
+
+cy_rslt_t pdm_probe_logger_start(void)
+{
+    if (s_started) {
+        /* Already running. */
+        return CY_RSLT_SUCCESS;
+    }
+
+    cy_rslt_t rslt = pdm_mic_init();
+    if (CY_RSLT_SUCCESS != rslt) {
+        return rslt;
+    }
+
+    memset(&s_stats, 0, sizeof(s_stats));
+    memset(&s_window, 0, sizeof(s_window));
+    spsc_ring_init(&s_frame_ring, s_frame_buf, PDM_FRAME_RING_DEPTH, sizeof(pdm_frame_slot_t));
+
+    if (pthread_create(&s_meter_thread, NULL, meter_thread_main, NULL) != 0) {
+        printf("[MOCK][MIC] THREAD_CREATE_FAIL meter\n");
+        return CY_RSLT_TYPE_ERROR;
+    }
+    if (pthread_create(&s_capture_thread, NULL, capture_thread_main, NULL) != 0) {
+        printf("[MOCK][MIC] THREAD_CREATE_FAIL capture\n");
+        return CY_RSLT_TYPE_ERROR;
+    }
+    pthread_detach(s_meter_thread);
+    pthread_detach(s_capture_thread);
+
+    s_started = true;
+    printf("[MOCK][MIC] LOGGER_START ok frame_ms=%u ring=%u window_ms=%u meter=%s\n",
+           (unsigned)(PDM_FRAME_PERIOD_NS / 1000000ULL),
+           (unsigned)PDM_FRAME_RING_DEPTH,
+           (unsigned)(PDM_WINDOW_FRAMES * PDM_FRAME_PERIOD_NS / 1000000ULL),
+           pcm_meter_backend());
+    return CY_RSLT_SUCCESS;
+}
+
+void pdm_probe_logger_get_stats(pdm_probe_logger_stats_t *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+
+    stats->frames_captured = STAT_GET(frames_captured);
+    stats->frames_metered  = STAT_GET(frames_metered);
+    stats->frames_dropped  = STAT_GET(frames_dropped);
+    stats->overruns        = STAT_GET(overruns);
+    stats->ring_high_water = STAT_GET(ring_high_water);
+    stats->windows_dropped = mic_presenter_get_dropped_frames();
+}
@@ -0,0 +1,24 @@
+#ifndef PDM_PROBE_LOGGER_H
+#define PDM_PROBE_LOGGER_H
+
+#include <stdint.h>
+
+#include "cy_result.h"
+
+/* Counters for sizing the frame ring and UI window on the firmware port */
+typedef struct
+{
+    uint32_t frames_captured;   /* 10 ms frames read from pdm_mic_get_frame() */
+    uint32_t frames_metered;    /* frames whose levels were computed */
+    uint32_t frames_dropped;    /* lost to a full frame ring or an overrun */
+    uint32_t overruns;          /* capture fell more than a ring behind */
+    uint32_t ring_high_water;   /* deepest frame ring fill seen */
+    uint32_t windows_dropped;   /* windows mic_presenter could not queue */
+} pdm_probe_logger_stats_t;
+
+cy_rslt_t pdm_probe_logger_start(void);
+
+/* Snapshot of the counters; callable from any thread */
+void pdm_probe_logger_get_stats(pdm_probe_logger_stats_t *stats);
+
+#endif /* PDM_PROBE_LOGGER_H */
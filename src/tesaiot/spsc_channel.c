@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * @file    spsc_channel.c
+ * @brief   Lock-free SPSC channels — seqlock latest value + bounded ring
+ ******************************************************************************/
+#include "spsc_channel.h"
+
+#include <string.h>
+
+#define LOAD_RELAXED(p)        __atomic_load_n((p), __ATOMIC_RELAXED)
+#define LOAD_ACQUIRE(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_RELAXED(p, v)    __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#define STORE_RELEASE(p, v)    __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/* ── Latest value (seqlock) ───────────────────────────── */
+
+void spsc_latest_init(spsc_latest_t *ch, uint32_t *storage, uint32_t size)
+{
+    ch->seq = 0U;
+    ch->size = size;
+    ch->words = (size + 3U) / 4U;
+    ch->data = storage;
+    memset(storage, 0, ch->words * sizeof(uint32_t));
+}
+
+void spsc_latest_publish(spsc_latest_t *ch, const void *value)
+{
+    /* Only this thread writes seq, so a relaxed read of it is exact */
+    uint32_t seq = LOAD_RELAXED(&ch->seq);
+    uint32_t words[ch->words];
+    words[ch->words - 1U] = 0U;
+    memcpy(words, value, ch->size);
+
+    STORE_RELAXED(&ch->seq, seq + 1U);
+    __atomic_thread_fence(__ATOMIC_RELEASE);    /* odd seq before the data */
+
+    for (uint32_t i = 0; i < ch->words; i++) {
+        STORE_RELAXED(&ch->data[i], words[i]);
+    }
+
+    /* 0 means "never published": step over it when the counter wraps */
+    seq += 2U;
+    if (seq == 0U) seq = 2U;
+    STORE_RELEASE(&ch->seq, seq);               /* data before even seq */
+}
+
+bool spsc_latest_read(spsc_latest_t *ch, void *out, uint32_t *version)
+{
+    uint32_t words[ch->words];
+    uint32_t seq0;
+    uint32_t seq1;
+
+    do {
+        seq0 = LOAD_ACQUIRE(&ch->seq);
+        if (seq0 == 0U) return false;
+        if (seq0 & 1U) continue;                /* producer mid-write */
+
+        for (uint32_t i = 0; i < ch->words; i++) {
+            words[i] = LOAD_RELAXED(&ch->data[i]);
+        }
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE); /* data before the re-check */
+        seq1 = LOAD_RELAXED(&ch->seq);
+    } while ((seq0 & 1U) || seq0 != seq1);
+
+    memcpy(out, words, ch->size);
+    if (version) *version = seq0 / 2U;
+    return true;
+}
+
+/* ── Bounded ring ─────────────────────────────────────── */
+
+void spsc_ring_init(spsc_ring_t *ring, void *storage, uint32_t capacity, uint32_t elem_size)
+{
+    memset(ring, 0, sizeof(*ring));
+    ring->mask = capacity - 1U;
+    ring->elem_size = elem_size;
+    ring->buf = storage;
+}
+
+bool spsc_ring_push(spsc_ring_t *ring, const void *elem)
+{
+    uint32_t head = LOAD_RELAXED(&ring->head);
+    uint32_t tail = LOAD_ACQUIRE(&ring->tail);  /* slot is free once read */
+
+    if ((uint32_t)(head - tail) > ring->mask) {
+        STORE_RELAXED(&ring->dropped, LOAD_RELAXED(&ring->dropped) + 1U);
+        return false;
+    }
+
+    memcpy(ring->buf + (size_t)(head & ring->mask) * ring->elem_size, elem, ring->elem_size);
+    STORE_RELEASE(&ring->head, head + 1U);
+    return true;
+}
+
+uint32_t spsc_ring_pop(spsc_ring_t *ring, void *out, uint32_t max)
+{
+    uint32_t tail = LOAD_RELAXED(&ring->tail);
+    uint32_t head = LOAD_ACQUIRE(&ring->head);  /* element written before head */
+    uint8_t *dst = out;
+    uint32_t n = 0;
+
+    while (tail != head && n < max) {
+        memcpy(dst, ring->buf + (size_t)(tail & ring->mask) * ring->elem_size, ring->elem_size);
+        dst += ring->elem_size;
+        tail++;
+        n++;
+    }
+
+    STORE_RELEASE(&ring->tail, tail);
+    return n;
+}
+
+uint32_t spsc_ring_count(spsc_ring_t *ring)
+{
+    /* tail first: head only grows and never trails tail, so the difference
+     * cannot go negative when the other side moves between the two loads */
+    uint32_t tail = LOAD_ACQUIRE(&ring->tail);
+    uint32_t head = LOAD_ACQUIRE(&ring->head);
+    uint32_t n = (uint32_t)(head - tail);
+    return n > ring->mask ? ring->mask + 1U : n;
+}
+
+uint32_t spsc_ring_dropped(spsc_ring_t *ring)
+{
+    return LOAD_RELAXED(&ring->dropped);
+}
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * @file    spsc_channel.h
+ * @brief   Lock-free single-producer / single-consumer sample channels
+ *
+ * Two building blocks for handing sensor/audio samples from a producer
+ * (a pthread, or an RTOS task on the board) to the LVGL thread without
+ * critical sections:
+ *
+ *   spsc_latest_t  seqlock "latest value wins". The producer never waits;
+ *                  the consumer retries if it raced with a write. Used for
+ *                  state the UI only needs the newest copy of.
+ *
+ *   spsc_ring_t    bounded FIFO of fixed-size elements. Push fails (and is
+ *                  counted) when full instead of blocking the producer.
+ *                  Used for history the UI must not miss (e.g. peaks).
+ *
+ * Exactly one thread may write and one thread may read each channel.
+ * Storage is supplied by the caller, so channels can live in static memory.
+ * Uses the GCC/Clang __atomic builtins (also available in MinGW).
+ ******************************************************************************/
+#ifndef SPSC_CHANNEL_H
+#define SPSC_CHANNEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SPSC_CACHE_LINE     (64U)
+
+/* Words needed to hold a value of `type` in an spsc_latest_t */
+#define SPSC_LATEST_WORDS(type)   ((sizeof(type) + 3U) / 4U)
+
+typedef struct
+{
+    uint32_t  seq;          /* even: stable, odd: write in progress, 0: empty
+                             * (skipped when the counter wraps) */
+    uint32_t  size;         /* payload size in bytes */
+    uint32_t  words;        /* storage length in 32-bit words */
+    uint32_t *data;         /* caller storage [words] */
+} spsc_latest_t;
+
+typedef struct
+{
+    /* Producer and consumer indices on separate cache lines */
+    uint32_t  head;         /* elements pushed, owned by the producer */
+    uint32_t  dropped;      /* pushes rejected because the ring was full */
+    uint8_t   pad0[SPSC_CACHE_LINE - 2U * sizeof(uint32_t)];
+    uint32_t  tail;         /* elements popped, owned by the consumer */
+    uint8_t   pad1[SPSC_CACHE_LINE - sizeof(uint32_t)];
+
+    uint32_t  mask;         /* capacity - 1, capacity is a power of two */
+    uint32_t  elem_size;
+    uint8_t  *buf;          /* caller storage [capacity * elem_size] */
+} spsc_ring_t;
+
+/* ── Latest value (seqlock) ───────────────────────────── */
+
+/* storage must hold SPSC_LATEST_WORDS(value type) uint32_t words */
+void spsc_latest_init(spsc_latest_t *ch, uint32_t *storage, uint32_t size);
+
+/* Producer: replace the value. Never blocks. */
+void spsc_latest_publish(spsc_latest_t *ch, const void *value);
+
+/* Consumer: copy the newest value. Returns false if nothing was published
+ * yet. version (may be NULL) counts publishes, to skip unchanged values. */
+bool spsc_latest_read(spsc_latest_t *ch, void *out, uint32_t *version);
+
+/* ── Bounded ring ─────────────────────────────────────── */
+
+/* capacity must be a power of two; storage holds capacity * elem_size bytes.
+ * head and tail run freely and wrap; (uint32_t)(head - tail) is the fill
+ * level, so all capacity slots are usable. */
+void spsc_ring_init(spsc_ring_t *ring, void *storage, uint32_t capacity, uint32_t elem_size);
+
+/* Producer: append one element. Returns false (and counts a drop) if full. */
+bool spsc_ring_push(spsc_ring_t *ring, const void *elem);
+
+/* Consumer: remove up to max elements into out, oldest first. */
+uint32_t spsc_ring_pop(spsc_ring_t *ring, void *out, uint32_t max);
+
+/* Either side: elements currently queued (a snapshot) */
+uint32_t spsc_ring_count(spsc_ring_t *ring);
+
+uint32_t spsc_ring_dropped(spsc_ring_t *ring);
+
+#endif /* SPSC_CHANNEL_H */
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * @file    stream_stats.c
+ * @brief   Streaming statistics — sliding window, EWMA, windowed percentiles
+ *
+ * The deques hold ring slots, oldest first. The min deque keeps values in
+ * increasing order (a new sample removes every larger-or-equal one from the
+ * back), so its front is the window minimum; the max deque is the mirror.
+ * The sample being evicted is the oldest in the window, so if it is still
+ * in a deque it is at the front.
+ ******************************************************************************/
+#include "stream_stats.h"
+
+#include <math.h>
+#include <string.h>
+
+/* ── Helpers ───────────────────────────────────────────── */
+
+static uint32_t wrap(const stream_window_t *w, uint32_t i)
+{
+    return (i >= w->capacity) ? i - w->capacity : i;
+}
+
+static uint32_t hist_bin(const stream_window_t *w, float x)
+{
+    float f = (x - w->hist_lo) * w->hist_scale;
+    if (!(f >= 0.0f)) return 0U;                /* also NaN */
+    if (f >= (float)w->bins) return w->bins - 1U;
+    return (uint32_t)f;
+}
+
+static uint32_t oldest_slot(const stream_window_t *w)
+{
+    return wrap(w, w->pos + w->capacity - w->count);
+}
+
+static void resum(stream_window_t *w)
+{
+    double sum = 0.0, sum_sq = 0.0;
+    uint32_t slot = oldest_slot(w);
+    for (uint32_t i = 0; i < w->count; i++, slot = wrap(w, slot + 1U)) {
+        double v = w->values[slot];
+        sum += v;
+        sum_sq += v * v;
+    }
+    w->sum = sum;
+    w->sum_sq = sum_sq;
+    w->until_resum = w->capacity;
+}
+
+/* ── Sliding window ───────────────────────────────────── */
+
+void stream_window_init(stream_window_t *w, float *values, uint32_t *min_q,
+                        uint32_t *max_q, uint32_t capacity)
+{
+    memset(w, 0, sizeof(*w));
+    w->values = values;
+    w->min_q = min_q;
+    w->max_q = max_q;
+    w->capacity = (capacity > 0U) ? capacity : 1U;
+    w->until_resum = w->capacity;
+}
+
+void stream_window_set_hist(stream_window_t *w, uint32_t *counts, uint16_t bins,
+                            float lo, float hi)
+{
+    if (counts == NULL || bins == 0U || !(hi > lo)) {
+        w->hist = NULL;
+        return;
+    }
+    w->hist = counts;
+    w->bins = bins;
+    w->hist_lo = lo;
+    w->hist_scale = (float)bins / (hi - lo);
+    memset(counts, 0, sizeof(uint32_t) * bins);
+    uint32_t slot = oldest_slot(w);
+    for (uint32_t i = 0; i < w->count; i++, slot = wrap(w, slot + 1U)) {
+        counts[hist_bin(w, w->values[slot])]++;
+    }
+}
+
+void stream_window_push(stream_window_t *w, float x)
+{
+    uint32_t slot = w->pos;
+
+    if (w->count == w->capacity) {
+        /* Evict the oldest sample, which lives in the slot about to be reused */
+        float old = w->values[slot];
+        if (w->min_len > 0U && w->min_q[w->min_head] == slot) {
+            w->min_head = wrap(w, w->min_head + 1U);
+            w->min_len--;
+        }
+        if (w->max_len > 0U && w->max_q[w->max_head] == slot) {
+            w->max_head = wrap(w, w->max_head + 1U);
+            w->max_len--;
+        }
+        w->sum -= old;
+        w->sum_sq -= (double)old * old;
+        if (w->hist != NULL) w->hist[hist_bin(w, old)]--;
+    } else {
+        w->count++;
+    }
+
+    /* Samples that can no longer be the min (max) leave from the back */
+    while (w->min_len > 0U &&
+           w->values[w->min_q[wrap(w, w->min_head + w->min_len - 1U)]] >= x) {
+        w->min_len--;
+    }
+    w->min_q[wrap(w, w->min_head + w->min_len)] = slot;
+    w->min_len++;
+
+    while (w->max_len > 0U &&
+           w->values[w->max_q[wrap(w, w->max_head + w->max_len - 1U)]] <= x) {
+        w->max_len--;
+    }
+    w->max_q[wrap(w, w->max_head + w->max_len)] = slot;
+    w->max_len++;
+
+    w->values[slot] = x;
+    w->pos = wrap(w, slot + 1U);
+    w->sum += x;
+    w->sum_sq += (double)x * x;
+    if (w->hist != NULL) w->hist[hist_bin(w, x)]++;
+
+    if (--w->until_resum == 0U) resum(w);
+}
+
+void stream_window_reset(stream_window_t *w)
+{
+    w->count = 0U;
+    w->pos = 0U;
+    w->min_head = w->min_len = 0U;
+    w->max_head = w->max_len = 0U;
+    w->sum = 0.0;
+    w->sum_sq = 0.0;
+    w->until_resum = w->capacity;
+    if (w->hist != NULL) memset(w->hist, 0, sizeof(uint32_t) * w->bins);
+}
+
+uint32_t stream_window_count(const stream_window_t *w)
+{
+    return w->count;
+}
+
+float stream_window_min(const stream_window_t *w)
+{
+    return (w->min_len > 0U) ? w->values[w->min_q[w->min_head]] : 0.0f;
+}
+
+float stream_window_max(const stream_window_t *w)
+{
+    return (w->max_len > 0U) ? w->values[w->max_q[w->max_head]] : 0.0f;
+}
+
+float stream_window_mean(const stream_window_t *w)
+{
+    return (w->count > 0U) ? (float)(w->sum / w->count) : 0.0f;
+}
+
+float stream_window_stddev(const stream_window_t *w)
+{
+    if (w->count == 0U) return 0.0f;
+    double mean = w->sum / w->count;
+    double var = w->sum_sq / w->count - mean * mean;
+    return (var > 0.0) ? (float)sqrt(var) : 0.0f;
+}
+
+float stream_window_percentile(const stream_window_t *w, float p)
+{
+    if (w->hist == NULL || w->count == 0U) return 0.0f;
+    if (p < 0.0f) p = 0.0f;
+    if (p > 100.0f) p = 100.0f;
+
+    float rank = p / 100.0f * (float)w->count;
+    uint32_t below = 0U;
+    for (uint32_t b = 0; b < w->bins; b++) {
+        uint32_t c = w->hist[b];
+        if (c > 0U && (float)(below + c) >= rank) {
+            float frac = (rank - (float)below) / (float)c;
+            return w->hist_lo + ((float)b + frac) / w->hist_scale;
+        }
+        below += c;
+    }
+    return w->hist_lo + (float)w->bins / w->hist_scale;
+}
+
+/* ── EWMA ─────────────────────────────────────────────── */
+
+void stream_ewma_init(stream_ewma_t *e, float alpha)
+{
+    e->alpha = (alpha > 0.0f && alpha <= 1.0f) ? alpha : 1.0f;
+    e->value = 0.0f;
+    e->primed = false;
+}
+
+float stream_ewma_alpha(float dt, float tau)
+{
+    return (tau > 0.0f) ? 1.0f - expf(-dt / tau) : 1.0f;
+}
+
+float stream_ewma_push(stream_ewma_t *e, float x)
+{
+    if (!e->primed) {
+        e->value = x;
+        e->primed = true;
+    } else {
+        e->value += e->alpha * (x - e->value);
+    }
+    return e->value;
+}
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * @file    stream_stats.h
+ * @brief   Streaming statistics — sliding-window min/max/mean/std, EWMA and
+ *          windowed percentiles, O(1) per sample
+ *
+ *   stream_window_t  the last `capacity` samples. Min and max come from two
+ *                    monotonic deques (each sample enters and leaves each
+ *                    deque once), mean and standard deviation from running
+ *                    sums. An optional histogram over a fixed range gives
+ *                    percentiles to within one bin. Nothing is rescanned per
+ *                    sample, so a 10k-sample window costs the same per push
+ *                    as a 10-sample one.
+ *
+ *   stream_ewma_t    exponentially weighted moving average (no window).
+ *
+ * The running sums are rebuilt from the ring once per `capacity` pushes so
+ * rounding error cannot build up; that keeps the cost O(1) amortized.
+ * Storage is supplied by the caller, so windows can live in static memory.
+ ******************************************************************************/
+#ifndef STREAM_STATS_H
+#define STREAM_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct
+{
+    float    *values;       /* caller storage [capacity], ring of samples */
+    uint32_t *min_q;        /* caller storage [capacity], deque of slots */
+    uint32_t *max_q;        /* caller storage [capacity], deque of slots */
+    uint32_t  capacity;
+    uint32_t  count;        /* samples in the window (<= capacity) */
+    uint32_t  pos;          /* slot of the next sample */
+    uint32_t  min_head, min_len;
+    uint32_t  max_head, max_len;
+    double    sum;
+    double    sum_sq;
+    uint32_t  until_resum;  /* pushes left before the sums are rebuilt */
+
+    /* Optional histogram for percentiles (hist == NULL: none) */
+    uint32_t *hist;         /* caller storage [bins] */
+    uint16_t  bins;
+    float     hist_lo;
+    float     hist_scale;   /* bins / (hi - lo) */
+} stream_window_t;
+
+typedef struct
+{
+    float alpha;            /* weight of a new sample, 0..1 */
+    float value;
+    bool  primed;           /* false until the first sample */
+} stream_ewma_t;
+
+/* ── Sliding window ───────────────────────────────────── */
+
+/* values, min_q and max_q each hold capacity elements */
+void stream_window_init(stream_window_t *w, float *values, uint32_t *min_q,
+                        uint32_t *max_q, uint32_t capacity);
+
+/* Keep a histogram of the window over [lo, hi) for percentiles. Samples
+ * outside the range count in the first or last bin. May be called at any
+ * time; the samples already in the window are added. */
+void stream_window_set_hist(stream_window_t *w, uint32_t *counts, uint16_t bins,
+                            float lo, float hi);
+
+/* Add a sample, dropping the oldest if the window is full */
+void stream_window_push(stream_window_t *w, float x);
+
+/* Empty the window (the histogram range is kept) */
+void stream_window_reset(stream_window_t *w);
+
+/* Getters return 0 while the window is empty */
+uint32_t stream_window_count(const stream_window_t *w);
+float stream_window_min(const stream_window_t *w);
+float stream_window_max(const stream_window_t *w);
+float stream_window_mean(const stream_window_t *w);
+float stream_window_stddev(const stream_window_t *w);     /* population */
+
+/* p in 0..100, interpolated inside the bin; needs a histogram, O(bins) */
+float stream_window_percentile(const stream_window_t *w, float p);
+
+/* ── EWMA ─────────────────────────────────────────────── */
+
+void stream_ewma_init(stream_ewma_t *e, float alpha);
+
+/* alpha for samples every dt seconds and a time constant of tau seconds */
+float stream_ewma_alpha(float dt, float tau);
+
+/* Add a sample and return the new average (the first sample primes it) */
+float stream_ewma_push(stream_ewma_t *e, float x);
+
+#endif /* STREAM_STATS_H */
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * @file    wifi_profile_store.c
+ * @brief   PC simulator mock -- WiFi profile store on emulated NOR flash
+ *
+ *          Stores a single WiFi profile in a nor_log image file, so the
+ *          profile survives a restart (or a crash mid-save) like the
+ *          firmware's NVM copy. Same save / load / clear API as the
+ *          firmware version.
+ *
+ *          Shared by hmi_ep06_wifi_profile_nvm and
+ *          hmi_ep07_final_wifi_manager, which build it against their own
+ *          wifi_profile_types.h.
+ ******************************************************************************/
+#include "wifi_profile_store.h"
+
+#include "nor_log.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef WIFI_PROFILE_STORE_FILE
+#define WIFI_PROFILE_STORE_FILE     "wifi_profile.nvm"
+#endif
+
+#define WIFI_PROFILE_STORE_SECTORS  (4U)
+#define WIFI_PROFILE_KEY            "wifi/profile"
+
+static nor_log_t s_log;
+static bool s_log_open = false;
+
+static bool store_open(void)
+{
+    if (!s_log_open) {
+        s_log_open = nor_log_open(&s_log, WIFI_PROFILE_STORE_FILE,
+                                  WIFI_PROFILE_STORE_SECTORS);
+        if (!s_log_open) {
+            printf("[MOCK][PROFILE] OPEN_FAIL file=%s\n", WIFI_PROFILE_STORE_FILE);
+        }
+    }
+    return s_log_open;
+}
+
+static void store_log_wear(void)
+{
+    nor_log_stats_t st;
+
+    nor_log_get_stats(&s_log, &st);
+    printf("[MOCK][PROFILE] NVM user=%lluB flash=%lluB erases=%u..%u\n",
+           (unsigned long long)st.user_bytes, (unsigned long long)st.flash_bytes,
+           (unsigned)st.erase_min, (unsigned)st.erase_max);
+}
+
+bool wifi_profile_store_load(wifi_profile_data_t *out_profile)
+{
+    uint32_t len = 0;
+
+    if (out_profile == NULL) {
+        return false;
+    }
+
+    if (!store_open() ||
+        !nor_log_get(&s_log, WIFI_PROFILE_KEY, out_profile, sizeof(*out_profile), &len) ||
+        (len != sizeof(*out_profile))) {
+        printf("[MOCK][PROFILE] LOAD_EMPTY\n");
+        return false;
+    }
+
+    /* Never trust stored strings to be terminated. */
+    out_profile->ssid[sizeof(out_profile->ssid) - 1U] = '\0';
+    out_profile->password[sizeof(out_profile->password) - 1U] = '\0';
+    out_profile->security[sizeof(out_profile->security) - 1U] = '\0';
+    printf("[MOCK][PROFILE] LOAD_OK ssid=%s\n", out_profile->ssid);
+    return true;
+}
+
+bool wifi_profile_store_save(const wifi_profile_data_t *profile)
+{
+    if (profile == NULL) {
+        return false;
+    }
+
+    if (!store_open() ||
+        !nor_log_put(&s_log, WIFI_PROFILE_KEY, profile, sizeof(*profile)) ||
+        !nor_log_commit(&s_log)) {
+        printf("[MOCK][PROFILE] SAVE_FAIL ssid=%s\n", profile->ssid);
+        return false;
+    }
+
+    printf("[MOCK][PROFILE] SAVE_OK ssid=%s auto=%d\n",
+           profile->ssid, (int)profile->auto_connect);
+    store_log_wear();
+    return true;
+}
+
+bool wifi_profile_store_clear(void)
+{
+    if (!store_open() ||
+        !nor_log_delete(&s_log, WIFI_PROFILE_KEY) ||
+        !nor_log_commit(&s_log)) {
+        printf("[MOCK][PROFILE] CLEAR_FAIL\n");
+        return false;
+    }
+
+    printf("[MOCK][PROFILE] CLEAR_OK\n");
+    return true;
+}